@@ -27,6 +27,11 @@
 #include "S52MP.h"      // S52MarinerParameter
 #include "S57data.h"    // S57_prj2geo(), S52_geo2prj*(), projXY, S57_geo
 #include "S52CS.h"      // S52_CS_*()
+#include "S52RT.h"      // S52_RT_*()
+
+#ifdef S52_USE_SENC
+#include "S57senc.h"    // S57_sencLoadCell(), S57_sencSaveCell()
+#endif  // S52_USE_SENC
 #include "S52GL.h"      // S52_GL_draw()
 
 #ifdef S52_USE_GV
@@ -35,7 +40,7 @@
 #include "S57ogr.h"     // S57_ogrLoadCell()
 #endif // S52_USE_GV
 
-#include <string.h>     // memmove(), memcpy(), memset()
+#include <string.h>     // memmove(), memcpy(), memset(), strrchr()
 #include <strings.h>    // bzero()
 #include <math.h>       // INFINITY
 #include <stdio.h>      // setbuf()
@@ -127,6 +132,7 @@ typedef struct _cell {
 
     // S52 Object
     GPtrArray *renderBin[S52_PRIO_NUM][S52_N_OBJ];
+    S52_RT    *rtree    [S52_PRIO_NUM][S52_N_OBJ];  // spatial index of renderBin (NULL: rebuild at next cull)
 
     GPtrArray *lights_sector;   // see _doCullLights
 
@@ -145,25 +151,34 @@ typedef struct _cell {
     int        projDone;       // TRUE this cell has been projected
 #endif
 
-    /*
-    // optimisation - do CS only on obj affected by a change in a MP
-    // instead of resolving the CS logic at render-time.
-    // Will help to clean up the render-time code.
-    // list of ref of S52_obj that have CS in their LUP
-    GPtrArray *DEPARElist;
-    GPtrArray *DEPCNTlist;
-    GPtrArray *OBSTRNlist;
-    GPtrArray *RESARElist;
-    GPtrArray *WRECKSlist;
-    */
+    // CS dependency index: for each Mariners' Param, ref to obj whose CS read it
+    // (see S52_PL_getMPdep()) - NULL if none, rebuilt by _app() on a full CS resolve
+    // Note: _marinerCell is not indexed - Mariners' Object come and go
+    GPtrArray *MPdep[S52_MAR_NUM];
+
+    // geo coord and S57_geo of this cell (NULL: on the heap - _marinerCell)
+    S57_arena *arena;
+
+    // AC of renderBin[prio][S52_AREAS] merged in one VBO (NULL: created at next draw)
+    S52_GL_ACbatch *ACbatch[S52_PRIO_NUM];
+
+    // LS of renderBin[prio][S52_LINES] merged in one VBO (NULL: created at next draw)
+    S52_GL_LSbatch *LSbatch[S52_PRIO_NUM];
 
 } _cell;
 
 // work buffer
 #ifdef S52_USE_SUPP_LINE_OVERLAP
-static guint      _baseRCID       = 0;     // offset of "ConnectedNode" (first primitive)
-static GPtrArray *_ConnectedNodes = NULL;  // Note: ConnectedNodes rcid are random in some case (CA4579016)
-static GPtrArray *_S57Edges       = NULL;  // final segment build from ENs and CNs
+typedef struct _edgeBuf {
+    guint      baseRCID;        // offset of "ConnectedNode" (first primitive)
+    GPtrArray *ConnectedNodes;  // Note: ConnectedNodes rcid are random in some case (CA4579016)
+    GPtrArray *S57Edges;        // final segment build from ENs and CNs
+} _edgeBuf;
+static _edgeBuf   _edgeMain     = {0, NULL, NULL};  // serial load - a worker use the one of its job
+#endif
+
+#ifdef S52_USE_SENC
+static GPtrArray *_sencList     = NULL;    // S57_geo in load order - saved to SENC once the cell is loaded
 #endif
 
 #ifdef S52_USE_C_AGGR_C_ASSO
@@ -184,12 +199,15 @@ static GString   *_plibNameList = NULL;    // string that gather plibName
 static GString   *_paltNameList = NULL;    // string that gather palette name
 static GString   *_S57ClassList = NULL;    // string that gather cell S57 class name
 static GString   *_S52ObjNmList = NULL;    // string that gather cell S52 obj name
+static GString   *_hazardList   = NULL;    // string that gather S57ID of hazard (S52_checkHazard())
+static GHashTable *_hazardSet   = NULL;    // S57_geo highlighted by the last S52_checkHazard()
 static GString   *_cellNameList = NULL;    // string that gather cell name
 
 static int        _doInit       = TRUE;    // init the lib
 
 // FIXME: reparse CS of the affected MP only (ex: ship outline MP need only to reparse OWNSHP CS)
 static int        _APP_CS       = FALSE;   // TRUE will recreate *all* CS at next draw() or drawLast()
+static guint64    _APP_CSMP     = 0;       // S52_MP_BIT() of Mariners' Param changed - recreate CS that read them
 static int        _APP_DATCVR   = FALSE;   // TRUE will compute HO Data Limit (CSP union), scale boundary, ..
 static int        _APP_RASTER   = FALSE;   // TRUE will compute raster texture
 
@@ -197,6 +215,25 @@ static int        _CULL_Lights  = FALSE;   // TRUE will do lights_sector culling
 static int        _CULL_hodata  = FALSE;   // TRUE will compute display of HODATA
 static int        _CULL_sclbdy  = FALSE;   // TRUE will compute display of SCLBDY
 
+// partial redraw of layer 9 (drawLast())
+#define DIRTY_MAX   8                      // max nbr of dirty rect - nearest rect merged
+#define DIRTY_FULL  0.5                    // redraw all when dirty rect cover more of the view
+static int        _DRAW_lastAll = TRUE;    // TRUE will redraw all of layer 9 (new FB of draw(), MP, ..)
+static GHashTable*_lastRect     = NULL;    // S52_obj --> window extent at the previous drawLast() (x0,y0,x1,y1,stamp)
+static GHashTable*_lastDirty    = NULL;    // S52_obj changed since the previous drawLast()
+static guint      _lastStamp    = 0;
+static double     _dirtyRect[DIRTY_MAX][4];
+static guint      _nDirtyRect   = 0;
+
+// frame stats (S52_getFrameStats()) - ring of the last S52_STATS_NFRAME frame
+static S52_frameStats _stats[S52_STATS_NFRAME];
+static guint      _statsN       = 0;       // nbr of frame since init - current frame is _statsN-1
+static int        _statsDraw    = FALSE;   // TRUE: draw() done, the next drawLast() is in the same frame
+static double     _statsTick    = 0.0;     // _timer at the previous lap (msec)
+static int        _statsOn      = FALSE;   // TRUE: in draw() / drawLast() - pick path not counted
+static S52_frameStats _statsNull;          // sink when _statsOn is FALSE
+static S52_GL_stat _statsGL;               // GL counter at the start of draw() / drawLast()
+
 // obj of union of all HO Data Limit
 static S52ObjectHandle _HODATAUnion = FALSE;
 // list of scale boundary reference (system generated DATCVR01-3)
@@ -226,6 +263,8 @@ static S52ObjectHandle _BLKADJ01 = FALSE;
 static GPtrArray      *_rasterList  = NULL;  // list of Raster
 
 static GPtrArray      *_tmpRenderBin= NULL;  // list of obj that override prio
+static GArray         *_rtreeIdx    = NULL;  // work buffer - index of obj in rbin found by S52_RT_search()
+#define RTREE_MINOBJ   32                     // bellow that nbr of obj in a rbin, a linear scan is faster
 
 // callback to eglMakeCurrent() / eglSwapBuffers()
 #ifdef S52_USE_EGL
@@ -264,6 +303,50 @@ static GMutex        _mp_mutex;
 #define GMUTEXUNLOCK g_mutex_unlock
 #endif
 
+// S52_loadCellAsync() - need GThreadPool/GPrivate (glib >= 2.32) and OGR callback
+#if !(defined(S52_USE_ANDROID) || defined(S52_USE_MINGW) || defined(S52_USE_GV))
+#define S52_LOADCELL_ASYNC
+typedef struct _loadJob {
+    gchar                *encPath;
+    S52_loadCellAsync_cb  cb;
+    GPtrArray            *geoList;   // S57_geo in load order - own by the job until swapped in a _cell
+    localObj             *local;     // CS list of geoList (S52_CS_add() / S52_CS_touch() done by the worker)
+    S57_arena            *arena;     // geo of geoList - move to the _cell with geoList
+    int                   parsed;    // TRUE if geoList / local are ready to be swapped in
+    int                   sencLoad;  // TRUE if geoList come from the SENC (touch / overlap mark done)
+#ifdef S52_USE_SUPP_LINE_OVERLAP
+    _edgeBuf              edge;      // Edge/ConnectedNode of this cell - overlap resolved at swap time
+#endif
+} _loadJob;
+static GThreadPool   *_loadPool   = NULL;                  // S52_loadCellAsync() - one worker, cell are swapped in queue order
+static GPrivate       _loadJobKey = G_PRIVATE_INIT(NULL);  // _loadJob of the worker thread (OGR callback)
+static volatile gint  _loadAbort  = FALSE;                 // S52_done() - abort job at the next progress
+#endif
+
+#ifdef S52_USE_SUPP_LINE_OVERLAP
+static _edgeBuf  *_getEdgeBuf(void)
+// Edge/ConnectedNode work buffer of the calling thread
+{
+#ifdef S52_LOADCELL_ASYNC
+    _loadJob *job = (_loadJob *) g_private_get(&_loadJobKey);
+    if (NULL != job)
+        return &job->edge;
+#endif
+
+    return &_edgeMain;
+}
+#endif
+
+// resolve CS of all obj concurrently in _app() - need GThread/GPrivate (glib >= 2.32)
+#if !(defined(S52_USE_ANDROID) || defined(S52_USE_MINGW))
+#define S52_RESOLVE_PARALLEL
+#define RESOLVE_CHUNK 256      // nbr of obj taken at once by a resolve thread
+typedef struct _resolveCtx {
+    GPtrArray     *objList;    // obj to resolve - rbin of all cell flattened
+    volatile gint  next;       // index in objList of the next chunk to take
+} _resolveCtx;
+#endif
+
 // debug
 static const char *_mutexOwner      = NULL;
 static guint       _mutexOwnerS57ID = 0;
@@ -403,25 +486,26 @@ S52_MAR_SYMBOLIZED_BND - alternate
 S52_MAR_DATUM_OFFSET
 */
     // set APP() / CULL() flags
+    // Note: only obj with a CS that read paramID are re-resolved (see _appMPdep())
     switch (paramID) {
         // _SNDFRM02->OBSTRN04, WRECKS02;
-        case S52_MAR_SAFETY_DEPTH        : _APP_CS      = TRUE; break;
+        case S52_MAR_SAFETY_DEPTH        : _APP_CSMP   |= S52_MP_BIT(paramID); break;
         // _SEABED01->DEPARE01;
-        case S52_MAR_SHALLOW_CONTOUR     : _APP_CS      = TRUE; break;
+        case S52_MAR_SHALLOW_CONTOUR     : _APP_CSMP   |= S52_MP_BIT(paramID); break;
         // _SEABED01->DEPARE01;
-        case S52_MAR_TWO_SHADES          : _APP_CS      = TRUE; break;
+        case S52_MAR_TWO_SHADES          : _APP_CSMP   |= S52_MP_BIT(paramID); break;
         // _SEABED01->DEPARE01;
-        case S52_MAR_SHALLOW_PATTERN     : _APP_CS      = TRUE; break;
-        case S52_MAR_SYMBOLIZED_BND      : _APP_CS      = TRUE; break;
+        case S52_MAR_SHALLOW_PATTERN     : _APP_CSMP   |= S52_MP_BIT(paramID); break;
+        case S52_MAR_SYMBOLIZED_BND      : _APP_CSMP   |= S52_MP_BIT(paramID); break;
 
         // DEPCNT02; _SEABED01->DEPARE01; _UDWHAZ03->OBSTRN04, WRECKS02;
-        case S52_MAR_SAFETY_CONTOUR      : _APP_CS      = TRUE;
+        case S52_MAR_SAFETY_CONTOUR      : _APP_CSMP   |= S52_MP_BIT(paramID);
                                            _APP_RASTER  = TRUE; break;
         // _SEABED01->DEPARE01;
-        case S52_MAR_DEEP_CONTOUR        : _APP_CS      = TRUE;
+        case S52_MAR_DEEP_CONTOUR        : _APP_CSMP   |= S52_MP_BIT(paramID);
                                            _APP_RASTER  = TRUE; break;
         // DEPARE01; DEPCNT02; _DEPVAL01; SLCONS03; _UDWHAZ03;
-        case S52_MAR_DATUM_OFFSET        : _APP_CS      = TRUE;
+        case S52_MAR_DATUM_OFFSET        : _APP_CSMP   |= S52_MP_BIT(paramID);
                                            _APP_RASTER  = TRUE; break;
 
         case S52_MAR_DISP_HODATA_UNION   : _CULL_hodata = TRUE; break;
@@ -431,48 +515,9 @@ S52_MAR_DATUM_OFFSET
         default: break;
     }
 
-    ///////////////////////////////////////////////
-    // FIXME: process _APP_CS == TRUE immediatly
-    //
-
-    //S52_MAR_SYMBOLIZED_BND
-    // RESARE02;
-
-    //S52_MAR_SAFETY_DEPTH
-    // OBSTRN04,
-    // WRECKS02;
-
-    //S52_MAR_SAFETY_CONTOUR
-    // DEPARE01;
-    // DEPCNT02;
-    // OBSTRN04,
-    // WRECKS02;
-    //S52_MAR_SHALLOW_CONTOUR
-    // DEPARE01;
-    //S52_MAR_DEEP_CONTOUR
-    // DEPARE01;
-    //S52_MAR_SHALLOW_PATTERN
-    // DEPARE01;
-    //S52_MAR_TWO_SHADES
-    // DEPARE01
-
-
-    // optimisation: resolve only symb affected OR resolve immediatly on setMarParam()
-    // 1 - for all cell
-    //   1.1 - resolveSMB(obj) in XXXlist
-    //   1.2 - _moveObj()
-
-    // unique CS:
-    // MP - doesn't change layer, Mariners' Param (no _moveObj())
-    // OP - can change layer, Override Prio, need to call _moveObj()
-    // DEPARE01; MP
-    // DEPCNT02; MP, OP
-    // OBSTRN04;     OP
-    // RESARE02;     OP
-    // WRECKS02;     OP
-
-    // OWNSHP02; MP
-    // VESSEL01; MP
+    // palette, text, symbol size, .. all in tile and layer 9
+    S52_GL_delTiles();
+    _DRAW_lastAll = TRUE;
 
     GMUTEXUNLOCK(&_mp_mutex);
 
@@ -487,6 +532,9 @@ DLL int    STD S52_setTextDisp(unsigned int prioIdx, unsigned int count, unsigne
 
     int ret = S52_MP_setTextDisp(prioIdx, count, state);
 
+    S52_GL_delTiles();
+    _DRAW_lastAll = TRUE;
+
     GMUTEXUNLOCK(&_mp_mutex);
 
     return ret;
@@ -572,14 +620,6 @@ static _cell     *_newCell(const char *filename)
 
         cell->projDone     = FALSE;
 
-        /*
-        cell->DEPARElist = g_ptr_array_new();
-        cell->DEPCNTlist = g_ptr_array_new();
-        cell->OBSTRNlist = g_ptr_array_new();
-        cell->RESARElist = g_ptr_array_new();
-        cell->WRECKSlist = g_ptr_array_new();
-        */
-
         _crntCell = cell;
     }
 
@@ -604,14 +644,45 @@ static void       _delObj(S52_obj *obj)
     return;
 }
 
+static int        _doneMPdep(_cell *c)
+// free CS dependency index - ref only
+{
+    for (guint p=0; p<S52_MAR_NUM; ++p) {
+        if (NULL != c->MPdep[p]) {
+            g_ptr_array_free(c->MPdep[p], TRUE);
+            c->MPdep[p] = NULL;
+        }
+    }
+
+    return TRUE;
+}
+
+static void       _doneHazard(GPtrArray *rbin)
+// forget hazard of this render bin - geo about to be freed
+{
+    for (guint i=0; i<rbin->len; ++i)
+        g_hash_table_remove(_hazardSet, S52_PL_getGeo((S52_obj *)g_ptr_array_index(rbin, i)));
+
+    return;
+}
+
 static void       _freeCell(_cell *c)
 {
+    if ((NULL!=_hazardSet) && (0<g_hash_table_size(_hazardSet)))
+        TRAV_RBIN_ij(_doneHazard(c->renderBin[i][j]));
+
     if (NULL != c->cellName)
         g_string_free(c->cellName, TRUE);
 
     g_free((gpointer)c->cellPath);
 
     TRAV_RBIN_ij(g_ptr_array_free(c->renderBin[i][j], TRUE));
+    TRAV_RBIN_ij(S52_RT_done(c->rtree[i][j]));
+
+    for (guint i=0; i<S52_PRIO_NUM; ++i) {
+        S52_GL_doneACBatch(c->ACbatch[i]);
+        S52_GL_doneLSBatch(c->LSbatch[i]);
+    }
 
     S52_CS_done(c->local);
 
@@ -622,16 +693,13 @@ static void       _freeCell(_cell *c)
     g_ptr_array_free(c->objList_supp,  TRUE);
     g_ptr_array_free(c->objList_over,  TRUE);
 
-    /*
-    if (NULL != c->DEPARElist)   g_ptr_array_free(c->DEPARElist, TRUE);
-    if (NULL != c->DEPCNTlist)   g_ptr_array_free(c->DEPCNTlist, TRUE);
-    if (NULL != c->OBSTRNlist)   g_ptr_array_free(c->OBSTRNlist, TRUE);
-    if (NULL != c->RESARElist)   g_ptr_array_free(c->RESARElist, TRUE);
-    if (NULL != c->WRECKSlist)   g_ptr_array_free(c->WRECKSlist, TRUE);
-    */
+    _doneMPdep(c);
 
     g_string_free(c->S57ClassList, TRUE);
 
+    // last - geo of all obj in renderBin are in there
+    S57_doneArena(c->arena);
+
     g_free(c);
 
     //return TRUE;
@@ -663,6 +731,26 @@ static int        _initPROJview(void)
 
 //void (*GFunc) (gpointer data, gpointer user_data);
 static void       _S57_geo2prj(S52_obj *obj, gpointer dummy) {(void)dummy; S57_geo2prj(S52PLGETGEO(obj));}
+#ifdef S52_USE_PROJ
+static void       _addLODgeo(S52_obj *obj, GPtrArray *geoList) {g_ptr_array_add(geoList, S52PLGETGEO(obj));}
+static int        _newLOD(_cell *c)
+// simplified LINES / AREAS of this cell (projected) for small scale
+// Note: _marinerCell is not simplified - Mariners' Object move all the time
+{
+    if (_marinerCell == c)
+        return FALSE;
+
+    GPtrArray *geoList = g_ptr_array_new();
+    TRAV_RBIN_ij(g_ptr_array_foreach(c->renderBin[i][j], (GFunc)_addLODgeo, geoList));
+
+    S57_newLOD(geoList);
+
+    g_ptr_array_free(geoList, TRUE);
+
+    return TRUE;
+}
+#endif  // S52_USE_PROJ
+
 static int        _projectCells(void)
 {
     for (guint k=0; k<_cellList->len; ++k) {
@@ -672,6 +760,11 @@ static int        _projectCells(void)
 
             g_ptr_array_foreach(c->lights_sector, (GFunc)_S57_geo2prj, NULL);
 
+#ifdef S52_USE_PROJ
+            // LOD tolerance is in meter
+            _newLOD(c);
+#endif
+
             c->projDone = TRUE;
         }
     }
@@ -693,6 +786,21 @@ static int        _collect_CS_touch(_cell* c)
     return TRUE;
 }
 
+static ObjExt_t   _getObjExt(S52_obj *obj) {return S57_getGeoExt(S52PLGETGEO(obj));}
+static int        _buildRTree(_cell *c)
+// (re)build the spatial index of each render bin of this cell
+// Note: _marinerCell is not indexed - Mariners' Object move all the time
+{
+    if (_marinerCell == c)
+        return FALSE;
+
+    TRAV_RBIN_ij(c->rtree[i][j] = S52_RT_done(c->rtree[i][j]));
+    TRAV_RBIN_ij(if (RTREE_MINOBJ <= c->renderBin[i][j]->len)
+                     c->rtree[i][j] = S52_RT_new(c->renderBin[i][j], (S52_RT_ext_cb)_getObjExt));
+
+    return TRUE;
+}
+
 DLL int    STD S52_init(int screen_pixels_w, int screen_pixels_h, int screen_mm_w, int screen_mm_h, S52_log_cb log_cb)
 // init basic stuff (outside of the main loop)
 {
@@ -753,6 +861,14 @@ DLL int    STD S52_init(int screen_pixels_w, int screen_pixels_h, int screen_mm_
         _S57ClassList = g_string_new("");
     if (NULL == _S52ObjNmList)
         _S52ObjNmList = g_string_new("");
+    if (NULL == _hazardList)
+        _hazardList   = g_string_new("");
+    if (NULL == _hazardSet)
+        _hazardSet    = g_hash_table_new(g_direct_hash, g_direct_equal);
+    if (NULL == _lastRect)
+        _lastRect     = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    if (NULL == _lastDirty)
+        _lastDirty    = g_hash_table_new(g_direct_hash, g_direct_equal);
 
 
     ///////////////////////////////////////////////////////////
@@ -836,6 +952,10 @@ DLL int    STD S52_init(int screen_pixels_w, int screen_pixels_h, int screen_mm_
     if (NULL == _tmpRenderBin)
         _tmpRenderBin = g_ptr_array_new();
 
+    // init R-tree search result
+    if (NULL == _rtreeIdx)
+        _rtreeIdx = g_array_new(FALSE, FALSE, sizeof(guint));
+
     // scale boudary
     if (NULL == _sclbdyList)
         _sclbdyList = g_array_new(FALSE, FALSE, sizeof(unsigned int));
@@ -893,6 +1013,17 @@ DLL CCHAR *STD S52_version(void)
 DLL int    STD S52_done(void)
 // clear all - shutdown libS52
 {
+#ifdef S52_LOADCELL_ASYNC
+    // abort queued S52_loadCellAsync() and wait for the worker
+    // Note: before the lock - the worker lock to swap its cell in
+    if (NULL != _loadPool) {
+        g_atomic_int_set(&_loadAbort, TRUE);
+        g_thread_pool_free(_loadPool, FALSE, TRUE);
+        _loadPool = NULL;
+        g_atomic_int_set(&_loadAbort, FALSE);
+    }
+#endif
+
     S52_CHECK_MUTX_INIT;
 
     // this call free_func() if set
@@ -924,6 +1055,11 @@ DLL int    STD S52_done(void)
     g_string_free(_cellNameList, TRUE); _cellNameList = NULL;
     g_string_free(_S57ClassList, TRUE); _S57ClassList = NULL;
     g_string_free(_S52ObjNmList, TRUE); _S52ObjNmList = NULL;
+    g_string_free(_hazardList,   TRUE); _hazardList   = NULL;
+    g_hash_table_destroy(_hazardSet);   _hazardSet    = NULL;
+    g_hash_table_destroy(_lastRect);    _lastRect     = NULL;
+    g_hash_table_destroy(_lastDirty);   _lastDirty    = NULL;
+    _statsN = 0;
 
 #if !defined(S52_USE_ANDROID)
     // flush raster (bathy,..)
@@ -943,6 +1079,9 @@ DLL int    STD S52_done(void)
     g_ptr_array_free(_tmpRenderBin, TRUE);
     _tmpRenderBin = NULL;
 
+    g_array_free(_rtreeIdx, TRUE);
+    _rtreeIdx = NULL;
+
     // scale boudary list - obj allready deleted
     g_array_free(_sclbdyList, TRUE);
     _sclbdyList = NULL;
@@ -967,7 +1106,30 @@ exit:
 }
 
 #ifdef S52_USE_SUPP_LINE_OVERLAP
-static int        _suppLineOverlap(void)
+static int        _doneEdgeBuf(_edgeBuf *eb)
+// free all overlaping line data
+// these are not S52_obj, so no delObj()
+{
+    int quiet = TRUE;
+
+    if (NULL != eb->S57Edges) {
+        g_ptr_array_foreach(eb->S57Edges, (GFunc)S57_doneData, &quiet);
+        // this call free_func() if set
+        g_ptr_array_free(eb->S57Edges, TRUE);
+    }
+    if (NULL != eb->ConnectedNodes) {
+        g_ptr_array_foreach(eb->ConnectedNodes, (GFunc)S57_doneData, &quiet);
+        g_ptr_array_free(eb->ConnectedNodes, TRUE);
+    }
+
+    eb->S57Edges       = NULL;
+    eb->ConnectedNodes = NULL;
+    eb->baseRCID       = 0;
+
+    return TRUE;
+}
+
+static int        _suppLineOverlap(_edgeBuf *eb)
 // no SUPP in case manual chart correction (LC(CHCRIDnn) and LC(CHCRDELn))
 // Note: for now, work for LC() only (LS() not processed)
 // FIXME: does NAME_RCNM, NAME_RCID and MASK value refer to original winding?
@@ -981,7 +1143,8 @@ static int        _suppLineOverlap(void)
 // NAME_RCID (IntegerList) = (1:72)
 {
     //return_if_null(_crntCell->S57Edges);
-    return_if_null(_S57Edges);
+    if (NULL == eb->S57Edges)
+        goto exit;
     //return_if_null(_crntCell->ConnectedNodes); // not used (yet!)
 
     // assume that there is nothing on layer S52_PRIO_NODATA
@@ -1176,9 +1339,9 @@ static int        _suppLineOverlap(void)
                     if (S57_RCNM_VE == (*splitrcnm)[1]) {
                         // search Edges with the same RCID then one of geo RCID
                         //for (guint j=0; j<_crntCell->S57Edges->len; ++j) {
-                        for (guint j=0; j<_S57Edges->len; ++j) {
+                        for (guint j=0; j<eb->S57Edges->len; ++j) {
                             //S57_geo *geoEdge      = (S57_geo *)g_ptr_array_index(_crntCell->S57Edges, j);
-                            S57_geo *geoEdge      = (S57_geo *)g_ptr_array_index(_S57Edges, j);
+                            S57_geo *geoEdge      = (S57_geo *)g_ptr_array_index(eb->S57Edges, j);
                             gchar   *name_rcidstr = S57_getRCIDstr(geoEdge);
 
                             // failsafe
@@ -1211,29 +1374,7 @@ static int        _suppLineOverlap(void)
     }
 
 exit:
-
-    {   // free all overlaping line data
-        // these are not S52_obj, so no delObj()
-        int quiet = TRUE;
-
-        //g_ptr_array_foreach(_crntCell->S57Edges,       (GFunc)S57_doneData, &quiet);
-        //g_ptr_array_foreach(_crntCell->ConnectedNodes, (GFunc)S57_doneData, &quiet);
-        g_ptr_array_foreach(_S57Edges,       (GFunc)S57_doneData, &quiet);
-        g_ptr_array_foreach(_ConnectedNodes, (GFunc)S57_doneData, &quiet);
-
-        // this call free_func() if set
-        //g_ptr_array_free(_crntCell->S57Edges,       TRUE);
-        //g_ptr_array_free(_crntCell->ConnectedNodes, TRUE);
-        g_ptr_array_free(_S57Edges,       TRUE);
-        g_ptr_array_free(_ConnectedNodes, TRUE);
-
-        //_crntCell->S57Edges       = NULL;
-        //_crntCell->ConnectedNodes = NULL;
-        //_crntCell->baseRCID       = 0;
-        _S57Edges       = NULL;
-        _ConnectedNodes = NULL;
-        _baseRCID       = 0;
-    }
+    _doneEdgeBuf(eb);
 
     return TRUE;
 }
@@ -1293,6 +1434,20 @@ static void       __linkRel2LNAM(S52_obj *obj, gpointer user_data)
     //return TRUE;
     return;
 }
+
+static int        _linkCellRel(_cell *c)
+// link C_AGGR / C_ASSO of this cell to their LNAM_REFS geo
+{
+    TRAV_RBIN_ij(g_ptr_array_foreach(c->renderBin[i][j],  (GFunc)__linkRel2LNAM, NULL));
+
+    // finish with this BBTree
+    if (NULL != _lnamBBT) {
+        g_tree_destroy(_lnamBBT);
+        _lnamBBT = NULL;
+    }
+
+    return TRUE;
+}
 #endif  // S52_USE_C_AGGR_C_ASSO
 
 static void       __dumpNODATAlayer(S52_obj *obj, gpointer dummy)
@@ -1315,6 +1470,22 @@ static void       __dumpNODATAlayer(S52_obj *obj, gpointer dummy)
     return;
 }
 
+static int        _checkNODATA(_cell *c)
+// failsafe - check if a PLib put an object on the NODATA layer
+{
+    PRINTF("DEBUG: NODATA Layer check -START- ==============================================\n");
+
+    for (S52ObjectType obj_t=S52__META; obj_t<S52_N_OBJ; ++obj_t) {
+        g_ptr_array_foreach(c->renderBin[S52_PRIO_NODATA][obj_t], (GFunc)__dumpNODATAlayer, NULL);
+    }
+
+    PRINTF("DEBUG: NODATA Layer check -END-   ==============================================\n");
+
+    return TRUE;
+}
+
+static int        _loadS57geo (const char *objname, S57_geo *geo);              // forward decl
+static int        __loadS57geo(const char *objname, S57_geo *geo, int addCS);  // forward decl
 static _cell     *_loadBaseCell(char *filename, S52_loadLayer_cb loadLayer_cb, S52_loadObject_cb loadObject_cb)
 {
     if ((FALSE==g_str_has_suffix(filename, ".000")) &&
@@ -1333,11 +1504,35 @@ static _cell     *_loadBaseCell(char *filename, S52_loadLayer_cb loadLayer_cb, S
     g_ptr_array_add(_cellList, c);
     g_ptr_array_sort(_cellList, _cmpCellINTU);
 
+    // geo of this cell go in its arena
+    c->arena = S57_newArena();
+    S57_setArena(c->arena);
+
+    int sencLoad = FALSE;
+#ifdef S52_USE_SENC
+    // skip OGR if the SENC of this cell is up to date
+    // Note: a user loadObject_cb() need the OGR feature, so SENC is bypassed
+    valueBuf sencPath = {'\0'};
+    if ((S52_loadObject==loadObject_cb) &&
+        (TRUE==g_str_has_suffix(filename, ".000")) &&
+        (TRUE==S52_utils_getConfig(CFG_SENC, sencPath)))
+    {
+        sencLoad = S57_sencLoadCell(sencPath, filename, _loadS57geo);
+        if (FALSE == sencLoad) {
+            // (re)build SENC from OGR
+            _sencList = g_ptr_array_new();
+        }
+    }
+
+    if (FALSE == sencLoad)
+#endif  // S52_USE_SENC
+    {
 #ifdef S52_USE_GV
-    S57_gvLoadCell (filename, layer_cb);
+        S57_gvLoadCell (filename, layer_cb);
 #else
-    S57_ogrLoadCell(filename, loadLayer_cb, loadObject_cb);
+        S57_ogrLoadCell(filename, loadLayer_cb, loadObject_cb);
 #endif
+    }
 
     // FIXME: resolve heightdatum correction here!
     // FIX: go trouht all layer that have to look for
@@ -1345,33 +1540,43 @@ static _cell     *_loadBaseCell(char *filename, S52_loadLayer_cb loadLayer_cb, S
     // ...
 
 #ifdef S52_USE_SUPP_LINE_OVERLAP
-    PRINTF("DEBUG: resolving line overlap for cell: %s ...\n", filename);
+    // overlap mark in the SENC
+    if (FALSE == sencLoad) {
+        PRINTF("DEBUG: resolving line overlap for cell: %s ...\n", filename);
 
-    _suppLineOverlap();
+        _suppLineOverlap(&_edgeMain);
+    }
 #endif
 
-#ifdef S52_USE_C_AGGR_C_ASSO
-    TRAV_RBIN_ij(g_ptr_array_foreach(c->renderBin[i][j],  (GFunc)__linkRel2LNAM, NULL));
+    S57_setArena(NULL);
 
-    // finish with this BBTree
-    if (NULL != _lnamBBT) {
-        g_tree_destroy(_lnamBBT);
-        _lnamBBT = NULL;
-    }
+#ifdef S52_USE_C_AGGR_C_ASSO
+    _linkCellRel(c);
 #endif
 
-    _collect_CS_touch(c);
+    // touch in the SENC
+    if (FALSE == sencLoad) {
+        _collect_CS_touch(c);
+    } else {
+        // need to do a _resolveCS() at the next _app()
+        _APP_CS = TRUE;
+    }
 
+#ifdef S52_USE_SENC
+    // save geo before projection - with touch and overlap mark
+    if (NULL != _sencList) {
+        S57_sencSaveCell(sencPath, filename, _sencList);
 
-    {   // failsafe - check if a PLib put an object on the NODATA layer
-        PRINTF("DEBUG: NODATA Layer check -START- ==============================================\n");
+        // ref only
+        g_ptr_array_free(_sencList, TRUE);
+        _sencList = NULL;
+    }
+#endif  // S52_USE_SENC
 
-        for (S52ObjectType obj_t=S52__META; obj_t<S52_N_OBJ; ++obj_t) {
-            g_ptr_array_foreach(c->renderBin[S52_PRIO_NODATA][obj_t], (GFunc)__dumpNODATAlayer, NULL);
-        }
+    // spatial index used by _cullObj()
+    _buildRTree(c);
 
-        PRINTF("DEBUG: NODATA Layer check -END-   ==============================================\n");
-    }
+    _checkNODATA(c);
 
     return c;
 }
@@ -1707,98 +1912,422 @@ static int        _loadRaster(const char *fname)
 #endif  // S52_USE_RADAR S52_USE_RASTER
 
 int            S52_loadLayer(const char *layername, void *layer, S52_loadObject_cb loadObject_cb);  // forward decl
-DLL int    STD S52_loadCell(const char *encPath, S52_loadObject_cb loadObject_cb)
-// FIXME: handle each type of cell separatly
-// OGR:
-// - S57:
-//    - CATALOG
-//    - *.000 (and update)
-//    - ENC_ROOT/
-// - shapefile
-// GDAL:
-// - GeoTIFF
+
+#ifdef S52_LOADCELL_ASYNC
+static int        _asyncAddGeo(const char *objname, S57_geo *geo)
+// collect the geo (OGR or SENC) of the cell loaded by this worker thread
 {
-    int    ret   = FALSE;
-    char  *fname = NULL;
+    (void)objname;
 
-    S52_loadLayer_cb loadLayer_cb = S52_loadLayer;
+    _loadJob *job = (_loadJob *) g_private_get(&_loadJobKey);
+    g_ptr_array_add(job->geoList, geo);
 
-    S52_CHECK_MUTX_INIT;
+    return TRUE;
+}
 
-    if (NULL == loadObject_cb) {
-        static int  silent = FALSE;
-        if (FALSE == silent) {
-            PRINTF("NOTE: using default S52_loadObject() callback\n");
-            PRINTF("NOTE: (this msg will not repeat)\n");
-            silent = TRUE;
-        }
-        // FIXME: add macro in S52_utils.h
-        //WARN_ONCE("NOTE: using default S52_loadObject() callback\n");
-        loadObject_cb = S52_loadObject;
+static int        _asyncLoadObject(const char *objname, void *shape)
+// same as S52_loadObject() but geo are kept out of the scenegraph
+{
+    if ((NULL==objname) || (NULL==shape)) {
+        PRINTF("WARNING: objname / shape NULL\n");
+        return FALSE;
     }
 
+    S57_geo *geo = S57_ogrLoadObject(objname, shape);
+    if (NULL == geo) {
+        PRINTF("OBJNAME:%s skipped .. no geo\n", objname);
+        return FALSE;
+    }
 
-#ifdef S52_USE_MINGW
-    // on Windows 32 the callback is broken
-    loadObject_cb = S52_loadObject;
+    return _asyncAddGeo(objname, geo);
+}
+
+#ifdef S52_USE_SUPP_LINE_OVERLAP
+static int        _loadS57ConnectedNode(const char *name, void *ConnectedNode);  // forward decl
+static int        _loadS57EdgeNode     (const char *name, void *Edge);           // forward decl
 #endif
 
-    // debug - if NULL check in file s52.cfg
-    if (NULL == encPath) {
-        valueBuf chartPath = {'\0'};
-        // FIXME: refactor to return "const char *"
-        if (FALSE == S52_utils_getConfig(CFG_CHART, chartPath)) {
-            PRINTF("WARNING: CHART label not found in .cfg!\n");
-            g_assert(0);
+static int        _asyncLoadLayer(const char *layername, void *layer, S52_loadObject_cb loadObject_cb)
+// same as S52_loadLayer() - Edge/ConnectedNode go in the work buffer of the job
+{
+#ifdef S52_USE_SUPP_LINE_OVERLAP
+    if ((0==g_strcmp0(layername, "IsolatedNode")) || (0==g_strcmp0(layername, "Face")))
+        return TRUE;
 
-            goto exit;
-        }
-        fname = g_strdup(chartPath);
-    } else {
-        // normal
-        fname = g_strdup(encPath);
+    if (0 == g_strcmp0(layername, "ConnectedNode"))
+        return S57_ogrLoadLayer(layername, layer, _loadS57ConnectedNode);
+
+    if (0 == g_strcmp0(layername, "Edge"))
+        return S57_ogrLoadLayer(layername, layer, _loadS57EdgeNode);
+#endif
+
+    return S57_ogrLoadLayer(layername, layer, loadObject_cb);
+}
+
+static int        _asyncProgress(_loadJob *job, double progress)
+// return FALSE if the job is cancelled (by the user or S52_done())
+{
+    if (TRUE == g_atomic_int_get(&_loadAbort))
+        return FALSE;
+
+    if ((NULL!=job->cb) && (FALSE==job->cb(job->encPath, progress))) {
+        PRINTF("NOTE: load cancelled by user (%s)\n", job->encPath);
+        return FALSE;
     }
-    fname = g_strstrip(fname);  // strip blank in place
 
-    if (TRUE != g_file_test(fname, (GFileTest) (G_FILE_TEST_EXISTS | G_FILE_TEST_IS_DIR))) {
-        PRINTF("WARNING: file or DIR not found (%s)\n", fname);
+    return TRUE;
+}
+
+static int        _asyncLayerProgress(int iLayer, int nLayer, void *user_data)
+// OGR parsing is the first 80% of the load
+{
+    return _asyncProgress((_loadJob *)user_data, (0.8 * (iLayer + 1)) / nLayer);
+}
+
+#ifdef S52_USE_SENC
+static int        _asyncSaveSENC(_loadJob *job)
+// save geo before projection - with touch and overlap mark
+{
+    valueBuf sencPath = {'\0'};
+    if ((TRUE==job->sencLoad) || (FALSE==S52_utils_getConfig(CFG_SENC, sencPath)))
+        return FALSE;
+
+    return S57_sencSaveCell(sencPath, job->encPath, job->geoList);
+}
+#endif
+
+static void       __asyncCS_add  (S57_geo *geo, localObj *local) {S52_CS_add  (local, geo);}
+static void       __asyncCS_touch(S57_geo *geo, localObj *local) {S52_CS_touch(local, geo);}
+static void       __asyncDoneGeo (S57_geo *geo, gpointer dummy)  {(void)dummy; S57_doneData(geo, NULL);}
+
+static int        _parseCell(_loadJob *job)
+// build the content of a cell outside the scenegraph (any thread)
+// Note: S57ID are defered to _swapCell() - same ID as serial loading
+{
+    job->geoList = g_ptr_array_new();
+    job->arena   = S57_newArena();
+    g_private_set(&_loadJobKey, job);
+    S57_deferS57ID(TRUE);
+    S57_setArena(job->arena);
 
+    if (FALSE == _asyncProgress(job, 0.0))
         goto exit;
-    }
 
-#ifdef S52_USE_WORLD
-    {   // experimental - load world shapefile
-        gchar *basename = g_path_get_basename(fname);
-        if (0 == g_strcmp0(basename, WORLD_SHP)) {
-            PRINTF("NOTE: loading %s\n", fname);
-            _cell *c = _loadBaseCell(fname, loadLayer_cb, loadObject_cb);
-            if (NULL != c) {
-                ret = TRUE;
-                c->cellPath = fname;
-            } else {
-                g_free(fname);
-            }
-            g_free(basename);
+    {   // parse - SENC or OGR
+#ifdef S52_USE_SENC
+        valueBuf sencPath = {'\0'};
+        if (TRUE == S52_utils_getConfig(CFG_SENC, sencPath))
+            job->sencLoad = S57_sencLoadCell(sencPath, job->encPath, _asyncAddGeo);
 
-            goto exit;
+        if (FALSE == job->sencLoad)
+#endif
+        {
+            if (FALSE == S57_ogrLoadCellProgress(job->encPath, _asyncLoadLayer, _asyncLoadObject, _asyncLayerProgress, job))
+                goto exit;
         }
-        g_free(basename);
     }
+
+    if (FALSE == _asyncProgress(job, 0.8))
+        goto exit;
+
+    // setup object used by CS - same as _collect_CS_touch(), on geo of this cell only
+    job->local = S52_CS_init();
+    g_ptr_array_foreach(job->geoList, (GFunc)__asyncCS_add,   job->local);
+    // touch in the SENC
+    if (FALSE == job->sencLoad)
+        g_ptr_array_foreach(job->geoList, (GFunc)__asyncCS_touch, job->local);
+
+    if (FALSE == _asyncProgress(job, 0.9))
+        goto exit;
+
+#if defined(S52_USE_SENC) && !defined(S52_USE_SUPP_LINE_OVERLAP)
+    // Note: overlap need the S52_obj - then saved by _swapCell()
+    _asyncSaveSENC(job);
 #endif
 
-#ifdef S52_USE_RASTER
-    {   // experimental - load raster (GeoTIFF)
-        if ((TRUE==g_str_has_suffix(fname, ".tif" )) ||
-            (TRUE==g_str_has_suffix(fname, ".tiff"))) {
-            _loadRaster(fname);
+    job->parsed = TRUE;
 
-            ret = TRUE;
-            goto exit;
-        }
+exit:
+    S57_setArena(NULL);
+    S57_deferS57ID(FALSE);
+    g_private_set(&_loadJobKey, NULL);
+
+    return job->parsed;
+}
+
+static _cell     *_swapCell(_loadJob *job)
+// insert the parsed content of job in a new cell - same as the end of _loadBaseCell()
+// Note: LUP (S52_PL_newObj()) is not thread safe - _mp_mutex must be held
+{
+    _cell *c = _newCell(job->encPath);
+    if (NULL == c) {
+        PRINTF("WARNING: _newCell() failed (%s)\n", job->encPath);
+        return NULL;
     }
+    g_ptr_array_add(_cellList, c);
+    g_ptr_array_sort(_cellList, _cmpCellINTU);
 
-#ifdef S52_USE_RADAR
-    /*
+    // CS add / touch done by the worker - use its list
+    S52_CS_done(c->local);
+    c->local   = job->local;
+    job->local = NULL;
+
+    for (guint i=0; i<job->geoList->len; ++i) {
+        S57_geo *geo = (S57_geo *) g_ptr_array_index(job->geoList, i);
+        S57_setS57ID(geo);
+        __loadS57geo(S57_getName(geo), geo, FALSE);
+    }
+
+#ifdef S52_USE_SUPP_LINE_OVERLAP
+    // need the S52_obj (LUP) of this cell - same order as serial load
+    // overlap mark in the SENC
+    if (FALSE == job->sencLoad) {
+        _suppLineOverlap(&job->edge);
+#ifdef S52_USE_SENC
+        _asyncSaveSENC(job);
+#endif
+    }
+#endif
+
+    // geo now own by the cell
+    g_ptr_array_free(job->geoList, TRUE);
+    job->geoList = NULL;
+    c->arena     = job->arena;
+    job->arena   = NULL;
+
+#ifdef S52_USE_C_AGGR_C_ASSO
+    _linkCellRel(c);
+#endif
+
+    // need to do a _resolveCS() at the next _app()
+    _APP_CS = TRUE;
+
+    // spatial index used by _cullObj()
+    _buildRTree(c);
+
+    _checkNODATA(c);
+
+    return c;
+}
+
+static _loadJob  *_doneJob(_loadJob *job)
+{
+    // failed / cancelled - geo never made it to a cell
+    if (NULL != job->geoList) {
+        g_ptr_array_foreach(job->geoList, (GFunc)__asyncDoneGeo, NULL);
+        g_ptr_array_free(job->geoList, TRUE);
+    }
+    if (NULL != job->local)
+        S52_CS_done(job->local);
+#ifdef S52_USE_SUPP_LINE_OVERLAP
+    _doneEdgeBuf(&job->edge);
+#endif
+    S57_doneArena(job->arena);
+
+    g_free(job->encPath);
+    g_free(job);
+
+    return NULL;
+}
+
+static void       _loadCellJob(_loadJob *job, gpointer dummy)
+// S52_loadCellAsync() worker - parse then swap the cell in
+{
+    (void)dummy;
+
+    int ret = FALSE;
+
+    if (FALSE == _parseCell(job))
+        goto exit;
+
+    GMUTEXLOCK(&_mp_mutex);
+
+    // S52_done() / S52_doneCell() race
+    _cell *c = (TRUE==_doInit || NULL==_cellList) ? NULL : _swapCell(job);
+    if (NULL != c) {
+        c->cellPath = g_strdup(job->encPath);
+
+#ifdef S52_USE_PROJ
+        if (TRUE == _initPROJview()) {
+            _projectCells();
+        }
+#endif
+
+        // _app() specific to sector light
+        _CULL_Lights = TRUE;
+        // _app() - compute HO Data Limit
+        _APP_DATCVR  = TRUE;
+
+        // new cell - tile and layer 9 redrawn
+        S52_GL_delTiles();
+        _DRAW_lastAll = TRUE;
+
+        ret = TRUE;
+    }
+
+    GMUTEXUNLOCK(&_mp_mutex);
+
+exit:
+    if (NULL != job->cb)
+        job->cb(job->encPath, (TRUE==ret) ? 1.0 : -1.0);
+
+    _doneJob(job);
+
+    return;
+}
+
+#ifdef S52_USE_OGR_FILECOLLECTOR
+static void       _parseCellJob(_loadJob *job, gpointer dummy) {(void)dummy; _parseCell(job);}
+static int        _loadCellsParallel(char **encList)
+// parse all base cell of encList concurrently (one OGR datasource per thread),
+// then swap them in one by one in encList order - same result as serial loading
+// Note: _mp_mutex is held by the caller
+{
+    guint      nCell   = g_strv_length(encList);
+    guint      nThread = MIN(g_get_num_processors(), nCell);
+    GPtrArray *jobList = g_ptr_array_new();
+    int        ret     = FALSE;
+
+    PRINTF("DEBUG: parsing %i cell(s) on %i thread(s)\n", nCell, nThread);
+
+    // OGR driver registration is not thread safe
+    S57_ogrInit();
+
+    GThreadPool *pool = g_thread_pool_new((GFunc)_parseCellJob, NULL, (gint)MAX(nThread, 1), TRUE, NULL);
+    for (guint i=0; i<nCell; ++i) {
+        _loadJob *job     = NULL;
+        gchar    *baseName = g_path_get_basename(encList[i]);
+
+        // not a base cell or allready loaded: left to _loadBaseCell()
+        if ((TRUE==g_str_has_suffix(encList[i], ".000")) && (0==_isCellLoaded(baseName))) {
+            job = g_new0(_loadJob, 1);
+            job->encPath = g_strdup(encList[i]);
+            g_thread_pool_push(pool, job, NULL);
+        }
+        g_ptr_array_add(jobList, job);
+
+        g_free(baseName);
+    }
+    // wait for all job
+    g_thread_pool_free(pool, FALSE, TRUE);
+
+    // merge
+    for (guint i=0; i<nCell; ++i) {
+        _loadJob *job = (_loadJob *) g_ptr_array_index(jobList, i);
+        _cell    *c   = NULL;
+
+        if (NULL == job) {
+            c = _loadBaseCell(encList[i], S52_loadLayer, S52_loadObject);
+        } else {
+            if (TRUE == job->parsed)
+                c = _swapCell(job);
+            _doneJob(job);
+        }
+
+        if (NULL != c) {
+            ret = TRUE;
+            c->cellPath = g_strdup(encList[i]);
+        }
+    }
+    g_ptr_array_free(jobList, TRUE);
+
+    return ret;
+}
+#endif  // S52_USE_OGR_FILECOLLECTOR
+#endif  // S52_LOADCELL_ASYNC
+
+DLL int    STD S52_loadCell(const char *encPath, S52_loadObject_cb loadObject_cb)
+// FIXME: handle each type of cell separatly
+// OGR:
+// - S57:
+//    - CATALOG
+//    - *.000 (and update)
+//    - ENC_ROOT/
+// - shapefile
+// GDAL:
+// - GeoTIFF
+{
+    int    ret   = FALSE;
+    char  *fname = NULL;
+
+    S52_loadLayer_cb loadLayer_cb = S52_loadLayer;
+
+    S52_CHECK_MUTX_INIT;
+
+    if (NULL == loadObject_cb) {
+        static int  silent = FALSE;
+        if (FALSE == silent) {
+            PRINTF("NOTE: using default S52_loadObject() callback\n");
+            PRINTF("NOTE: (this msg will not repeat)\n");
+            silent = TRUE;
+        }
+        // FIXME: add macro in S52_utils.h
+        //WARN_ONCE("NOTE: using default S52_loadObject() callback\n");
+        loadObject_cb = S52_loadObject;
+    }
+
+
+#ifdef S52_USE_MINGW
+    // on Windows 32 the callback is broken
+    loadObject_cb = S52_loadObject;
+#endif
+
+    // debug - if NULL check in file s52.cfg
+    if (NULL == encPath) {
+        valueBuf chartPath = {'\0'};
+        // FIXME: refactor to return "const char *"
+        if (FALSE == S52_utils_getConfig(CFG_CHART, chartPath)) {
+            PRINTF("WARNING: CHART label not found in .cfg!\n");
+            g_assert(0);
+
+            goto exit;
+        }
+        fname = g_strdup(chartPath);
+    } else {
+        // normal
+        fname = g_strdup(encPath);
+    }
+    fname = g_strstrip(fname);  // strip blank in place
+
+    if (TRUE != g_file_test(fname, (GFileTest) (G_FILE_TEST_EXISTS | G_FILE_TEST_IS_DIR))) {
+        PRINTF("WARNING: file or DIR not found (%s)\n", fname);
+
+        goto exit;
+    }
+
+#ifdef S52_USE_WORLD
+    {   // experimental - load world shapefile
+        gchar *basename = g_path_get_basename(fname);
+        if (0 == g_strcmp0(basename, WORLD_SHP)) {
+            PRINTF("NOTE: loading %s\n", fname);
+            _cell *c = _loadBaseCell(fname, loadLayer_cb, loadObject_cb);
+            if (NULL != c) {
+                ret = TRUE;
+                c->cellPath = fname;
+            } else {
+                g_free(fname);
+            }
+            g_free(basename);
+
+            goto exit;
+        }
+        g_free(basename);
+    }
+#endif
+
+#ifdef S52_USE_RASTER
+    {   // experimental - load raster (GeoTIFF)
+        if ((TRUE==g_str_has_suffix(fname, ".tif" )) ||
+            (TRUE==g_str_has_suffix(fname, ".tiff"))) {
+            _loadRaster(fname);
+
+            ret = TRUE;
+            goto exit;
+        }
+    }
+
+#ifdef S52_USE_RADAR
+    /*
     {   // debug - load raw raster RADAR (RAW)
         // FIXME: upgrade to glib-2.2: gboolean g_str_has_suffix(const gchar *str, const gchar *suffix);
         gchar *basename = g_path_get_basename(fname);
@@ -1856,6 +2385,13 @@ DLL int    STD S52_loadCell(const char *encPath, S52_loadObject_cb loadObject_cb
         // void CPL_DLL CPL_STDCALL CSLDestroy(char **papszStrList);
 
         char **encList = S57FileCollector(fname);
+#ifdef S52_LOADCELL_ASYNC
+        // parallel ingest - a user loadObject_cb() may not be thread safe
+        if ((NULL!=encList) && (S52_loadObject==loadObject_cb)) {
+            ret = _loadCellsParallel(encList);
+            CSLDestroy(encList);
+        } else
+#endif
         if (NULL != encList) {
             for (guint i=0; NULL!=encList[i]; ++i) {
                 char *encName = encList[i];
@@ -1898,6 +2434,9 @@ DLL int    STD S52_loadCell(const char *encPath, S52_loadObject_cb loadObject_cb
     // _app() - compute HO Data Limit
     _APP_DATCVR  = TRUE;
 
+    S52_GL_delTiles();
+    _DRAW_lastAll = TRUE;
+
 exit:
 
     GMUTEXUNLOCK(&_mp_mutex);
@@ -1905,6 +2444,79 @@ exit:
     return ret;
 }
 
+DLL int    STD S52_loadCellAsync(const char *encPath, S52_loadCellAsync_cb cb)
+{
+    return_if_null(encPath);
+
+#ifdef S52_LOADCELL_ASYNC
+    int    ret   = FALSE;
+    gchar *fname = NULL;
+
+    S52_CHECK_MUTX_INIT;
+
+    fname = g_strstrip(g_strdup(encPath));  // strip blank in place
+
+    if (FALSE == g_str_has_suffix(fname, ".000")) {
+        PRINTF("WARNING: filename (%s) not a S-57 base ENC [.000 terminated]\n", fname);
+        goto exit;
+    }
+
+    if (TRUE != g_file_test(fname, G_FILE_TEST_IS_REGULAR)) {
+        PRINTF("WARNING: file not found (%s)\n", fname);
+        goto exit;
+    }
+
+    {   // fail early - _newCell() check again at swap time
+        gchar *baseName = g_path_get_basename(fname);
+        guint  loaded   = _isCellLoaded(baseName);
+        g_free(baseName);
+        if (0 != loaded) {
+            PRINTF("WARNING: cell allready loaded (%s)\n", fname);
+            goto exit;
+        }
+    }
+
+    if (NULL == _loadPool) {
+        GError *error = NULL;
+
+        // OGR driver registration is not thread safe
+        S57_ogrInit();
+
+        _loadPool = g_thread_pool_new((GFunc)_loadCellJob, NULL, 1, FALSE, &error);
+        if (NULL == _loadPool) {
+            PRINTF("WARNING: g_thread_pool_new() failed (%s)\n", (NULL==error) ? "" : error->message);
+            g_clear_error(&error);
+            goto exit;
+        }
+    }
+
+    _loadJob *job = g_new0(_loadJob, 1);
+    job->encPath  = fname;
+    job->cb       = cb;
+    fname         = NULL;
+
+    g_thread_pool_push(_loadPool, job, NULL);
+
+    ret = TRUE;
+
+exit:
+    g_free(fname);
+
+    GMUTEXUNLOCK(&_mp_mutex);
+
+    return ret;
+
+#else   // S52_LOADCELL_ASYNC
+
+    // no thread - load now
+    int ret = S52_loadCell(encPath, NULL);
+    if (NULL != cb)
+        cb(encPath, (TRUE==ret) ? 1.0 : -1.0);
+
+    return ret;
+#endif  // S52_LOADCELL_ASYNC
+}
+
 DLL int    STD S52_doneCell(const char *encPath)
 // FIXME: the (futur) chart manager (CM) should to this by itself
 // so loadCell would load a CATALOG then CM would load individual cell
@@ -1985,6 +2597,9 @@ exit:
     // _app() - compute HO Data Limit
     _APP_DATCVR = TRUE;
 
+    S52_GL_delTiles();
+    _DRAW_lastAll = TRUE;
+
     g_free(fname);
 
     GMUTEXUNLOCK(&_mp_mutex);
@@ -2011,7 +2626,7 @@ static int        __builS57Edge(S57_geo *geo, double *ppt_0, double *ppt_1)
 
     // new S57 Edge = CN - EN - .. - EN - CN
     guint   npt_new     = npt + 2;  // the new edge will have 2 more point - one at each end
-    double *ppt_new     = g_new(double, npt_new*3);
+    double *ppt_new     = (double *) S57_newGeoMem(sizeof(double) * npt_new*3);
 
     // set coords at both ends
     ppt_new[0] = ppt_0[0];                  // CN-0
@@ -2025,19 +2640,20 @@ static int        __builS57Edge(S57_geo *geo, double *ppt_0, double *ppt_1)
         memcpy(ppt_new+3, ppt, sizeof(double) * 3 * npt);
     }
 
-    g_free(ppt);
+    S57_freeGeoMem(ppt);
 
     // update S57 Edge
     S57_setGeoLine(geo, npt_new, ppt_new);
 
     // add to this cell (crntCell)
+    _edgeBuf *eb = _getEdgeBuf();
     //if (NULL == _crntCell->S57Edges)
     //    _crntCell->S57Edges = g_ptr_array_new();
-    if (NULL == _S57Edges)
-        _S57Edges = g_ptr_array_new();
+    if (NULL == eb->S57Edges)
+        eb->S57Edges = g_ptr_array_new();
 
     //g_ptr_array_add(_crntCell->S57Edges, geo);
-    g_ptr_array_add(_S57Edges, geo);
+    g_ptr_array_add(eb->S57Edges, geo);
 
     return TRUE;
 }
@@ -2072,15 +2688,17 @@ static int        _loadS57EdgeNode(const char *name, void *Edge)
         return FALSE;
     }
 
+    _edgeBuf *eb = _getEdgeBuf();
+
     // node-0
     //if ((name_rcid_0 - _crntCell->baseRCID) > _crntCell->ConnectedNodes->len) {
-    if ((name_rcid_0 - _baseRCID) > _ConnectedNodes->len) {
+    if ((name_rcid_0 - eb->baseRCID) > eb->ConnectedNodes->len) {
         PRINTF("DEBUG: Edge end point 0 (%s) and ConnectedNodes array lenght mismatch\n", name_rcid_0str->str);
         g_assert(0);
         return FALSE;
     }
     //S57_geo *node_0 =  (S57_geo *)g_ptr_array_index(_crntCell->ConnectedNodes, (name_rcid_0 - _crntCell->baseRCID));
-    S57_geo *node_0 =  (S57_geo *)g_ptr_array_index(_ConnectedNodes, (name_rcid_0 - _baseRCID));
+    S57_geo *node_0 =  (S57_geo *)g_ptr_array_index(eb->ConnectedNodes, (name_rcid_0 - eb->baseRCID));
     if (NULL == node_0) {
         PRINTF("DEBUG: got empty node_0 at name_rcid_0 = %i\n", name_rcid_0);
         g_assert(0);
@@ -2092,13 +2710,13 @@ static int        _loadS57EdgeNode(const char *name, void *Edge)
 
     // node-1
     //if ((name_rcid_1 - _crntCell->baseRCID) > _crntCell->ConnectedNodes->len) {
-    if ((name_rcid_1 - _baseRCID) > _ConnectedNodes->len) {
+    if ((name_rcid_1 - eb->baseRCID) > eb->ConnectedNodes->len) {
         PRINTF("DEBUG: Edge end point 1 (%s) and ConnectedNodes array lenght mismatch\n", name_rcid_1str->str);
         g_assert(0);
         return FALSE;
     }
     //S57_geo *node_1 =  (S57_geo *)g_ptr_array_index(_crntCell->ConnectedNodes, (name_rcid_1 - _crntCell->baseRCID));
-    S57_geo *node_1 =  (S57_geo *)g_ptr_array_index(_ConnectedNodes, (name_rcid_1 - _baseRCID));
+    S57_geo *node_1 =  (S57_geo *)g_ptr_array_index(eb->ConnectedNodes, (name_rcid_1 - eb->baseRCID));
     if (NULL == node_1) {
         // if we land here it meen that there no ConnectedNodes at this index
         // ptr_array has hold (NULL) because of S57 update
@@ -2168,35 +2786,54 @@ static int        _loadS57ConnectedNode(const char *name, void *ConnectedNode)
             return FALSE;
         }
 
+        _edgeBuf *eb = _getEdgeBuf();
+
         //if (0 == _crntCell->baseRCID) {
         //    _crntCell->baseRCID = rcid;
-        if (0 == _baseRCID) {
-            _baseRCID = rcid;
+        if (0 == eb->baseRCID) {
+            eb->baseRCID = rcid;
         }
 
         // add to this cell (crntCell)
         //if (NULL == _crntCell->ConnectedNodes) {
         //    _crntCell->ConnectedNodes = g_ptr_array_new();
-        if (NULL == _ConnectedNodes) {
-            _ConnectedNodes = g_ptr_array_new();
+        if (NULL == eb->ConnectedNodes) {
+            eb->ConnectedNodes = g_ptr_array_new();
         }
 
         // set_size is over grown - should be  'rcid - _crntCell->baseRCID + 1'
         //if (rcid > _crntCell->ConnectedNodes->len) {
         //    g_ptr_array_set_size(_crntCell->ConnectedNodes, rcid);
-        if (rcid > _ConnectedNodes->len) {
-            g_ptr_array_set_size(_ConnectedNodes, rcid);
+        if (rcid > eb->ConnectedNodes->len) {
+            g_ptr_array_set_size(eb->ConnectedNodes, rcid);
             //g_assert(0);
         }
 
         //_crntCell->ConnectedNodes->pdata[rcid - _crntCell->baseRCID] = geo;
-        _ConnectedNodes->pdata[rcid - _baseRCID] = geo;
+        eb->ConnectedNodes->pdata[rcid - eb->baseRCID] = geo;
     }
 
     return TRUE;
 }
 #endif  // S52_USE_SUPP_LINE_OVERLAP
 
+static int        _addS57Class(_cell *c, const char *name)
+// append S57 class name to the list of this cell (once)
+// Note: geo of a class come in a row (OGR layer / SENC), so only the last name is checked
+{
+    const gchar *last = strrchr(c->S57ClassList->str, ',');
+    last = (NULL == last) ? c->S57ClassList->str : last + 1;
+    if (0 == g_strcmp0(last, name))
+        return FALSE;
+
+    if (0 != c->S57ClassList->len)
+        g_string_append(c->S57ClassList, ",");
+
+    g_string_append(c->S57ClassList, name);
+
+    return TRUE;
+}
+
 int            S52_loadLayer(const char *layername, void *layer, S52_loadObject_cb loadObject_cb)
 {
 #ifdef S52_USE_GV
@@ -2274,10 +2911,7 @@ int            S52_loadLayer(const char *layername, void *layer, S52_loadObject_
     }
 
     // save S57 class name
-    if (0 != _crntCell->S57ClassList->len)
-        g_string_append(_crntCell->S57ClassList, ",");
-
-    g_string_append(_crntCell->S57ClassList, layername);
+    _addS57Class(_crntCell, layername);
 
 
 #ifdef S52_USE_GV
@@ -2348,25 +2982,6 @@ static S52_obj   *_insertS57geo(_cell *c, S57_geo *geo)
     if (FALSE == _insertLightSec(c, obj)) {
         // insert normal object (ie not a light with sector)
         g_ptr_array_add(c->renderBin[disPrioIdx][obj_t], obj);
-
-        /* optimisation: recompute only CS that change due to new MarParam value
-        // save reference for quickly find CS to re-compute after a MarinerParameter change
-        // will replace the ugly APP() code that handle _doAPP_CS
-        const char *CSnm = S52_PL_hasCS(obj);
-        if (NULL != CSnm) {
-            if (0 == strncmp(CSnm, "DEPARE", 5)) g_ptr_array_add(c->DEPARElist, obj);
-            if (0 == strncmp(CSnm, "DEPCNT", 5)) g_ptr_array_add(c->DEPCNTlist, obj);
-            if (0 == strncmp(CSnm, "OBSTRN", 5)) g_ptr_array_add(c->OBSTRNlist, obj);
-            if (0 == strncmp(CSnm, "RESARE", 5)) g_ptr_array_add(c->RESARElist, obj);
-            if (0 == strncmp(CSnm, "WRECKS", 5)) g_ptr_array_add(c->WRECKSlist, obj);
-
-            // GPtrArray *DEPARE01L;  MP
-            // GPtrArray *DEPCNT02L;  MP, OP()
-            // GPtrArray *OBSTRN04L;  OP()
-            // GPtrArray *RESARE02L;  OP()
-            // GPtrArray *WRECKS02L;  OP()
-        }
-        */
     }
 
 #ifdef S52_USE_WORLD
@@ -2392,25 +3007,6 @@ static S52_obj   *_insertS52obj(_cell *c, S52_obj *obj)
     if (FALSE == _insertLightSec(c, obj)) {
         // insert normal object (ie not a light with sector)
         g_ptr_array_add(c->renderBin[disPrioIdx][obj_t], obj);
-
-        /* optimisation: recompute only CS that change due to new MarParam value
-        // save reference for quickly find CS to re-compute after a MarinerParameter change
-        // will replace the ugly APP() code that handle _doAPP_CS
-        const char *CSnm = S52_PL_hasCS(obj);
-        if (NULL != CSnm) {
-            if (0 == strncmp(CSnm, "DEPARE", 5)) g_ptr_array_add(c->DEPARElist, obj);
-            if (0 == strncmp(CSnm, "DEPCNT", 5)) g_ptr_array_add(c->DEPCNTlist, obj);
-            if (0 == strncmp(CSnm, "OBSTRN", 5)) g_ptr_array_add(c->OBSTRNlist, obj);
-            if (0 == strncmp(CSnm, "RESARE", 5)) g_ptr_array_add(c->RESARElist, obj);
-            if (0 == strncmp(CSnm, "WRECKS", 5)) g_ptr_array_add(c->WRECKSlist, obj);
-
-            // GPtrArray *DEPARE01L;  MP
-            // GPtrArray *DEPCNT02L;  MP, OP()
-            // GPtrArray *OBSTRN04L;  OP()
-            // GPtrArray *RESARE02L;  OP()
-            // GPtrArray *WRECKS02L;  OP()
-        }
-        */
     }
 
     return obj;
@@ -2441,6 +3037,26 @@ int            S52_loadObject(const char *objname, void *shape)
         return FALSE;
     }
 
+#ifdef S52_USE_SENC
+    if (NULL != _sencList)
+        g_ptr_array_add(_sencList, geo);
+#endif
+
+    return _loadS57geo(objname, geo);
+}
+
+static int        _loadS57geo(const char *objname, S57_geo *geo)
+// insert a new S57_geo (from OGR or SENC) in the current cell
+{
+    return __loadS57geo(objname, geo, TRUE);
+}
+
+static int        __loadS57geo(const char *objname, S57_geo *geo, int addCS)
+// addCS: FALSE if S52_CS_add() already done (worker)
+{
+    // SENC / async / parallel load don't go trough S52_loadLayer()
+    _addS57Class(_crntCell, objname);
+
     // set cell extent from each area object
     // Note: should be the same as CATALOG.03x
     if (S57__META_T != S57_getObjtype(geo)) {
@@ -2605,7 +3221,8 @@ int            S52_loadObject(const char *objname, void *shape)
 
     _insertS57geo(_crntCell, geo);
 
-    S52_CS_add(_crntCell->local, geo);
+    if (TRUE == addCS)
+        S52_CS_add(_crntCell->local, geo);
 
 #ifdef S52_USE_C_AGGR_C_ASSO
     //--------------------------------------------------
@@ -2913,6 +3530,20 @@ static int        _appSclbdU(GArray *sclbdyList, GArray *sclbdUList)
     return TRUE;
 }
 
+static int        _dirtyRBin(_cell *c, S52_disPrio prio, S52ObjectType obj_t)
+// rbin changed - rebuild spatial index at next cull, AC / LS batch at next draw
+{
+    c->rtree[prio][obj_t] = S52_RT_done(c->rtree[prio][obj_t]);
+
+    if (S52_AREAS == obj_t)
+        S52_GL_dirtyACBatch(c->ACbatch[prio]);
+
+    if (S52_LINES == obj_t)
+        S52_GL_dirtyLSBatch(c->LSbatch[prio]);
+
+    return TRUE;
+}
+
 static int        _appMoveObj(_cell *c, GPtrArray *tmpRenderBin)
 {
     for (guint idx=0; idx<tmpRenderBin->len; ++idx) {
@@ -2921,16 +3552,20 @@ static int        _appMoveObj(_cell *c, GPtrArray *tmpRenderBin)
         S52ObjectType obj_t = S52_PL_getFTYP(obj);
 
         g_ptr_array_add(c->renderBin[prio][obj_t], obj);
+
+        _dirtyRBin(c, prio, obj_t);
     }
     g_ptr_array_set_size(tmpRenderBin, 0);
 
     return TRUE;
 }
 
-static void       __findOPrioObj(GPtrArray *rbin)
+static guint      __findOPrioObj(GPtrArray *rbin)
 // find all obj that have prio override and move to _tmpRenderBin
+// return the number of obj moved
 {
-    guint idx = 0;
+    guint nMove = 0;
+    guint idx   = 0;
     while (idx<rbin->len) {
         S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx);
         if (TRUE == S52_PL_isPrioO(obj)) {
@@ -2942,14 +3577,225 @@ static void       __findOPrioObj(GPtrArray *rbin)
             rbin->pdata[rbin->len] = NULL;
 
             g_ptr_array_add(_tmpRenderBin, obj);
+            ++nMove;
         } else {
             ++idx;
         }
     }
 
+    return nMove;
+}
+
+static guint      __findMovedObj(GPtrArray *rbin, S52_disPrio prio)
+// move to _tmpRenderBin obj that are no longer on layer 'prio' - keep order of the other obj
+// return the number of obj moved
+{
+    guint nMove = 0;
+    guint nKeep = 0;
+    for (guint idx=0; idx<rbin->len; ++idx) {
+        S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx);
+        if (prio != S52_PL_getDPRI(obj)) {
+            g_ptr_array_add(_tmpRenderBin, obj);
+            ++nMove;
+        } else {
+            rbin->pdata[nKeep++] = obj;
+        }
+    }
+
+    // set_size() - sans free_func() code
+    for (guint idx=nKeep; idx<rbin->len; ++idx)
+        rbin->pdata[idx] = NULL;
+    rbin->len = nKeep;
+
+    return nMove;
+}
+
+static void       __addMPdep(S52_obj *obj, _cell *c)
+{
+    guint64 MPdep = S52_PL_getMPdep(obj);
+
+    for (guint p=0; (0!=MPdep) && (p<S52_MAR_NUM); ++p, MPdep>>=1) {
+        if (1 & MPdep) {
+            if (NULL == c->MPdep[p])
+                c->MPdep[p] = g_ptr_array_new();
+            g_ptr_array_add(c->MPdep[p], obj);
+        }
+    }
+
+    return;
+}
+
+static int        _buildMPdep(_cell *c)
+// (re)build the CS dependency index of this cell - after all CS are resolved
+{
+    if (_marinerCell == c)
+        return FALSE;
+
+    _doneMPdep(c);
+
+    TRAV_RBIN_ij(g_ptr_array_foreach(c->renderBin[i][j], (GFunc)__addMPdep, c));
+
+    return TRUE;
+}
+
+typedef struct _MPdepCtx {
+    guint64     MPmask;         // Mariners' Param that changed
+    GHashTable *done;           // obj allready resolved - NULL if only one param changed
+    gboolean    dirty[S52_PRIO_NUM][S52_N_OBJ];  // rbin that have obj that changed prio
+    gboolean    grow;           // a CS read a new param - rebuild index
+} _MPdepCtx;
+
+static void       __resolveMPdep(S52_obj *obj, _MPdepCtx *ctx)
+// re-resolve CS of obj if it read a Mariners' Param that changed
+{
+    guint64 MPdep = S52_PL_getMPdep(obj);
+    if (0 == (MPdep & ctx->MPmask))
+        return;
+
+    // obj in more than one list
+    if (NULL != ctx->done) {
+        if (NULL != g_hash_table_lookup(ctx->done, obj))
+            return;
+        g_hash_table_insert(ctx->done, obj, obj);
+    }
+
+    S52_disPrio prio = S52_PL_getDPRI(obj);
+
+    S52_PL_resolveSMB(obj, NULL);
+
+    // CS override prio (OP()) - obj must move to an other rbin
+    if (prio != S52_PL_getDPRI(obj))
+        ctx->dirty[prio][S52_PL_getFTYP(obj)] = TRUE;
+
+    // CS took a new code path - an other param was read
+    if (MPdep != S52_PL_getMPdep(obj))
+        ctx->grow = TRUE;
+
     return;
 }
 
+static int        _appMPdep(guint64 MPmask)
+// re-resolve only CS that read a Mariners' Param in MPmask (via the CS dependency index)
+// then move only obj that changed prio
+{
+    for (guint k=0; k<_cellList->len; ++k) {
+        _cell    *c   = (_cell*) g_ptr_array_index(_cellList, k);
+        _MPdepCtx ctx;
+
+        memset(&ctx, 0, sizeof(_MPdepCtx));
+        ctx.MPmask = MPmask;
+        // more than one bit
+        if (0 != (MPmask & (MPmask - 1)))
+            ctx.done = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+        if (_marinerCell == c) {
+            // not indexed - few obj
+            TRAV_RBIN_ij(g_ptr_array_foreach(c->renderBin[i][j], (GFunc)__resolveMPdep, &ctx));
+        } else {
+            for (guint p=0; p<S52_MAR_NUM; ++p) {
+                if ((NULL!=c->MPdep[p]) && (0!=(MPmask & S52_MP_BIT(p))))
+                    g_ptr_array_foreach(c->MPdep[p], (GFunc)__resolveMPdep, &ctx);
+            }
+        }
+
+        // rbin changed - rebuild spatial index at next cull
+        TRAV_RBIN_ij(if ((TRUE==ctx.dirty[i][j]) && (0<__findMovedObj(c->renderBin[i][j], i)))
+                         _dirtyRBin(c, i, j));
+
+        _appMoveObj(c, _tmpRenderBin);
+
+        if (TRUE == ctx.grow)
+            _buildMPdep(c);
+
+        if (NULL != ctx.done)
+            g_hash_table_destroy(ctx.done);
+    }
+
+    return TRUE;
+}
+
+#ifdef S52_RESOLVE_PARALLEL
+static gpointer   _resolveThread(_resolveCtx *ctx)
+// take the next chunk of obj until none left - a thread that finish early take more chunk
+// Note: CS output (GString) and _cmdWL are allocated by glib (thread-safe) and own by obj
+{
+    guint n   = ctx->objList->len;
+    guint beg = (guint) g_atomic_int_add(&ctx->next, RESOLVE_CHUNK);
+
+    while (beg < n) {
+        guint end = MIN(beg + RESOLVE_CHUNK, n);
+        for (guint idx=beg; idx<end; ++idx)
+            S52_PL_resolveSMB((S52_obj *)g_ptr_array_index(ctx->objList, idx), NULL);
+
+        beg = (guint) g_atomic_int_add(&ctx->next, RESOLVE_CHUNK);
+    }
+
+    return NULL;
+}
+
+static int        _resolveParallel(GPtrArray *objList)
+// resolve CS of all obj in objList on all core - the calling thread is one of the worker
+{
+    guint nThread = MIN(g_get_num_processors(), (objList->len / RESOLVE_CHUNK) + 1);
+
+    if (nThread < 2) {
+        g_ptr_array_foreach(objList, (GFunc)S52_PL_resolveSMB, NULL);
+        return TRUE;
+    }
+
+    _resolveCtx ctx     = {objList, 0};
+    GThread   **threads = g_new0(GThread *, nThread);
+    for (guint t=1; t<nThread; ++t)
+        threads[t] = g_thread_new("S52resolve", (GThreadFunc)_resolveThread, &ctx);
+
+    _resolveThread(&ctx);
+
+    for (guint t=1; t<nThread; ++t)
+        g_thread_join(threads[t]);
+    g_free(threads);
+
+    return TRUE;
+}
+
+static void       __splitResolve(S52_obj *obj, GPtrArray *objList[2])
+// LIGHTS05 write "_extend_arc_radius" in other LIGHTS (geoTouch) - keep them serial, in rbin order
+{
+    S57_geo *geo = S52_PL_getGeo(obj);
+
+    if (0 == g_strcmp0(S57_getName(geo), "LIGHTS"))
+        g_ptr_array_add(objList[0], obj);
+    else
+        g_ptr_array_add(objList[1], obj);
+
+    return;
+}
+
+static int        _resolveAll(void)
+// resolve CS of obj in all cell - objList[0]: serial, objList[1]: parallel
+{
+    GPtrArray *objList[2] = {g_ptr_array_new(), g_ptr_array_new()};
+
+    for (guint k=0; k<_cellList->len; ++k) {
+        _cell *c = (_cell*) g_ptr_array_index(_cellList, k);
+
+        // mariner obj can be set from other thread - few obj anyway
+        if (_marinerCell == c) {
+            TRAV_RBIN_ij(g_ptr_array_foreach(c->renderBin[i][j], (GFunc)S52_PL_resolveSMB, NULL));
+        } else {
+            TRAV_RBIN_ij(g_ptr_array_foreach(c->renderBin[i][j], (GFunc)__splitResolve, objList));
+        }
+    }
+
+    _resolveParallel(objList[1]);
+    g_ptr_array_foreach(objList[0], (GFunc)S52_PL_resolveSMB, NULL);
+
+    g_ptr_array_free(objList[0], TRUE);
+    g_ptr_array_free(objList[1], TRUE);
+
+    return TRUE;
+}
+#endif  // S52_RESOLVE_PARALLEL
+
 static S52ObjectHandle _delMarObj(S52ObjectHandle objH);  // forward decl
 static int        _app(void)
 // FIXME: doCSMar Mariner Only - time the cost of APP
@@ -2964,18 +3810,35 @@ static int        _app(void)
     if (TRUE == _APP_CS) {
         // 2.1 - reparse CS
         // FIXME: no need to check mariner cell if all mariner CS is in GL (S52_MP_get(S52_MAR_VECMRK))
+#ifdef S52_RESOLVE_PARALLEL
+        _resolveAll();
+#else
         ALL_C_TRAV_RBIN_ij(g_ptr_array_foreach(c->renderBin[i][j], (GFunc)S52_PL_resolveSMB, NULL));
+#endif
 
-        // 2.2 - move obj
+        // 2.2 - move obj - serial
         for (guint k=0; k<_cellList->len; ++k) {
             _cell *c = (_cell*) g_ptr_array_index(_cellList, k);
-            TRAV_RBIN_ij(__findOPrioObj(c->renderBin[i][j]));
+            // rbin reordered - rebuild spatial index at next cull
+            TRAV_RBIN_ij(if (0 < __findOPrioObj(c->renderBin[i][j]))
+                             _dirtyRBin(c, i, j));
 
             _appMoveObj(c, _tmpRenderBin);
+
+            // CS dependency index - used by the next Mariners' Param change
+            _buildMPdep(c);
         }
 
         // done rebuilding CS
-        _APP_CS = FALSE;
+        _APP_CS   = FALSE;
+        _APP_CSMP = 0;
+    }
+
+    // 2.4 - Mariners' Param changed - re-resolve only CS that depend on it
+    if (0 != _APP_CSMP) {
+        _appMPdep(_APP_CSMP);
+
+        _APP_CSMP = 0;
     }
 
 #if !defined(S52_USE_ANDROID)
@@ -3044,6 +3907,89 @@ static int        _resetJournal(void)
     return TRUE;
 }
 
+static S52_frameStats *_statsCrnt(void)
+{
+    if (FALSE == _statsOn)
+        return &_statsNull;
+
+    return &_stats[(_statsN + S52_STATS_NFRAME - 1) % S52_STATS_NFRAME];
+}
+
+static double     _statsLap(void)
+// msec since the previous lap - _timer is reset at the start of draw() / drawLast()
+{
+    double now = g_timer_elapsed(_timer, NULL) * 1000.0;
+    double ms  = now - _statsTick;
+    _statsTick = now;
+
+    return ms;
+}
+
+static void       _statsBeg(int last)
+// new frame - except for the drawLast() that follow a draw()
+{
+    if ((FALSE==last) || (FALSE==_statsDraw)) {
+        S52_frameStats *stats = &_stats[_statsN % S52_STATS_NFRAME];
+        memset(stats, 0, sizeof(S52_frameStats));
+        stats->frame = _statsN++;
+    }
+    _statsDraw = !last;
+    _statsTick = 0.0;
+    _statsOn   = TRUE;
+
+    S52_GL_getStat(&_statsGL);
+
+    S52_GL_beginGPUTimer(_statsCrnt()->frame);
+
+    return;
+}
+
+static void       _statsEnd(double *total_ms)
+{
+    S52_frameStats *stats = _statsCrnt();
+    S52_GL_stat     gl;
+
+    S52_GL_getStat(&gl);
+    stats->nObjDraw   += gl.nObj       - _statsGL.nObj;
+    stats->nCmd       += gl.nCmd       - _statsGL.nCmd;
+    stats->nDrawCall  += gl.nDrawCall  - _statsGL.nDrawCall;
+    stats->nVertex    += gl.nVertex    - _statsGL.nVertex;
+    stats->nVBO       += gl.nVBO       - _statsGL.nVBO;
+    stats->nTexUpload += gl.nTexUpload - _statsGL.nTexUpload;
+
+    *total_ms += g_timer_elapsed(_timer, NULL) * 1000.0;
+
+    _statsOn = FALSE;
+
+    // GPU time of frame done - land in an older frame
+    S52_GL_endGPUTimer();
+    S52_GL_gpuTimer gpu;
+    while (TRUE == S52_GL_getGPUTimer(&gpu)) {
+        S52_frameStats *old = &_stats[gpu.frame % S52_STATS_NFRAME];
+        if (gpu.frame != old->frame)
+            continue;  // out of the ring
+
+        old->gpu_ms += gpu.total_ms;
+        for (int i=0; i<S52_STATS_NPRIO; ++i)
+            old->gpuPrio_ms[i] += gpu.prio_ms[i];
+        for (int i=0; i<S52_STATS_NCMD; ++i)
+            old->gpuCmd_ms[i]  += gpu.cmd_ms[i];
+    }
+
+    return;
+}
+
+static void       _statsCullSupp(S52_obj *obj)
+// obj culled by S52_GL_isSupp() - split PLib/class suppression from SCAMIN
+{
+    if (S52_SUPP_ON == S52_PL_getObjSuppState(obj))
+        ++_statsCrnt()->nCullSupp;
+    else
+        ++_statsCrnt()->nCullScamin;
+
+    return;
+}
+
 static int        _cullLights(void)
 // CULL (first draw() after APP, on all cells)
 {
@@ -3083,13 +4029,52 @@ static int        _cullLights(void)
     return TRUE;
 }
 
-static int        _cullObj(_cell *c, GPtrArray *rbin)
+static int        _tileOn   = FALSE;  // TRUE: layer 0-8 drawn in tile (S52_GL_beginTiles())
+static int        _tileText = TRUE;   // FALSE: view rotated, text drawn over the tile composite
+static int        _tileHL   = FALSE;  // TRUE: highlighted obj left out of a tile (see _drawHazardTile())
+
+static int        _offHighlight(S57_geo *geo)
+// switch OFF highlight - tile rendered while ON miss this obj
+{
+    S57_setHighlight(geo, FALSE);
+
+    if (TRUE == _tileHL) {
+        S52_GL_delTiles();
+        _tileHL = FALSE;
+    }
+
+    return TRUE;
+}
+
+static int        _cullObj(_cell *c, GPtrArray *rbin, S52_RT **rtree, ObjExt_t *viewExt)
 //static int        _cullObj(S52_obj *obj, _cell *c)
 // cull object out side the view and object supressed
 // object culled are not inserted in the list of object to draw (journal)
+// rtree/viewExt NULL: no spatial index (ex: _marinerCell, anti-meridian)
 {
+    guint  nObj   = rbin->len;
+    guint *idxObj = NULL;
+
+    // range query - object outside 'viewExt' are not visited
+    // Note: same intersection test as S52_GL_isOFFview()
+    if (NULL!=rtree && NULL!=viewExt && RTREE_MINOBJ<=rbin->len) {
+        if (NULL == *rtree)
+            *rtree = S52_RT_new(rbin, (S52_RT_ext_cb)_getObjExt);
+
+        g_array_set_size(_rtreeIdx, 0);
+        nObj   = S52_RT_search(*rtree, *viewExt, _rtreeIdx);
+        idxObj = (guint *)_rtreeIdx->data;
+
+        // stat - object outside view
+        _nTotal += rbin->len - nObj;
+        _nCull  += rbin->len - nObj;
+        _statsCrnt()->nObjTotal += rbin->len - nObj;
+        _statsCrnt()->nCullView += rbin->len - nObj;
+    }
+
     // for each object
-    for (guint idx=0; idx<rbin->len; ++idx) {
+    for (guint n=0; n<nObj; ++n) {
+        guint    idx = (NULL == idxObj) ? n : idxObj[n];
         S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx);
 
         // debug: can this happen!
@@ -3102,6 +4087,7 @@ static int        _cullObj(_cell *c, GPtrArray *rbin)
         // FIXME: check _sclbdyList and _sclbdyLUidx and Mariner Param DISP_sclbdy_Union
 
         ++_nTotal;
+        ++_statsCrnt()->nObjTotal;
 
         // debug - anti-meridian, US5HA06M/US5HA06M.000
         //if (103 == S57_getS57ID(geo)) {
@@ -3130,12 +4116,14 @@ static int        _cullObj(_cell *c, GPtrArray *rbin)
         // is *this* object suppressed by user
         if (TRUE == S52_PL_getSupp(obj)) {
             ++_nCull;
+            ++_statsCrnt()->nCullSupp;
             continue;
         }
 
         // SCAMIN & PLib (disp cat) & S57 class
         if (TRUE == S52_GL_isSupp(obj)) {
             ++_nCull;
+            _statsCullSupp(obj);
             continue;
         }
 
@@ -3143,9 +4131,25 @@ static int        _cullObj(_cell *c, GPtrArray *rbin)
         // Note: object can be inside 'ext' but outside the 'view' (cursor pick)
         if (TRUE == S52_GL_isOFFview(obj)) {
             ++_nCull;
+            ++_statsCrnt()->nCullView;
             continue;
         }
 
+        //*
+        {   // switch OFF highlight if user acknowledge Alarm / Indication by
+            // resetting S52_MAR_GUARDZONE_ALARM to 0 (OFF - no alarm)
+            S57_geo *geo = S52_PL_getGeo(obj);
+            if (0.0==S52_MP_get(S52_MAR_GUARDZONE_ALARM) && TRUE==S57_getHighlight(geo))
+                _offHighlight(geo);
+
+            // highlight change with own-ship position - not in tile, see _drawHazardTile()
+            if ((TRUE==_tileOn) && (TRUE==S57_getHighlight(geo))) {
+                _tileHL = TRUE;
+                continue;
+            }
+        }
+        //*/
+
         // store object according to radar flags
         // Note: default to 'over' if something else than 'supp'
         if (S52_RAD_SUPP == S52_PL_getRPRI(obj)) {
@@ -3161,15 +4165,6 @@ static int        _cullObj(_cell *c, GPtrArray *rbin)
             //    S57_setHighlight(geo, FALSE);
         }
 
-        //*
-        {   // switch OFF highlight if user acknowledge Alarm / Indication by
-            // resetting S52_MAR_GUARDZONE_ALARM to 0 (OFF - no alarm)
-            S57_geo *geo = S52_PL_getGeo(obj);
-            if (0.0==S52_MP_get(S52_MAR_GUARDZONE_ALARM) && TRUE==S57_getHighlight(geo))
-                S57_setHighlight(geo, FALSE);
-        }
-        //*/
-
         // if this object has TX or TE, draw text last (on top)
         if (TRUE == S52_PL_hasText(obj)) {
             g_ptr_array_add(c->textList, obj);
@@ -3184,6 +4179,21 @@ static int        _cullLayer(_cell *c)
 // one cell, cull object outside the view and object supressed
 // object culled are not inserted in the list of object to draw (journal)
 {
+    // view extent for R-tree range query
+    ObjExt_t  viewExt;
+    ObjExt_t *pViewExt = NULL;
+    double LLv, LLu, URv, URu;
+    if (TRUE == S52_GL_getGEOView(&LLv, &LLu, &URv, &URu)) {
+        // anti-meridian - fall back to linear scan
+        if (LLu <= URu) {
+            viewExt.W = LLu;
+            viewExt.S = LLv;
+            viewExt.E = URu;
+            viewExt.N = URv;
+            pViewExt  = &viewExt;
+        }
+    }
+
     // layer 0-8
     for (S52_disPrio i=S52_PRIO_NODATA; i<S52_PRIO_MARINR; ++i) {
     // FIXME: Chart No 1 put object on layer 9 (Mariners' Objects)
@@ -3191,14 +4201,17 @@ static int        _cullLayer(_cell *c)
         for (S52ObjectType j=S52__META; j<S52_N_OBJ; ++j) {
 
             GPtrArray *c_rbin = c->renderBin[i][j];
-            _cullObj(c, c_rbin);
+            _cullObj(c, c_rbin, &c->rtree[i][j], pViewExt);
 
             //_cullObj(c_rbin, c);
             //foreach(c->renderBin[i][j], _cullObj, c);
 
 
-            GPtrArray *m_rbin = _marinerCell->renderBin[i][j];
-            _cullObj(c, m_rbin);
+            // mariner obj can change at any time - not in tile, see _drawMarObjTile()
+            if (FALSE == _tileOn) {
+                GPtrArray *m_rbin = _marinerCell->renderBin[i][j];
+                _cullObj(c, m_rbin, NULL, NULL);
+            }
 
             //_cullObj(m_rbin, c);
             //foreach(_marinerCell->renderBin[i][j], _cullObj, c);
@@ -3571,6 +4584,72 @@ static int        _drawLegend(void)
     return TRUE;
 }
 
+static int        _drawJournal(_cell *c, GPtrArray *journal)
+// draw obj of the journal - AC of consecutive AREAS obj of this cell in one go (see S52_GL_drawACBatch())
+// likewise for LS of consecutive LINES obj (see S52_GL_drawLSBatch())
+// and SY of consecutive POINT obj of the same prio once per symbol (see S52_GL_beginSYInst())
+{
+    S52_disPrio SYprio    = S52_PRIO_NUM;  // S52_PRIO_NUM: no SY run
+    S52_disPrio statsPrio = S52_PRIO_NUM;  // display priority timed
+
+    _statsLap();
+
+    for (guint i=0; i<journal->len; ) {
+        S52_obj      *obj  = (S52_obj *)g_ptr_array_index(journal, i);
+        S52ObjectType ftyp = S52_PL_getFTYP(obj);
+        S52_disPrio   prio = S52_PL_getDPRI(obj);
+
+        // end of SY run - keep display priority order
+        if ((S52_PRIO_NUM!=SYprio) && ((S52_POINT!=ftyp) || (prio!=SYprio))) {
+            S52_GL_endSYInst();
+            SYprio = S52_PRIO_NUM;
+        }
+
+        // frame stats - journal is in display priority order
+        if (prio != statsPrio) {
+            if (S52_PRIO_NUM != statsPrio)
+                _statsCrnt()->prio_ms[statsPrio] += _statsLap();
+            statsPrio = prio;
+        }
+
+        if ((S52_POINT==ftyp) && (S52_PRIO_NUM==SYprio) && (TRUE==S52_GL_beginSYInst()))
+            SYprio = prio;
+
+        if (S52_AREAS == ftyp) {
+            if (NULL == c->ACbatch[prio])
+                c->ACbatch[prio] = S52_GL_newACBatch(c->renderBin[prio][S52_AREAS]);
+
+            guint n = S52_GL_drawACBatch(c->ACbatch[prio], (S52_obj **)journal->pdata + i, journal->len - i);
+            if (0 < n) {
+                i += n;
+                continue;
+            }
+        }
+
+        if (S52_LINES == ftyp) {
+            if (NULL == c->LSbatch[prio])
+                c->LSbatch[prio] = S52_GL_newLSBatch(c->renderBin[prio][S52_LINES]);
+
+            guint n = S52_GL_drawLSBatch(c->LSbatch[prio], (S52_obj **)journal->pdata + i, journal->len - i);
+            if (0 < n) {
+                i += n;
+                continue;
+            }
+        }
+
+        S52_GL_draw(obj, NULL);
+        ++i;
+    }
+
+    if (S52_PRIO_NUM != SYprio)
+        S52_GL_endSYInst();
+
+    if (S52_PRIO_NUM != statsPrio)
+        _statsCrnt()->prio_ms[statsPrio] += _statsLap();
+
+    return TRUE;
+}
+
 static int        _draw(void)
 // draw object inside view
 // then draw object's text
@@ -3624,28 +4703,151 @@ static int        _draw(void)
             //*/
         }
 
-        // draw under radar
-        g_ptr_array_foreach(c->objList_supp, (GFunc)S52_GL_draw, NULL);
+        // draw under radar
+        _drawJournal(c, c->objList_supp);
+
+        // USE_RASTER/RADAR
+#if defined(S52_USE_GL2)    || defined(S52_USE_GLES2)
+#if defined(S52_USE_RASTER) || defined(S52_USE_RADAR)
+        // draw radar / raster
+        // Note: no raster in MARINER_CELL (i==1, cell idx 0)
+        if ((1.0==S52_MP_get(S52_MAR_DISP_RADAR_LAYER)) && (1!=i)) {
+            _drawRaster();
+        }
+#endif
+#endif
+        // draw over radar
+        _drawJournal(c, c->objList_over);
+
+        // end scissor test
+        S52_GL_setScissor(0, 0, -1, -1);
+
+        // text over the tile composite (see _drawTextTile())
+        if ((TRUE==_tileOn) && (FALSE==_tileText))
+            continue;
+
+        // draw text - one batch per cell, in cell draw order (text of a cell
+        // is not drawn over the upper cell that cover it)
+        _statsLap();
+        S52_GL_beginTextBatch();
+        g_ptr_array_foreach(c->textList,     (GFunc)S52_GL_drawText, NULL);
+        S52_GL_endTextBatch();
+        _statsCrnt()->text_ms += _statsLap();
+    }
+
+    return TRUE;
+}
+
+static int        _drawView(ObjExt_t ext)
+// cull and draw layer 0-8 of cells in ext
+{
+    _statsLap();
+
+    _cull(ext);
+
+    _statsCrnt()->cull_ms += _statsLap();
+
+    _cullLights();
+
+    _statsCrnt()->cullLights_ms += _statsLap();
+
+    //PRINTF("S52_draw() .. -1.3-\n");
+
+    //////////////////////////////////////////////
+    // DRAW: .. render
+
+    if (TRUE == (int) S52_MP_get(S52_MAR_DISP_OVERLAP)) {
+        // debug
+        for (S52_disPrio layer=S52_PRIO_NODATA; layer<S52_PRIO_NUM; ++layer) {
+            _statsLap();
+            _drawLayer(ext, layer);
+            _statsCrnt()->prio_ms[layer] += _statsLap();
+
+            // draw all lights (of all cells) outside ext
+            if (S52_PRIO_HAZRDS == layer) {
+                for (guint i=_cellList->len-1; i>0; --i) {
+                    _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
+                    g_ptr_array_foreach(c->lights_sector, (GFunc)_drawLights, NULL);
+                }
+                //_drawLights();
+            }
+        }
+        //_drawText();
+    } else {
+        _draw();
+
+        // complete leg extend from lights outside view
+        for (guint i=_cellList->len-1; i>0; --i) {
+            _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
+            g_ptr_array_foreach(c->lights_sector, (GFunc)_drawLights, NULL);
+        }
+        //_drawLights();
+    }
+
+    return TRUE;
+}
+
+static int        _drawTextTile(ObjExt_t ext)
+// text of layer 0-8 over the tile composite of a rotated view - text is screen upright
+// Note: cull of the whole view, _tileOn keep mariner obj out (see _drawMarObjTile())
+{
+    _statsLap();
+    _cull(ext);
+    _statsCrnt()->cull_ms += _statsLap();
+
+    for (guint i=_cellList->len-1; i>0; --i) {
+        _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
 
-        // USE_RASTER/RADAR
-#if defined(S52_USE_GL2)    || defined(S52_USE_GLES2)
-#if defined(S52_USE_RASTER) || defined(S52_USE_RADAR)
-        // draw radar / raster
-        // Note: no raster in MARINER_CELL (i==1, cell idx 0)
-        if ((1.0==S52_MP_get(S52_MAR_DISP_RADAR_LAYER)) && (1!=i)) {
-            _drawRaster();
-        }
-#endif
-#endif
-        // draw over radar
-        g_ptr_array_foreach(c->objList_over, (GFunc)S52_GL_draw, NULL);
+        S52_GL_beginTextBatch();
+        g_ptr_array_foreach(c->textList, (GFunc)S52_GL_drawText, NULL);
+        S52_GL_endTextBatch();
+    }
+    _statsCrnt()->text_ms += _statsLap();
 
-        // end scissor test
-        S52_GL_setScissor(0, 0, -1, -1);
+    return TRUE;
+}
 
-        // draw text
-        g_ptr_array_foreach(c->textList,     (GFunc)S52_GL_drawText, NULL);
+static int        _drawHazardTile(void)
+// hazard highlighted by S52_checkHazard() over the tile composite
+// Note: not in tile since highlight change with own-ship position (see _cullObj())
+{
+    GHashTableIter iter;
+    gpointer       geo;
+    gpointer       obj;
+
+    S52_GL_beginTextBatch();
+    g_hash_table_iter_init(&iter, _hazardSet);
+    while (TRUE == g_hash_table_iter_next(&iter, &geo, &obj)) {
+        // acknowledged - see _cullObj()
+        if (0.0==S52_MP_get(S52_MAR_GUARDZONE_ALARM) && TRUE==S57_getHighlight((S57_geo *)geo))
+            _offHighlight((S57_geo *)geo);
+
+        if (FALSE == S57_getHighlight((S57_geo *)geo))
+            continue;
+
+        if ((TRUE==S52_PL_getSupp((S52_obj *)obj)) || (TRUE==S52_GL_isSupp((S52_obj *)obj)) || (TRUE==S52_GL_isOFFview((S52_obj *)obj)))
+            continue;
+
+        S52_GL_draw    ((S52_obj *)obj, NULL);
+        S52_GL_drawText((S52_obj *)obj, NULL);
+    }
+    S52_GL_endTextBatch();
+
+    return TRUE;
+}
+
+static int        _drawLast(GPtrArray *rbin, double *rect);  // forward decl
+static int        _drawMarObjTile(void)
+// mariner obj of layer 0-8 over the tile composite - as layer 9 (see _drawLast())
+// Note: not in tile since they can move / change at any time (S52_pushPosition(), ..)
+{
+    S52_GL_beginTextBatch();
+    for (S52_disPrio i=S52_PRIO_NODATA; i<S52_PRIO_MARINR; ++i) {
+        for (S52ObjectType j=S52__META; j<S52_N_OBJ; ++j) {
+            _drawLast(_marinerCell->renderBin[i][j], NULL);
+        }
     }
+    S52_GL_endTextBatch();
 
     return TRUE;
 }
@@ -3680,6 +4882,7 @@ DLL int    STD S52_draw(void)
         goto exit;
 
     g_timer_reset(_timer);
+    _statsBeg(FALSE);
 
     // debug
     //PRINTF("DRAW: start ..\n");
@@ -3690,7 +4893,9 @@ DLL int    STD S52_draw(void)
 
         //////////////////////////////////////////////
         // APP:  .. update object
+        _statsLap();
         _app();
+        _statsCrnt()->app_ms += _statsLap();
 
         //////////////////////////////////////////////
         // CULL: .. supress display of object (eg outside view)
@@ -3726,52 +4931,49 @@ DLL int    STD S52_draw(void)
         //    ext.W = ext.W - 360.0;
         //}
 
-        _cull(ext);
-
-        _cullLights();
+        // layer 0-8 - from tile cache when available
+        if (TRUE == S52_GL_beginTiles()) {
+            ObjExt_t text;
+            _tileOn   = TRUE;
+            _tileText = S52_GL_isTileText();
+            while (TRUE == S52_GL_beginTile(&text.S, &text.W, &text.N, &text.E)) {
+                _drawView(text);
+                S52_GL_endTile();
+            }
+            S52_GL_drawTiles();
 
-        //PRINTF("S52_draw() .. -1.3-\n");
+            if (FALSE == _tileText)
+                _drawTextTile(ext);
+            _tileOn   = FALSE;
+            _tileText = TRUE;
 
-        //////////////////////////////////////////////
-        // DRAW: .. render
+            _drawHazardTile();
 
-        if (TRUE == (int) S52_MP_get(S52_MAR_DISP_OVERLAP)) {
-            // debug
-            for (S52_disPrio layer=S52_PRIO_NODATA; layer<S52_PRIO_NUM; ++layer) {
-                _drawLayer(ext, layer);
-
-                // draw all lights (of all cells) outside ext
-                if (S52_PRIO_HAZRDS == layer) {
-                    for (guint i=_cellList->len-1; i>0; --i) {
-                        _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
-                        g_ptr_array_foreach(c->lights_sector, (GFunc)_drawLights, NULL);
-                    }
-                    //_drawLights();
-                }
-            }
-            //_drawText();
+            _drawMarObjTile();
         } else {
-            _draw();
-
-            // complete leg extend from lights outside view
-            for (guint i=_cellList->len-1; i>0; --i) {
-                _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
-                g_ptr_array_foreach(c->lights_sector, (GFunc)_drawLights, NULL);
-            }
-            //_drawLights();
+            _drawView(ext);
         }
 
         //PRINTF("S52_draw() .. -1.4-\n");
 
         // draw graticule and scale
+        _statsLap();
         if (FALSE != (int) S52_MP_get(S52_MAR_DISP_GRATICULE))
             S52_GL_drawGraticule();
+        _statsCrnt()->grat_ms += _statsLap();
 
         // draw legend
         if (TRUE == (int) S52_MP_get(S52_MAR_DISP_LEGEND))
             _drawLegend();
+        _statsCrnt()->legend_ms += _statsLap();
 
         ret = S52_GL_end(S52_GL_DRAW);
+        _statsCrnt()->glend_ms += _statsLap();
+
+        _statsEnd(&_statsCrnt()->draw_ms);
+
+        // new FB - redraw all of layer 9
+        _DRAW_lastAll = TRUE;
 
         // for each cell, not after all cell,
         // because city name appear twice
@@ -3786,6 +4988,8 @@ DLL int    STD S52_draw(void)
 
     } else {
         PRINTF("WARNING:S52_GL_begin() failed\n");
+        _statsOn = FALSE;
+        S52_GL_endGPUTimer();
 
         // FIXME: tell EGL to reset context
         //EGL_END(RESET);
@@ -3838,8 +5042,141 @@ static void       _delOldVessel(gpointer data, gpointer user_data)
     return;
 }
 
-static int        _drawLast(GPtrArray *rbin)
-// draw the Mariners' Object (layer 9)
+static void       _setDirtyLast(S52_obj *obj)
+// obj of layer 9 changed - redraw its old and new extent at the next drawLast()
+{
+    if (NULL != _lastDirty)
+        g_hash_table_insert(_lastDirty, obj, obj);
+
+    return;
+}
+
+static int        _isRectOver(double *a, double *b)
+{
+    return (a[2]<b[0] || b[2]<a[0] || a[3]<b[1] || b[3]<a[1]) ? FALSE : TRUE;
+}
+
+static void       _addDirtyRect(double *rect, int w, int h)
+// clip rect to the view, merge with a rect it overlap, else the rect that grow the less
+{
+    double r[4] = {MAX(rect[0], 0.0), MAX(rect[1], 0.0), MIN(rect[2], w), MIN(rect[3], h)};
+    if (r[0]>=r[2] || r[1]>=r[3])
+        return;
+
+    guint  best = 0;
+    double grow = INFINITY;
+    for (guint i=0; i<_nDirtyRect; ++i) {
+        double *d = _dirtyRect[i];
+        if (TRUE == _isRectOver(d, r)) {
+            best = i;
+            grow = 0.0;
+            break;
+        }
+        double g = (MAX(d[2], r[2]) - MIN(d[0], r[0])) * (MAX(d[3], r[3]) - MIN(d[1], r[1])) -
+                   (d[2]-d[0]) * (d[3]-d[1]);
+        if (g < grow) {
+            best = i;
+            grow = g;
+        }
+    }
+
+    if (0.0!=grow && _nDirtyRect<DIRTY_MAX) {
+        double *d = _dirtyRect[_nDirtyRect++];
+        d[0] = r[0]; d[1] = r[1]; d[2] = r[2]; d[3] = r[3];
+        return;
+    }
+
+    double *d = _dirtyRect[best];
+    d[0] = MIN(d[0], r[0]);
+    d[1] = MIN(d[1], r[1]);
+    d[2] = MAX(d[2], r[2]);
+    d[3] = MAX(d[3], r[3]);
+
+    return;
+}
+
+static int        _dirtyLast(void)
+// set _dirtyRect: old and new extent of obj of layer 9 changed since the previous call
+// and old extent of obj gone (deleted, supp, ..) - obj extent saved for _drawLast()
+// return TRUE if all the view need redraw
+{
+    int full = _DRAW_lastAll;
+    _DRAW_lastAll = FALSE;
+    _nDirtyRect   = 0;
+    ++_lastStamp;
+
+    // no offscreen FB - FB of draw() restored on the whole view
+    if (FALSE == S52_GL_hasLastFBO())
+        full = TRUE;
+
+    int x, y, w, h;
+    S52_GL_getViewPort(&x, &y, &w, &h);
+    double view[4] = {0.0, 0.0, w, h};
+
+    for (S52ObjectType j=S52__META; j<S52_N_OBJ; ++j) {
+        GPtrArray *rbin = _marinerCell->renderBin[S52_PRIO_MARINR][j];
+        for (guint idx=0; idx<rbin->len; ++idx) {
+            S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx);
+            if (NULL == obj)
+                continue;
+
+            double  rect[4] = {INFINITY, INFINITY, -INFINITY, -INFINITY};  // not drawn
+            double *old     = (double *)g_hash_table_lookup(_lastRect, obj);
+            int     dirty   = (NULL==old) || (NULL!=g_hash_table_lookup(_lastDirty, obj));
+
+            // same filter as _drawLast()
+            if ((FALSE==S52_PL_getSupp(obj)) && (FALSE==S52_GL_isOFFview(obj)) && (FALSE==S52_GL_isSupp(obj))) {
+                if (FALSE == S52_GL_getLastRect(obj, rect)) {
+                    memcpy(rect, view, sizeof(rect));
+                    if (TRUE == dirty)
+                        full = TRUE;
+                }
+            }
+
+            if (NULL == old) {
+                old = g_new(double, 5);
+                memcpy(old, rect, sizeof(rect));
+                g_hash_table_insert(_lastRect, obj, old);
+            }
+
+            if ((TRUE==dirty) && (FALSE==full)) {
+                _addDirtyRect(old,  w, h);
+                _addDirtyRect(rect, w, h);
+            }
+
+            memcpy(old, rect, sizeof(rect));
+            old[4] = _lastStamp;
+        }
+    }
+
+    // obj gone
+    GHashTableIter iter;
+    gpointer       key;
+    gpointer       val;
+    g_hash_table_iter_init(&iter, _lastRect);
+    while (TRUE == g_hash_table_iter_next(&iter, &key, &val)) {
+        double *old = (double *)val;
+        if (_lastStamp != (guint)old[4]) {
+            if (FALSE == full)
+                _addDirtyRect(old, w, h);
+            g_hash_table_iter_remove(&iter);
+        }
+    }
+
+    g_hash_table_remove_all(_lastDirty);
+
+    if (TRUE == full)
+        return TRUE;
+
+    double area = 0.0;
+    for (guint i=0; i<_nDirtyRect; ++i)
+        area += (_dirtyRect[i][2] - _dirtyRect[i][0]) * (_dirtyRect[i][3] - _dirtyRect[i][1]);
+
+    return (area > DIRTY_FULL * w * h) ? TRUE : FALSE;
+}
+
+static int        _drawLast(GPtrArray *rbin, double *rect)
+// draw the Mariners' Object (layer 9) - rect: only obj over this dirty rect (NULL: all)
 {
     //for (S52ObjectType i=S52_AREAS; i<S52_N_OBJ; ++i) {
     // Note: mariner's obj allow for META
@@ -3875,6 +5212,7 @@ static int        _drawLast(GPtrArray *rbin)
             // CULL & DRAW
             //
             ++_nTotal;
+            ++_statsCrnt()->nObjTotal;
 
             // FIXME: use by PRINTF() - move inside
             //S57_geo *geo = S52_PL_getGeo(obj);
@@ -3882,6 +5220,7 @@ static int        _drawLast(GPtrArray *rbin)
             // is this object suppressed by user
             if (TRUE == S52_PL_getSupp(obj)) {
                 ++_nCull;
+                ++_statsCrnt()->nCullSupp;
 
                 //PRINTF("DEBUG:%i: supp ON - %s\n", _nTotal, S57_getName(geo));
 
@@ -3892,12 +5231,23 @@ static int        _drawLast(GPtrArray *rbin)
             // Note: object can be inside 'ext' but outside the 'view' (cursor pick)
             if (TRUE == S52_GL_isOFFview(obj)) {
                 ++_nCull;
+                ++_statsCrnt()->nCullView;
 
                 //PRINTF("DEBUG:%i: OFF view - %s\n", _nTotal, S57_getName(geo));
 
                 continue;
             }
 
+            // outside dirty rect - extent set by _dirtyLast()
+            if (NULL != rect) {
+                double *objRect = (double *)g_hash_table_lookup(_lastRect, obj);
+                if ((NULL!=objRect) && (FALSE==_isRectOver(objRect, rect))) {
+                    ++_nCull;
+                    ++_statsCrnt()->nCullView;
+                    continue;
+                }
+            }
+
             {   // switch OFF highlight if user acknowledge Alarm / Indication by
                 // resetting S52_MAR_GUARDZONE_ALARM to 0 (OFF - no alarm)
                 S57_geo *geo = S52_PL_getGeo(obj);
@@ -3913,6 +5263,7 @@ static int        _drawLast(GPtrArray *rbin)
                 //PRINTF("DEBUG:%i: _drawLast() - %s\n", _nTotal, S52_PL_getOBCL(obj));
             } else {
                 ++_nCull;
+                _statsCullSupp(obj);
 
                 //PRINTF("DEBUG:%i: SCAMIN - %s\n", _nTotal, S57_getName(geo));
 
@@ -3961,6 +5312,7 @@ DLL int    STD S52_drawLast(void)
         goto exit;
 
     g_timer_reset(_timer);
+    _statsBeg(TRUE);
 
 #ifdef S52_USE_BACKTRACE
     // debug
@@ -3989,13 +5341,42 @@ DLL int    STD S52_drawLast(void)
 
         // Mariners' (layer 9 - Last)
         ret = TRUE;
-        for (S52ObjectType j=S52__META; j<S52_N_OBJ; ++j) {
-            ret = ret && _drawLast(_marinerCell->renderBin[S52_PRIO_MARINR][j]);
+        _statsLap();
+        if (TRUE == _dirtyLast()) {
+            S52_GL_restoreLast(NULL);
+
+            S52_GL_beginTextBatch();
+            for (S52ObjectType j=S52__META; j<S52_N_OBJ; ++j) {
+                ret = ret && _drawLast(_marinerCell->renderBin[S52_PRIO_MARINR][j], NULL);
+            }
+            S52_GL_endTextBatch();
+        } else {
+            // only what is under the dirty rect
+            for (guint i=0; i<_nDirtyRect; ++i) {
+                double *rect = _dirtyRect[i];
+                if (FALSE == S52_GL_restoreLast(rect))
+                    rect = NULL;  // whole view restored
+
+                S52_GL_beginTextBatch();
+                for (S52ObjectType j=S52__META; j<S52_N_OBJ; ++j) {
+                    ret = ret && _drawLast(_marinerCell->renderBin[S52_PRIO_MARINR][j], rect);
+                }
+                S52_GL_endTextBatch();
+
+                if (NULL == rect)
+                    break;
+            }
         }
+        _statsCrnt()->prio_ms[S52_PRIO_MARINR] += _statsLap();
 
         S52_GL_end(S52_GL_LAST);
+        _statsCrnt()->glend_ms += _statsLap();
+
+        _statsEnd(&_statsCrnt()->last_ms);
     } else {
         PRINTF("WARNING: S52_GL_begin() failed\n");
+        _statsOn = FALSE;
+        S52_GL_endGPUTimer();
     }
 
 exit:
@@ -4093,30 +5474,27 @@ DLL int    STD S52_loadPLib(const char *plibName)
         TRAV_RBIN_ij(g_free(g_ptr_array_free(cell->renderBin[i][j], FALSE)));
         // replace new rbin in cell
         TRAV_RBIN_ij(cell->renderBin[i][j] = tmpCell.renderBin[i][j]);
-
-        /* optimisation: recompute only CS that change due to new MarParam value
-        // save reference for quickly find CS to re-compute after a MarinerParameter change
-        // will replace the ugly APP() code that handle _doAPP_CS
-        const char *CSnm = S52_PL_hasCS(obj);
-        if (NULL != CSnm) {
-            if (0 == strncmp(CSnm, "DEPARE", 5)) g_ptr_array_add(c->DEPARElist, obj);
-            if (0 == strncmp(CSnm, "DEPCNT", 5)) g_ptr_array_add(c->DEPCNTlist, obj);
-            if (0 == strncmp(CSnm, "OBSTRN", 5)) g_ptr_array_add(c->OBSTRNlist, obj);
-            if (0 == strncmp(CSnm, "RESARE", 5)) g_ptr_array_add(c->RESARElist, obj);
-            if (0 == strncmp(CSnm, "WRECKS", 5)) g_ptr_array_add(c->WRECKSlist, obj);
-
-            // GPtrArray *DEPARE01L;  MP
-            // GPtrArray *DEPCNT02L;  MP, OP()
-            // GPtrArray *OBSTRN04L;  OP()
-            // GPtrArray *RESARE02L;  OP()
-            // GPtrArray *WRECKS02L;  OP()
+        // new rbin - new spatial index
+        _buildRTree(cell);
+        // new rbin - AC / LS batch rebuilt at next draw
+        for (guint i=0; i<S52_PRIO_NUM; ++i) {
+            cell->ACbatch[i] = S52_GL_doneACBatch(cell->ACbatch[i]);
+            cell->LSbatch[i] = S52_GL_doneLSBatch(cell->LSbatch[i]);
         }
-        */
+        // new obj - CS dependency index rebuilt at next _app()
+        _doneMPdep(cell);
     }
 
     // signal to rebuild all cmd
     _APP_CS = TRUE;
 
+    // GL cache keyed by the old rules
+    S52_GL_newPLib();
+
+    // new rules - tile and layer 9 redrawn
+    S52_GL_delTiles();
+    _DRAW_lastAll = TRUE;
+
     ret = TRUE;
 
 exit:
@@ -4724,6 +6102,9 @@ DLL int    STD S52_setS57ObjClassSupp(const char *className, int value)
 
     ret = S52_PL_toggleObjClass(className);
 
+    S52_GL_delTiles();
+    _DRAW_lastAll = TRUE;
+
 exit:
 
     GMUTEXUNLOCK(&_mp_mutex);
@@ -4740,6 +6121,73 @@ exit:
 // FEEDBACK TO HIGHER UP MODULE OF INTERNAL STATE
 //
 
+#define PIXELS_WH 8   // pick extent (pixel)
+
+static CCHAR     *_pickAtCPU(double pixels_x, double pixels_y)
+// cull obj to the pick extent (R-tree), then exact test of each obj in draw order
+// Note: same stack and result as the GPU pick - no GL cycle, no glReadPixels()
+{
+    double gs,gw,gn,ge;   // hold GEO view
+    S52_GL_getGEOView(&gs, &gw, &gn, &ge);
+
+    // cursor
+    double x = pixels_x;
+    double y = pixels_y;
+    S52_GL_win2prj(&x, &y);
+
+    // pick extent
+    ObjExt_t ext;
+    ext.N = pixels_y + PIXELS_WH/2;
+    ext.S = pixels_y - PIXELS_WH/2;
+    ext.E = pixels_x + PIXELS_WH/2;
+    ext.W = pixels_x - PIXELS_WH/2;
+    S52_GL_win2prj(&ext.W, &ext.S);
+    S52_GL_win2prj(&ext.E, &ext.N);
+
+    // extent prj --> geo
+    projUV uv = {ext.W, ext.S};
+    uv    = S57_prj2geo(uv);
+    ext.W = uv.u;
+    ext.S = uv.v;
+    uv.u  = ext.E;
+    uv.v  = ext.N;
+    uv    = S57_prj2geo(uv);
+    ext.E = uv.u;
+    ext.N = uv.v;
+    S52_GL_setGEOView(ext.S, ext.W, ext.N, ext.E);
+
+    _nTotal = 0;
+    _nCull  = 0;
+
+    // filter out objects that don't intersect the pick extent
+    _cull(ext);
+
+    S52_GL_beginPick(x, y, PIXELS_WH/2);
+
+    // same order as _draw()
+    for (guint i=_cellList->len-1; i>0; --i) {
+        _cell *c = (_cell*) g_ptr_array_index(_cellList, i);
+        g_ptr_array_foreach(c->objList_supp, (GFunc)S52_GL_pickObj, NULL);
+        g_ptr_array_foreach(c->objList_over, (GFunc)S52_GL_pickObj, NULL);
+    }
+
+    // Mariners' (layer 9 - Last) - same filter and order as _drawLast()
+    for (S52ObjectType j=S52__META; j<S52_N_OBJ; ++j) {
+        GPtrArray *rbin = _marinerCell->renderBin[S52_PRIO_MARINR][j];
+        for (guint idx=rbin->len; idx>0; --idx) {
+            S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx-1);
+            if ((NULL==obj) || (TRUE==S52_PL_getSupp(obj)) || (TRUE==S52_GL_isOFFview(obj)) || (TRUE==S52_GL_isSupp(obj)))
+                continue;
+
+            S52_GL_pickObj(obj);
+        }
+    }
+
+    S52_GL_setGEOView(gs, gw, gn, ge);
+
+    return S52_GL_getNameObjPick();
+}
+
 DLL CCHAR *STD S52_pickAt(double pixels_x, double pixels_y)
 {
     static const char *name = NULL;
@@ -4769,6 +6217,13 @@ DLL CCHAR *STD S52_pickAt(double pixels_x, double pixels_y)
         goto exit;
     }
 
+    // GPU pick (colour ID) only as a fallback
+    if (FALSE == (int) S52_MP_get(S52_MAR_DISP_CRSR_PICK_GPU)) {
+        g_timer_reset(_timer);
+        name = _pickAtCPU(pixels_x, pixels_y);
+        goto exit;
+    }
+
     // debug - this kludge work, why?
     //pixels_x -= 4;
     //pixels_y -= 4;
@@ -4789,7 +6244,6 @@ DLL CCHAR *STD S52_pickAt(double pixels_x, double pixels_y)
 
     // --- compute pick view parameter -----------------------------
     // pick extent
-#define PIXELS_WH 8
     ObjExt_t ext;
     {
         //.N = pixels_y + 3,
@@ -4852,7 +6306,7 @@ DLL CCHAR *STD S52_pickAt(double pixels_x, double pixels_y)
 
         // Mariners' (layer 9 - Last)
         for (S52ObjectType j=S52__META; j<S52_N_OBJ; ++j) {
-            _drawLast(_marinerCell->renderBin[S52_PRIO_MARINR][j]);
+            _drawLast(_marinerCell->renderBin[S52_PRIO_MARINR][j], NULL);
         }
 
         S52_GL_setViewPort(x, y,  w,  h );
@@ -4892,6 +6346,186 @@ exit:
     return name;
 }
 
+// id of attribute read for each obj checked - interned once in _isHazard()
+static gsize       _hazardAttIDinit = 0;
+static S57_AttID   _hazardDRVAL1    = 0;
+static S57_AttID   _hazardVALSOU    = 0;
+
+static gboolean    _isHazard(S57_geo *geo, double safetyContour)
+// DEPARE/DRGARE shallower than safety contour, OBSTRN/WRECKS/UWTROC not known to be deeper
+{
+    if (g_once_init_enter(&_hazardAttIDinit)) {
+        _hazardDRVAL1 = S57_getAttID("DRVAL1");
+        _hazardVALSOU = S57_getAttID("VALSOU");
+        g_once_init_leave(&_hazardAttIDinit, 1);
+    }
+
+    const char *name = S57_getName(geo);
+    double      val  = -1.0;   // unknown depth - as CS DEPARE / UDWHAZ
+
+    if ((0==g_strcmp0("DEPARE", name)) || (0==g_strcmp0("DRGARE", name))) {
+        S57_getAttReal(geo, _hazardDRVAL1, &val);
+        return (val < safetyContour);
+    }
+
+    if ((0==g_strcmp0("OBSTRN", name)) || (0==g_strcmp0("WRECKS", name)) || (0==g_strcmp0("UWTROC", name))) {
+        S57_getAttReal(geo, _hazardVALSOU, &val);
+        return (val < safetyContour);
+    }
+
+    return FALSE;
+}
+
+static int        _checkHazardRing(ObjExt_t ext, guint npt, pt3 *ring, double safetyContour, GHashTable *found)
+// highlight hazard of all cells that touch the ring (projected) - ext: ring extent (deg)
+{
+    int nFound = 0;
+
+    // skip mariner
+    for (guint k=_cellList->len-1; k>0; --k) {
+        _cell *c = (_cell*) g_ptr_array_index(_cellList, k);
+        if ((FALSE==c->projDone) || (FALSE==_intersectCELL(c->geoExt, ext)))
+            continue;
+
+        for (S52_disPrio i=S52_PRIO_NODATA; i<S52_PRIO_NUM; ++i) {
+            for (S52ObjectType j=S52__META; j<S52_N_OBJ; ++j) {
+                GPtrArray *rbin   = c->renderBin[i][j];
+                guint      nObj   = rbin->len;
+                guint     *idxObj = NULL;
+
+                // range query
+                if (RTREE_MINOBJ <= rbin->len) {
+                    if (NULL == c->rtree[i][j])
+                        c->rtree[i][j] = S52_RT_new(rbin, (S52_RT_ext_cb)_getObjExt);
+
+                    g_array_set_size(_rtreeIdx, 0);
+                    nObj   = S52_RT_search(c->rtree[i][j], ext, _rtreeIdx);
+                    idxObj = (guint *)_rtreeIdx->data;
+                }
+
+                for (guint n=0; n<nObj; ++n) {
+                    guint    idx = (NULL == idxObj) ? n : idxObj[n];
+                    S52_obj *obj = (S52_obj *)g_ptr_array_index(rbin, idx);
+                    S57_geo *geo = S52PLGETGEO(obj);
+
+                    if (NULL != g_hash_table_lookup(found, geo))
+                        continue;
+                    if (FALSE == S57_cmpExt(S57_getGeoExt(geo), ext))
+                        continue;
+                    if (FALSE == _isHazard(geo, safetyContour))
+                        continue;
+                    if (FALSE == S57_touchRing(geo, npt, ring))
+                        continue;
+
+                    g_hash_table_insert(found, geo, obj);
+                    S57_setHighlight(geo, TRUE);
+                    g_string_append_printf(_hazardList, (0 == _hazardList->len) ? "%u" : ",%u", S57_getS57ID(geo));
+                    ++nFound;
+                }
+            }
+        }
+    }
+
+    return nFound;
+}
+
+DLL CCHAR *STD S52_checkHazard(unsigned int xyznbr, double *xyz, double beam, double safetyContour)
+{
+    return_if_null(xyz);
+
+    static const char *str;
+    str = NULL;
+
+    S52_CHECK_MUTX_INIT;
+
+    if (NULL == S57_getPrjStr())
+        goto exit;
+
+    if (((0.0==beam) && (xyznbr<4)) || (xyznbr<2)) {
+        PRINTF("WARNING: zone need 4 pts (closed) or route 2 pts\n");
+        goto exit;
+    }
+
+    g_string_set_size(_hazardList, 0);
+
+    // zone / route in projected coord
+    pt3 *pt = g_new(pt3, xyznbr);
+    memcpy(pt, xyz, sizeof(pt3) * xyznbr);
+    if (FALSE == S57_geo2prj3dv(xyznbr, pt)) {
+        g_free(pt);
+        goto exit;
+    }
+
+    // hazard found by an other leg
+    GHashTable *found = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    guint nRing = (0.0 == beam) ? 1 : xyznbr-1;
+    for (guint l=0; l<nRing; ++l) {
+        pt3   p[5];   // guard zone of a leg, first == last
+        pt3  *ring = p;
+        guint npt  = 5;
+
+        if (0.0 == beam) {
+            ring = pt;
+            npt  = xyznbr;
+        } else {
+            // leg extended by beam/2 at both ends to cover the turn at waypoint
+            double dx  = pt[l+1].x - pt[l].x;
+            double dy  = pt[l+1].y - pt[l].y;
+            double len = sqrt(dx*dx + dy*dy);
+            if (0.0 == len)
+                continue;
+            double ux = dx / len * beam / 2.0;
+            double uy = dy / len * beam / 2.0;
+
+            p[0].x = pt[l  ].x - ux - uy;  p[0].y = pt[l  ].y - uy + ux;
+            p[1].x = pt[l  ].x - ux + uy;  p[1].y = pt[l  ].y - uy - ux;
+            p[2].x = pt[l+1].x + ux + uy;  p[2].y = pt[l+1].y + uy - ux;
+            p[3].x = pt[l+1].x + ux - uy;  p[3].y = pt[l+1].y + uy + ux;
+            p[4]   = p[0];
+            p[0].z = p[1].z = p[2].z = p[3].z = p[4].z = 0.0;
+        }
+
+        // ring extent (deg) for the R-tree
+        ObjExt_t ext = {INFINITY, INFINITY, -INFINITY, -INFINITY};
+        for (guint k=0; k<npt; ++k) {
+            projUV uv = {ring[k].x, ring[k].y};
+            uv    = S57_prj2geo(uv);
+            ext.W = MIN(ext.W, uv.u);
+            ext.S = MIN(ext.S, uv.v);
+            ext.E = MAX(ext.E, uv.u);
+            ext.N = MAX(ext.N, uv.v);
+        }
+
+        _checkHazardRing(ext, npt, ring, safetyContour, found);
+    }
+
+    // hazard of the previous check no longer found
+    GHashTableIter iter;
+    gpointer       geo;
+    g_hash_table_iter_init(&iter, _hazardSet);
+    while (TRUE == g_hash_table_iter_next(&iter, &geo, NULL)) {
+        if (NULL == g_hash_table_lookup(found, geo))
+            _offHighlight((S57_geo *)geo);
+    }
+    g_hash_table_destroy(_hazardSet);
+    _hazardSet = found;
+
+    g_free(pt);
+
+    // keep highlight until the Alarm / Indication is acknowledged (see _cullObj())
+    if (0 != _hazardList->len)
+        S52_MP_set(S52_MAR_GUARDZONE_ALARM, 2.0);  // indication
+
+    str = _hazardList->str;
+
+exit:
+
+    GMUTEXUNLOCK(&_mp_mutex);
+
+    return str;
+}
+
 DLL CCHAR *STD S52_getPLibNameList(void)
 {
     static const char *str;
@@ -5249,6 +6883,46 @@ DLL int    STD S52_setEGLCallBack(S52_EGL_cb eglBeg, S52_EGL_cb eglEnd, void *EG
     return TRUE;
 }
 
+DLL int    STD S52_setFBO(unsigned int fboID)
+{
+    int ret = FALSE;
+
+    S52_CHECK_MUTX_INIT;
+
+    PRINTF("fboID:%u\n", fboID);
+
+    ret = S52_GL_setFBO(fboID);
+
+    // new FB - redraw all of layer 9
+    _DRAW_lastAll = TRUE;
+
+exit:
+
+    GMUTEXUNLOCK(&_mp_mutex);
+
+    return ret;
+}
+
+DLL int    STD S52_getFrameStats(unsigned int frame, S52_frameStats *stats)
+{
+    return_if_null(stats);
+
+    int ret = FALSE;
+
+    S52_CHECK_MUTX_INIT;
+
+    if ((frame<_statsN) && (frame<S52_STATS_NFRAME)) {
+        *stats = _stats[(_statsN - 1 - frame) % S52_STATS_NFRAME];
+        ret    = TRUE;
+    }
+
+exit:
+
+    GMUTEXUNLOCK(&_mp_mutex);
+
+    return ret;
+}
+
 DLL int    STD S52_dumpS57IDPixels(const char *toFilename, unsigned int S57ID, unsigned int width, unsigned int height)
 {
     int ret = FALSE;
@@ -5259,7 +6933,7 @@ DLL int    STD S52_dumpS57IDPixels(const char *toFilename, unsigned int S57ID, u
         goto exit;
 
     if (0 == S57ID) {
-        S52_GL_dumpS57IDPixels(toFilename, NULL, width, height);
+        ret = S52_GL_dumpS57IDPixels(toFilename, NULL, width, height);
     } else {
         S52_obj *obj = S52_PL_isObjValid(S57ID);
         if (NULL != obj)
@@ -5659,6 +7333,9 @@ static S52ObjectHandle     _delMarObj(S52ObjectHandle objH)
         array = _marinerCell->renderBin[disPrioIdx][obj_t];
     }
 
+    // old extent redrawn at the next drawLast(), even if this address is reused
+    _setDirtyLast(obj);
+
     // will call _delObj() if free_func() set
     if (TRUE == g_ptr_array_remove(array, obj)) {
         //_delObj(obj, NULL);
@@ -5701,6 +7378,8 @@ DLL S52ObjectHandle STD S52_toggleDispMarObj(S52ObjectHandle  objH)
 
     S52_obj *obj = S52_PL_isObjValid(objH);
     if (NULL != obj) {
+        _setDirtyLast(obj);
+
         if (TRUE == S52_PL_getSupp(obj)) {
             S52_PL_setSupp(obj, FALSE);
         } else {
@@ -6141,6 +7820,9 @@ DLL S52ObjectHandle STD S52_setDimension(S52ObjectHandle objH, double a, double
         goto exit;
     }
 
+    // redraw old and new extent
+    _setDirtyLast(obj);
+
     // debug
     _mutexOwnerS57ID = S57_getS57ID(S52_PL_getGeo(obj));
 
@@ -6186,6 +7868,9 @@ DLL S52ObjectHandle STD S52_setVector(S52ObjectHandle objH, int vecstb, double c
         goto exit;
     }
 
+    // redraw old and new extent
+    _setDirtyLast(obj);
+
     // debug
     _mutexOwnerS57ID = S57_getS57ID(S52_PL_getGeo(obj));
 
@@ -6318,6 +8003,9 @@ DLL S52ObjectHandle STD S52_pushPosition(S52ObjectHandle objH, double latitude,
         goto exit;
     }
 
+    // redraw old and new extent
+    _setDirtyLast(obj);
+
     // debug
     _mutexOwnerS57ID = S57_getS57ID(S52_PL_getGeo(obj));
 
@@ -6474,6 +8162,10 @@ DLL S52ObjectHandle STD S52_setVESSELlabel(S52ObjectHandle objH, const char *new
         objH = FALSE;
         goto exit;
     }
+
+    // redraw old and new extent
+    _setDirtyLast(obj);
+
     // debug
     _mutexOwnerS57ID = S57_getS57ID(S52_PL_getGeo(obj));
 
@@ -6518,6 +8210,9 @@ DLL S52ObjectHandle STD S52_setVESSELstate(S52ObjectHandle objH, int vesselSelec
         goto exit;
     }
 
+    // redraw old and new extent
+    _setDirtyLast(obj);
+
     if (TRUE==_isMarObjValid(obj, "ownshp") || TRUE==_isMarObjValid(obj, "vessel") ||
         TRUE==_isMarObjValid(obj, "afgves") || TRUE==_isMarObjValid(obj, "afgshp")
        ) {
@@ -6667,6 +8362,9 @@ DLL S52ObjectHandle STD S52_setVRMEBL(S52ObjectHandle objH, double pixels_x, dou
         goto exit;
     }
 
+    // redraw old and new extent
+    _setDirtyLast(obj);
+
     if (TRUE!=_isMarObjValid(obj, "ebline") && TRUE!=_isMarObjValid(obj, "vrmark")) {
         PRINTF("WARNING: not a 'ebline' or 'vrmark' object\n");
         objH = FALSE;
@@ -150,9 +150,11 @@ typedef enum S52MarinerParameter {
     S52_MAR_DISP_SCLBDY_UNION   = 50,   // When CATEGORY_SELECT: 0 - scldbU, union Scale Boundary (default), 1 - sclbdy, all Scale Boundary (debug)
                                         // Note: sclbdU:STD, sclbdy:STD
 
+    S52_MAR_DISP_CRSR_PICK_GPU  = 51,   // cursor pick: 0 - CPU, exact test of obj in the pick extent (default), 1 - GPU, colour ID read back (fallback)
+
     // FIXME: S52_MAR_DISP_ISODGR       // display ISODGR in swallow
 
-    S52_MAR_NUM                 = 51    // number of parameters
+    S52_MAR_NUM                 = 52    // number of parameters
 } S52MarinerParameter;
 
 // [3] debug - command word filter for profiling
@@ -270,6 +272,21 @@ DLL int    STD S52_getTextDisp(unsigned int dispPrioIdx);
 typedef int (*S52_EGL_cb)(void *EGLctx, const char *tag);
 DLL int    STD S52_setEGLCallBack(S52_EGL_cb eglBeg, S52_EGL_cb eglEnd, void *EGLctx);
 
+/**
+ * S52_setFBO: render to a framebuffer object of the caller instead of the window (headless)
+ * @fboID: (in): FBO of the caller (0 - window)
+ *
+ * For EGL context without surface (EGL_KHR_surfaceless_context). The FBO must be
+ * complete with a colour attachment (RGBA) the size of the viewport (S52_setViewPort()).
+ * No depth/stencil attachment needed - libS52 use neither.
+ * Read the frame from this FBO with glReadPixels() or S52_dumpS57IDPixels().
+ *
+ * Note: GL2 only
+ *
+ * Return: TRUE on success, else FALSE
+ */
+DLL int    STD S52_setFBO(unsigned int fboID);
+
 /**
  * S52_setRADARCallBack:
  * @cb: (scope call) (allow-none):
@@ -386,6 +403,25 @@ DLL int    STD S52_drawBlit(double scale_x, double scale_y, double scale_z, doub
  */
 DLL const char * STD S52_pickAt(double pixels_x, double pixels_y);
 
+/**
+ * S52_checkHazard: Anti-grounding / guard zone check
+ * @xyznbr:        (in): number of xyz
+ * @xyz:           (in) (array length=xyznbr): lon/lat/z of the zone (closed, first == last) or of the route (legs)
+ * @beam:          (in): 0.0 - @xyz is the zone, else width (meters) of the guard zone around each leg of @xyz
+ * @safetyContour: (in): depth (meters)
+ *
+ * Find the hazard that touch the zone: DEPARE/DRGARE with DRVAL1 shallower than @safetyContour
+ * and OBSTRN/WRECKS/UWTROC with VALSOU shallower than @safetyContour (or unknown).
+ * Hazard found are highlighted and S52_MAR_GUARDZONE_ALARM is set to 2 (indication).
+ *
+ * Note: CPU only, R-tree of each cell then exact segment / polygon test
+ * Note: call will fail if no ENC loaded (via S52_loadCell)
+ *
+ *
+ * Return: (transfer none): string of S57ID '<S57ID>,<S57ID>,...' ("" if none), NULL on error
+ */
+DLL const char * STD S52_checkHazard(unsigned int xyznbr, double *xyz, double beam, double safetyContour);
+
 
 //----- NO GL context (can work outside main loop) ----------
 
@@ -502,11 +538,45 @@ typedef int (*S52_loadObject_cb)(const char *objname, /* OGRFeatureH */ void *fe
  * Note: Interrupt 2 (ANSI) - user press Ctrl-C to stop long running process
  *       (if compiled with S52_USE_SUPP_LINE_OVERLAP and/or S52_USE_C_AGGR_C_ASSO,
  *        analysis can be expensive in large ENC)
+ * Note: CATALOG / ENC_ROOT (S52_USE_OGR_FILECOLLECTOR) with a NULL @loadObject_cb,
+ *       base cells are parsed concurrently (one thread per core) then inserted
+ *       in the same order as a serial load
  *
  * Return: TRUE on success, else FALSE
  */
 DLL int    STD S52_loadCell(const char *encPath, S52_loadObject_cb loadObject_cb);
 
+/**
+ * S52_loadCellAsync_cb:
+ * @encPath:  (in): cell being loaded
+ * @progress: (in): 0.0 .. 1.0 - 1.0: cell is in the scenegraph, -1.0: load failed or cancelled
+ *
+ * Called from the loader thread (NOT the main loop) - call S52_draw() from
+ * the main loop when @progress is 1.0
+ *
+ *
+ * Return: FALSE to cancel the load, else TRUE (ignored when @progress is 1.0 or -1.0)
+ */
+typedef int (*S52_loadCellAsync_cb)(const char *encPath, double progress);
+
+/**
+ * S52_loadCellAsync:
+ * @encPath: (in): path to a S57 base cell (.000)
+ * @cb:      (allow-none) (scope async): progress / cancel callback
+ *
+ * Queue @encPath for loading in a background thread, return immediately.
+ * OGR parsing and CS setup are done outside the scenegraph, the new cell is then
+ * inserted (and projected) in one short lock so draw call are not blocked.
+ * Cell are loaded one at a time in the order they are queued.
+ *
+ * Note: same as S52_loadCell() with a NULL @loadObject_cb (SENC is used if set)
+ * Note: fall back to S52_loadCell() if compiled with S52_USE_ANDROID, S52_USE_MINGW
+ *       or S52_USE_GV
+ *
+ * Return: TRUE if @encPath is queued, else FALSE
+ */
+DLL int    STD S52_loadCellAsync(const char *encPath, S52_loadCellAsync_cb cb);
+
 /**
  * S52_doneCell:
  * @encPath: (in):
@@ -746,6 +816,56 @@ DLL int    STD S52_getRGB(const char *colorName, unsigned char *R, unsigned char
  */
 DLL int    STD S52_dumpS57IDPixels(const char *toFilename, unsigned int S57ID, unsigned int width, unsigned int height);
 
+/**
+ * S52_frameStats: statistic of one frame - S52_draw() and the S52_drawLast() that follow
+ * (or S52_drawLast() alone)
+ *
+ * Time in msec (CPU wall clock, GL call submitted not executed).
+ * Phase time is the sum of the phase over all tile when the tile cache is ON.
+ * GPU time (GL_EXT_disjoint_timer_query or GL_ARB_timer_query) is read without
+ * stalling the pipeline, so it land a few frame later - ask @frame 4 or more.
+ */
+#define S52_STATS_NPRIO   10   // display priority 0-9
+#define S52_STATS_NFRAME  64   // number of frame kept
+#define S52_STATS_NCMD    7    // GPU time by command word: AC, AP, LS, LC, SY, TX, other (batch only, see gpuCmd_ms)
+typedef struct S52_frameStats {
+    unsigned int frame;                     // frame number since init()
+    double       draw_ms;                   // S52_draw() total (0 if no draw)
+    double       app_ms;                    // update object (CS, ..)
+    double       cull_ms;                   // object in view
+    double       cullLights_ms;             // light sector of all cell
+    double       prio_ms[S52_STATS_NPRIO];  // render by display priority (9: Mariners' in S52_drawLast())
+    double       text_ms;                   // text of layer 0-8
+    double       grat_ms;                   // graticule
+    double       legend_ms;                 // legend
+    double       glend_ms;                  // S52_GL_end() of draw and drawLast
+    double       last_ms;                   // S52_drawLast() total
+    unsigned int nObjTotal;                 // object tested by cull
+    unsigned int nCullSupp;                 // culled: suppressed (user, display category, class)
+    unsigned int nCullScamin;               // culled: SCAMIN
+    unsigned int nCullView;                 // culled: outside view
+    unsigned int nObjDraw;                  // object drawn
+    unsigned int nCmd;                      // command word rendered
+    unsigned int nDrawCall;                 // glDraw*() call (GL2)
+    unsigned int nVertex;                   // vertex submitted (GL2)
+    unsigned int nVBO;                      // VBO created (GL2)
+    unsigned int nTexUpload;                // texture upload (GL2)
+    double       gpu_ms;                    // GPU time (GL2 timer query) - 0: no result (yet)
+    double       gpuPrio_ms[S52_STATS_NPRIO];  // GPU time by display priority (text batch in none)
+    double       gpuCmd_ms[S52_STATS_NCMD];    // GPU time by command word of batch draw, command not batched in other
+} S52_frameStats;
+
+/**
+ * S52_getFrameStats:
+ * @frame: (in):  0 - last frame, 1 - the one before, .. (max S52_STATS_NFRAME-1)
+ * @stats: (out): statistic of @frame
+ *
+ * Note: also via JSON-RPC (S52_USE_SOCK): params [frame], result [{stats}]
+ *
+ * Return: TRUE on success, else FALSE (@frame not drawn yet)
+ */
+DLL int    STD S52_getFrameStats(unsigned int frame, S52_frameStats *stats);
+
 
 ///////////////////////////////////////////////////////////////
 //
@@ -26,14 +26,30 @@
 
 #include "S52CS.h"
 #include "S52MP.h"      // S52_MP_get/set()
+#include "S52RT.h"      // S52_RT_new(), S52_RT_search()
 #include "S52utils.h"   // PRINTF(), S52_atof(), S52_atoi(), CCHAR
 
-#include <math.h>       // floor()
+#include <math.h>       // floor(), isnan(), isfinite()
+#include <stdlib.h>     // qsort()
 
 #define version "3.2.0" // CS of Plib 3.2 S52 ed ?
 
 #define UNKNOWN_DEPTH -1000.0  // depth of 1km above sea level
 
+// S52_CS_touch() - spatial index on a list of localObj, candidate come out in list order
+// so that touch link are the same as a linear scan with S57_cmpGeoExt()
+typedef struct _touchIdx {
+    GHashTable *ptHash;      // point list: exact position (_ptKey) --> GArray of index in list
+    GArray     *ptOther;     // point list: index of geo that are not a point - checked with S57_cmpGeoExt()
+    S52_RT     *rtree;       // area list : extent of all geo in list
+    GPtrArray  *ringExt;     // area list : extent of each ring of geo in list (S57_newRingExt()), NULL until used
+} _touchIdx;
+
+typedef struct _ptKey {
+    double x;
+    double y;
+} _ptKey;
+
 // loadCell() - keep ref on S57_geo for further proccessing in CS
 typedef struct _localObj {
     GPtrArray *lights_list;  // list of: LIGHTS
@@ -41,11 +57,26 @@ typedef struct _localObj {
     GPtrArray *depcnt_list;  // list of: DEPARE:A, DRGARE:A used by CS(DEPCNT02)
     GPtrArray *udwhaz_list;  // list of: DEPARE:A/L and DRGARE:A used by CS(_UDWHAZ03)
     GPtrArray *depval_list;  // list of geo used by CS(_DEPVAL01) (via OBSTRN04, WRECKS02)
+
+    // built at the first S52_CS_touch() after S52_CS_add()
+    _touchIdx  lights_idx;   // point hash
+    _touchIdx  topmar_idx;   // point hash
+    _touchIdx  depcnt_idx;   // R-tree
+    _touchIdx  udwhaz_idx;   // R-tree
+    _touchIdx  depval_idx;   // R-tree
+    GArray    *idxList;      // result of the last search (guint index in list)
 } _localObj;
 
 // Note: seem useless S52 specs -- no effect !?
 //GPtrArray *rigid_list; // rigid platform
 
+// id of attribute read at each CS resolve - interned once in S52_CS_init()
+static gsize     _attIDinit = 0;
+static S57_AttID _DRVAL1    = 0;
+static S57_AttID _DRVAL2    = 0;
+static S57_AttID _VALSOU    = 0;
+static S57_AttID _VALDCO    = 0;
+
 // size of attributes value list buffer
 #define LISTSIZE   16   // list size
 
@@ -112,6 +143,14 @@ CCHAR    *S52_CS_version(void)
 
 localObj *S52_CS_init (void)
 {
+    if (g_once_init_enter(&_attIDinit)) {
+        _DRVAL1 = S57_getAttID("DRVAL1");
+        _DRVAL2 = S57_getAttID("DRVAL2");
+        _VALSOU = S57_getAttID("VALSOU");
+        _VALDCO = S57_getAttID("VALDCO");
+        g_once_init_leave(&_attIDinit, 1);
+    }
+
     _localObj *local = g_new0(_localObj, 1);
     //_localObj *local = g_try_new0(_localObj, 1);
     if (NULL == local)
@@ -123,9 +162,40 @@ localObj *S52_CS_init (void)
     local->udwhaz_list = g_ptr_array_new();
     local->depval_list = g_ptr_array_new();
 
+    local->idxList     = g_array_new(FALSE, FALSE, sizeof(guint));
+
     return local;
 }
 
+static int      _doneTouchIdx(_touchIdx *idx)
+{
+    if (NULL != idx->ptHash)
+        g_hash_table_destroy(idx->ptHash);
+    if (NULL != idx->ptOther)
+        g_array_free(idx->ptOther, TRUE);
+    if (NULL != idx->ringExt)
+        g_ptr_array_free(idx->ringExt, TRUE);
+    S52_RT_done(idx->rtree);
+
+    idx->ptHash  = NULL;
+    idx->ptOther = NULL;
+    idx->rtree   = NULL;
+    idx->ringExt = NULL;
+
+    return TRUE;
+}
+
+static int      _doneAllTouchIdx(_localObj *local)
+{
+    _doneTouchIdx(&local->lights_idx);
+    _doneTouchIdx(&local->topmar_idx);
+    _doneTouchIdx(&local->depcnt_idx);
+    _doneTouchIdx(&local->udwhaz_idx);
+    _doneTouchIdx(&local->depval_idx);
+
+    return TRUE;
+}
+
 localObj *S52_CS_done (_localObj *local)
 {
     return_if_null(local);
@@ -143,11 +213,169 @@ localObj *S52_CS_done (_localObj *local)
     local->udwhaz_list = NULL;
     local->depval_list = NULL;
 
+    _doneAllTouchIdx(local);
+    g_array_free(local->idxList, TRUE);
+    local->idxList = NULL;
+
     g_free(local);
 
     return NULL;
 }
 
+static gboolean _getPt(S57_geo *geo, _ptKey *pt)
+// TRUE if the extent of geo is a point - then S57_cmpGeoExt() is TRUE only at the exact same position
+{
+    ObjExt_t ext = S57_getGeoExtRaw(geo);
+
+    if (ext.W!=ext.E || ext.S!=ext.N || !isfinite(ext.W) || !isfinite(ext.S))
+        return FALSE;
+
+    // -0.0 == 0.0
+    pt->x = ext.W + 0.0;
+    pt->y = ext.S + 0.0;
+
+    return TRUE;
+}
+
+static guint    _ptHash(gconstpointer key)
+{
+    const _ptKey *pt = (const _ptKey *) key;
+
+    return g_double_hash(&pt->x) ^ (g_double_hash(&pt->y) * 31);
+}
+
+static gboolean _ptEqual(gconstpointer a, gconstpointer b)
+{
+    const _ptKey *A = (const _ptKey *) a;
+    const _ptKey *B = (const _ptKey *) b;
+
+    return (A->x==B->x && A->y==B->y) ? TRUE : FALSE;
+}
+
+static void     _freeArray(gpointer array)
+{
+    if (NULL != array)
+        g_array_free((GArray *) array, TRUE);
+}
+
+static ObjExt_t _getRTExt(gpointer geo)
+// NaN extent intersect everything in S57_cmpExt() - so never prune it
+{
+    ObjExt_t ext = S57_getGeoExtRaw((S57_geo *) geo);
+
+    if (isnan(ext.W) || isnan(ext.S) || isnan(ext.E) || isnan(ext.N)) {
+        ext.W = -INFINITY;
+        ext.S = -INFINITY;
+        ext.E =  INFINITY;
+        ext.N =  INFINITY;
+    }
+
+    return ext;
+}
+
+static int      _cmpIdx(const void *a, const void *b)
+{
+    guint A = *(const guint *) a;
+    guint B = *(const guint *) b;
+
+    return (A < B) ? -1 : (A > B) ? 1 : 0;
+}
+
+static int      _buildPtHash(_touchIdx *idx, GPtrArray *list)
+{
+    idx->ptHash  = g_hash_table_new_full(_ptHash, _ptEqual, g_free, _freeArray);
+    idx->ptOther = g_array_new(FALSE, FALSE, sizeof(guint));
+
+    for (guint i=0; i<list->len; ++i) {
+        _ptKey pt;
+        if (FALSE == _getPt((S57_geo *) g_ptr_array_index(list, i), &pt)) {
+            g_array_append_val(idx->ptOther, i);
+            continue;
+        }
+
+        GArray *bucket = (GArray *) g_hash_table_lookup(idx->ptHash, &pt);
+        if (NULL == bucket) {
+            _ptKey *key = g_new(_ptKey, 1);
+            *key   = pt;
+            bucket = g_array_new(FALSE, FALSE, sizeof(guint));
+            g_hash_table_insert(idx->ptHash, key, bucket);
+        }
+        g_array_append_val(bucket, i);
+    }
+
+    return TRUE;
+}
+
+static GArray  *_searchTouch(_localObj *local, _touchIdx *idx, GPtrArray *list, gboolean ptList, S57_geo *geo)
+// return index (in list order) of candidate in list where S57_cmpGeoExt(geo, candidate) is TRUE
+{
+    GArray *idxList = local->idxList;
+    g_array_set_size(idxList, 0);
+
+    if (0 == list->len)
+        return idxList;
+
+    if (TRUE == ptList) {
+        _ptKey pt;
+        if (FALSE == _getPt(geo, &pt)) {
+            // not a point - scan all
+            for (guint i=0; i<list->len; ++i) {
+                if (TRUE == S57_cmpGeoExt(geo, (S57_geo *) g_ptr_array_index(list, i)))
+                    g_array_append_val(idxList, i);
+            }
+            return idxList;
+        }
+
+        if (NULL == idx->ptHash)
+            _buildPtHash(idx, list);
+
+        GArray *bucket = (GArray *) g_hash_table_lookup(idx->ptHash, &pt);
+        if (NULL != bucket)
+            g_array_append_vals(idxList, bucket->data, bucket->len);
+
+        guint nPt = idxList->len;
+        for (guint k=0; k<idx->ptOther->len; ++k) {
+            guint i = g_array_index(idx->ptOther, guint, k);
+            if (TRUE == S57_cmpGeoExt(geo, (S57_geo *) g_ptr_array_index(list, i)))
+                g_array_append_val(idxList, i);
+        }
+        if ((0<nPt) && (nPt<idxList->len))
+            qsort(idxList->data, idxList->len, sizeof(guint), _cmpIdx);
+    } else {
+        ObjExt_t ext = S57_getGeoExtRaw(geo);
+        if (isnan(ext.W) || isnan(ext.S) || isnan(ext.E) || isnan(ext.N)) {
+            // NaN extent intersect everything
+            for (guint i=0; i<list->len; ++i)
+                g_array_append_val(idxList, i);
+            return idxList;
+        }
+
+        if (NULL == idx->rtree)
+            idx->rtree = S52_RT_new(list, _getRTExt);
+
+        S52_RT_search(idx->rtree, ext, idxList);
+    }
+
+    return idxList;
+}
+
+static GArray  *_getRingExt(_touchIdx *idx, GPtrArray *list, guint i)
+// extent of each ring of the geo at index i in list - computed once
+{
+    if (NULL == idx->ringExt) {
+        idx->ringExt = g_ptr_array_new_with_free_func(_freeArray);
+        g_ptr_array_set_size(idx->ringExt, list->len);
+    }
+
+    GArray *ringExt = (GArray *) g_ptr_array_index(idx->ringExt, i);
+    if (NULL == ringExt) {
+        ringExt = S57_newRingExt((S57_geo *) g_ptr_array_index(list, i));
+        g_ptr_array_index(idx->ringExt, i) = ringExt;
+    }
+
+    return ringExt;
+}
+
 int       S52_CS_add  (_localObj *local, S57_geo *geo)
 // return TRUE
 {
@@ -156,6 +384,9 @@ int       S52_CS_add  (_localObj *local, S57_geo *geo)
 
     const char *name = S57_getName(geo);
 
+    // list change - rebuild index at next S52_CS_touch()
+    _doneAllTouchIdx(local);
+
     ///////////////////////////////////////////////
     // for LIGHTS05
     //
@@ -226,12 +457,10 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
     ////////////////////////////////////////////
     // floating object
     if (0 == g_strcmp0(name, "TOPMAR")) {
-        for (guint i=0; i<local->topmar_list->len; ++i) {
-            S57_geo *other = (S57_geo *) g_ptr_array_index(local->topmar_list, i);
-
-            // skip if not at same position
-            if (FALSE == S57_cmpGeoExt(geo, other))
-                continue;
+        // at same position
+        GArray *idxList = _searchTouch(local, &local->topmar_idx, local->topmar_list, TRUE, geo);
+        for (guint k=0; k<idxList->len; ++k) {
+            S57_geo *other = (S57_geo *) g_ptr_array_index(local->topmar_list, g_array_index(idxList, guint, k));
 
             if (NULL == S57_getTouchTOPMAR(geo)) {
                 S57_setTouchTOPMAR(geo, other);
@@ -258,13 +487,10 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
     // experimental:
     // check if this buoy has a lights
     if (0 == g_strcmp0(name, "BOYLAT")) {
-        for (guint i=0; i<local->lights_list->len; ++i) {
-
-            S57_geo *light = (S57_geo *) g_ptr_array_index(local->lights_list, i);
-
-            // skip if this light is not at buoy's position
-            if (FALSE == S57_cmpGeoExt(geo, light))
-                continue;
+        // light at buoy's position
+        GArray *idxList = _searchTouch(local, &local->lights_idx, local->lights_list, TRUE, geo);
+        for (guint k=0; k<idxList->len; ++k) {
+            S57_geo *light = (S57_geo *) g_ptr_array_index(local->lights_list, g_array_index(idxList, guint, k));
 
             // debug
             if (NULL != S57_getTouchLIGHTS(light)) {
@@ -289,15 +515,23 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
     // LIGHTS05:sector
     // chaine light at same position
     if (0 == g_strcmp0(name, "LIGHTS")) {
-        for (guint i=0; i<local->lights_list->len; ++i) {
-            S57_geo *candidate = (S57_geo *) g_ptr_array_index(local->lights_list, i);
-
-            // skip if allready processed / same LIGHTS
-            if (S57_getS57ID(candidate) <= S57_getS57ID(geo))
-                continue;
+        // light at same position
+        // Note: S57ID can be 0 here (defered by a loader thread), so chain in lights_list
+        // order - same as S57ID order since the list is filled in load order
+        GArray *idxList = _searchTouch(local, &local->lights_idx, local->lights_list, TRUE, geo);
+        guint   self    = 0;
+        for (guint k=0; k<idxList->len; ++k) {
+            if (geo == (S57_geo *) g_ptr_array_index(local->lights_list, g_array_index(idxList, guint, k))) {
+                self = k + 1;
+                break;
+            }
+        }
+        // idxList is in list order - candidate after this LIGHTS only
+        for (guint k=self; k<idxList->len; ++k) {
+            S57_geo *candidate = (S57_geo *) g_ptr_array_index(local->lights_list, g_array_index(idxList, guint, k));
 
-            // skip if not at same position
-            if (FALSE == S57_cmpGeoExt(geo, candidate))
+            // skip same LIGHTS
+            if (candidate == geo)
                 continue;
 
             // chaine lights
@@ -358,17 +592,17 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
 
         // select the next deeper contour as the safety contour
         // when the contour requested is not in the ENC
-        for (guint i=0; i<local->depcnt_list->len; ++i) {
+        // candidate overlapping geo
+        GArray *idxList = _searchTouch(local, &local->depcnt_idx, local->depcnt_list, FALSE, geo);
+        for (guint k=0; k<idxList->len; ++k) {
+            guint    i         = g_array_index(idxList, guint, k);
             S57_geo *candidate = (S57_geo *) g_ptr_array_index(local->depcnt_list, i);
 
             // skip if it's same S57 object (DEPARE)
-            if (S57_getS57ID(geo) == S57_getS57ID(candidate))
+            if (geo == candidate)
                 continue;
 
-            if (FALSE == S57_cmpGeoExt(geo, candidate))
-                continue;
-
-            if (FALSE == S57_isPtInSet(candidate, ppt[0], ppt[1]))
+            if (FALSE == S57_isPtInSetExt(candidate, _getRingExt(&local->depcnt_idx, local->depcnt_list, i), ppt[0], ppt[1]))
                 continue;
 
             //
@@ -377,8 +611,8 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
 
             // select the shallowest area for later _DEPCNT_isSC() test DRVAL1 < SC
             // DRVAL1 mandatory DEPARE:A and DRGARE:A
-            GString *can_drval1str = S57_getAttVal(candidate, "DRVAL1");
-            double   can_drval1    = (NULL==can_drval1str) ? 0.0 : S52_atof(can_drval1str->str);
+            double can_drval1 = 0.0;
+            S57_getAttReal(candidate, _DRVAL1, &can_drval1);
             if (can_drval1 < drvalmin) {
                 drvalmin = can_drval1;
                 S57_setTouchDEPCNT(geo, candidate);
@@ -415,14 +649,13 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
         // find the deepest group 1 under this geo
         //double depth_max = 0.0;
         double depth_max = UNKNOWN_DEPTH;
-        for (guint i=0; i<local->udwhaz_list->len; ++i) {
+        // candidate overlapping geo
+        GArray *idxList = _searchTouch(local, &local->udwhaz_idx, local->udwhaz_list, FALSE, geo);
+        for (guint k=0; k<idxList->len; ++k) {
             // list of DEPARE:L/A and DRGARE:A
+            guint    i         = g_array_index(idxList, guint, k);
             S57_geo *candidate = (S57_geo *) g_ptr_array_index(local->udwhaz_list, i);
 
-            // skip if not overlapping
-            if (FALSE == S57_cmpGeoExt(geo, candidate))
-                continue;
-
             //
             // is geo touching this candidate?
             //
@@ -435,13 +668,13 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
                         continue;
                 } else {
                     // candidate area
-                    if (FALSE == S57_isPtInArea(candidate, ppt[0], ppt[1])) {
+                    if (FALSE == S57_isPtInAreaExt(candidate, _getRingExt(&local->udwhaz_idx, local->udwhaz_list, i), ppt[0], ppt[1])) {
                         continue;
                     }
                 }
             } else {
                 // geo:A/L, candidate:A/L
-                if (FALSE == S57_isPtInSet(candidate, ppt[0], ppt[1]))
+                if (FALSE == S57_isPtInSetExt(candidate, _getRingExt(&local->udwhaz_idx, local->udwhaz_list, i), ppt[0], ppt[1]))
                     continue;
             }
 
@@ -455,9 +688,8 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
             //get depth_max
             if (S57_LINES_T == S57_getObjtype(candidate)) {
                 // DEPARE:L use DRVAL2 (not in UDWHAZ04)
-                GString *drval2str = S57_getAttVal(candidate, "DRVAL2");
-                if (NULL != drval2str) {
-                    double drval2 = S52_atof(drval2str->str);
+                double drval2;
+                if (TRUE == S57_getAttReal(candidate, _DRVAL2, &drval2)) {
                     if (drval2 > depth_max) {
                         depth_max = drval2;
                         S57_setTouchUDWHAZ(geo, candidate);
@@ -467,15 +699,14 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
                 // DEPARE:A and DRGARE:A use DRVAL1
                 // If there is no explicit value, go to the next object because we
                 // consider, empty DRVAL1 is always less SAFETY_CONTOUR
-                GString *drval1str = S57_getAttVal(candidate, "DRVAL1");
-                if (NULL != drval1str) {
-                    double drval1 = S52_atof(drval1str->str);
+                double drval1;
+                if (TRUE == S57_getAttReal(candidate, _DRVAL1, &drval1)) {
                     if (drval1 > depth_max) {
                         depth_max = drval1;
                         S57_setTouchUDWHAZ(geo, candidate);
                     }
                     //else {
-                    //    PRINTF("DEBUG: group 1 candidate DRVAL1=%s under this: %s:%c:%i\n", drval1str->str, name, S57_getObjtype(geo), S57_getS57ID(geo));
+                    //    PRINTF("DEBUG: group 1 candidate DRVAL1=%f under this: %s:%c:%i\n", drval1, name, S57_getObjtype(geo), S57_getS57ID(geo));
                     //}
                 }
                 //else {
@@ -515,13 +746,12 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
         //double least_depth = INFINITY;
         double least_depth = UNKNOWN_DEPTH;
 
-        for (guint i=0; i<local->depval_list->len; ++i) {
+        // candidate overlapping geo
+        GArray *idxList = _searchTouch(local, &local->depval_idx, local->depval_list, FALSE, geo);
+        for (guint k=0; k<idxList->len; ++k) {
+            guint    i         = g_array_index(idxList, guint, k);
             S57_geo *candidate = (S57_geo *) g_ptr_array_index(local->depval_list, i);
 
-            // skip if extent not overlapping
-            if (FALSE == S57_cmpGeoExt(geo, candidate))
-                continue;
-
             //
             // is geo touching this candidate?
             //
@@ -534,13 +764,13 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
                 }
 
                 // candidate:A
-                if (FALSE ==S57_isPtInArea(candidate, ppt[0], ppt[1])) {
+                if (FALSE ==S57_isPtInAreaExt(candidate, _getRingExt(&local->depval_idx, local->depval_list, i), ppt[0], ppt[1])) {
                     continue;
                 }
 
             } else {
                 // geo:A/L, candidate:A/L
-                if (FALSE == S57_isPtInSet(candidate, ppt[0], ppt[1]))
+                if (FALSE == S57_isPtInSetExt(candidate, _getRingExt(&local->depval_idx, local->depval_list, i), ppt[0], ppt[1]))
                     continue;
             }
 
@@ -561,11 +791,10 @@ int       S52_CS_touch(_localObj *local, S57_geo *geo)
             if (NULL == crntmin) {
                 S57_setTouchDEPVAL(geo, candidate);
             } else {
-                GString *drval1str = S57_getAttVal(candidate, "DRVAL1");
-                if (NULL == drval1str)
+                double drval1;
+                if (FALSE == S57_getAttReal(candidate, _DRVAL1, &drval1))
                     continue;
 
-                double drval1 = S52_atof(drval1str->str);
                 //if (isinf(least_depth)) {
                 if (UNKNOWN_DEPTH == least_depth) {
                     least_depth = drval1;
@@ -760,10 +989,10 @@ static GString *DEPARE01 (S57_geo *geo)
     GString *depare01  = NULL;
     //int      objl      = 0;
     //GString *objlstr   = NULL;
-    GString *drval1str = S57_getAttVal(geo, "DRVAL1");
-    double   drval1    = (NULL == drval1str) ? -1.0        : S52_atof(drval1str->str);
-    GString *drval2str = S57_getAttVal(geo, "DRVAL2");
-    double   drval2    = (NULL == drval2str) ? drval1+0.01 : S52_atof(drval2str->str);
+    double   drval1    = -1.0;
+    S57_getAttReal(geo, _DRVAL1, &drval1);
+    double   drval2    = drval1+0.01;
+    S57_getAttReal(geo, _DRVAL2, &drval2);
 
     // adjuste datum
     drval1 += S52_MP_get(S52_MAR_DATUM_OFFSET);
@@ -843,10 +1072,8 @@ static gboolean _DEPCNT02_isSC(S57_geo *geo)
 
     S57_geo *geoTouch = S57_getTouchDEPCNT(geo);
     if (NULL != geoTouch) {
-        GString *drval1touchstr = S57_getAttVal(geoTouch, "DRVAL1");
-        if (NULL != drval1touchstr) {
-
-            double drval1touch = S52_atof(drval1touchstr->str);
+        double drval1touch;
+        if (TRUE == S57_getAttReal(geoTouch, _DRVAL1, &drval1touch)) {
 
             // adjuste datum
             drval1touch += S52_MP_get(S52_MAR_DATUM_OFFSET);
@@ -895,10 +1122,10 @@ static GString *DEPCNT02 (S57_geo *geo)
     // DEPARE (line)
     if (0 == g_strcmp0(S57_getName(geo), "DEPARE")) {  // only DEPARE:L call CS(DEPCNT02)
         // Note: if drval1 not given then set it to 0.0 (ie. LOW WATER LINE as FAIL-SAFE)
-        GString *drval1str = S57_getAttVal(geo, "DRVAL1");
-        double   drval1    = (NULL == drval1str) ? 0.0    : S52_atof(drval1str->str);
-        GString *drval2str = S57_getAttVal(geo, "DRVAL2");
-        double   drval2    = (NULL == drval2str) ? drval1 : S52_atof(drval2str->str);
+        double   drval1    = 0.0;
+        S57_getAttReal(geo, _DRVAL1, &drval1);
+        double   drval2    = drval1;
+        S57_getAttReal(geo, _DRVAL2, &drval2);
 
         // adjuste datum
         drval1 += S52_MP_get(S52_MAR_DATUM_OFFSET);
@@ -918,8 +1145,8 @@ static GString *DEPCNT02 (S57_geo *geo)
 
     } else {
         // continuation A (DEPCNT (line)) - only DEPCNT:L call CS(DEPCNT02)
-        GString *valdcostr = S57_getAttVal(geo, "VALDCO");
-        double   valdco    = (NULL == valdcostr) ? 0.0 : S52_atof(valdcostr->str);
+        double   valdco    = 0.0;
+        S57_getAttReal(geo, _VALDCO, &valdco);
 
         // adjuste datum
         valdco += S52_MP_get(S52_MAR_DATUM_OFFSET);
@@ -999,7 +1226,7 @@ static double   _DEPVAL01(S57_geo *geo, double least_depth)
 // procedure.
 {
     // Note: collect group 1 area DEPARE & DRGARE that touch this point/line/area is done at load-time
-    GString *drval1str = NULL;
+    double   drval1    = UNKNOWN_DEPTH;
     S57_geo *geoTouch  = S57_getTouchDEPVAL(geo);
     if (NULL == geoTouch) {
         PRINTF("DEBUG: NULL geo _DEPVAL01/getTouchDEPVAL\n");
@@ -1013,9 +1240,8 @@ static double   _DEPVAL01(S57_geo *geo, double least_depth)
             return UNKNOWN_DEPTH;
         }
 
-        drval1str = S57_getAttVal(geoTouch, "DRVAL1");
+        S57_getAttReal(geoTouch, _DRVAL1, &drval1);
     }
-    double drval1 = (NULL==drval1str) ? UNKNOWN_DEPTH : S52_atof(drval1str->str);
 
 
     //least_depth = drval1; // !?! clang - val in least_depth never read
@@ -1818,13 +2044,11 @@ static GString *OBSTRN04 (S57_geo *geo)
     GString *sndfrm02 = NULL;
     GString *udwhaz03 = NULL;
 
-    GString *valsoustr   = S57_getAttVal(geo, "VALSOU");
     double   valsou      = UNKNOWN_DEPTH;
     double   depth_value = UNKNOWN_DEPTH;  // clang - init val never read
     double   least_depth = UNKNOWN_DEPTH;
 
-    if (NULL != valsoustr) {
-        valsou      = S52_atof(valsoustr->str);
+    if (TRUE == S57_getAttReal(geo, _VALSOU, &valsou)) {
         depth_value = valsou;
         sndfrm02    = _SNDFRM02(geo, depth_value);
     } else {
@@ -2461,10 +2685,10 @@ static GString *SLCONS03 (S57_geo *geo)
 
     if (S57_AREAS_T == S57_getObjtype(geo)) {
         GString    *seabed01  = NULL;
-        GString    *drval1str = S57_getAttVal(geo, "DRVAL1");
-        double      drval1    = (NULL == drval1str)? UNKNOWN_DEPTH : S52_atof(drval1str->str);
-        GString    *drval2str = S57_getAttVal(geo, "DRVAL2");
-        double      drval2    = (NULL == drval2str)? UNKNOWN_DEPTH : S52_atof(drval2str->str);
+        double      drval1    = UNKNOWN_DEPTH;
+        S57_getAttReal(geo, _DRVAL1, &drval1);
+        double      drval2    = UNKNOWN_DEPTH;
+        S57_getAttReal(geo, _DRVAL2, &drval2);
 
         // adjuste datum
         if (UNKNOWN_DEPTH != drval1)
@@ -3148,12 +3372,10 @@ static GString *_UDWHAZ03(S57_geo *geo, double depth_value)
 
         // DEPARE:L
         if (S57_LINES_T == S57_getObjtype(geoTouch)) {
-            GString *drval2str = S57_getAttVal(geoTouch, "DRVAL2");
-            if (NULL == drval2str)
+            double drval2;
+            if (FALSE == S57_getAttReal(geoTouch, _DRVAL2, &drval2))
                 return NULL;
 
-            double drval2 = S52_atof(drval2str->str);
-
             // adjuste datum
             drval2 += S52_MP_get(S52_MAR_DATUM_OFFSET);
 
@@ -3163,12 +3385,10 @@ static GString *_UDWHAZ03(S57_geo *geo, double depth_value)
 
         } else {
             // area DEPARE:A or DRGARE:A
-            GString *drval1str = S57_getAttVal(geoTouch, "DRVAL1");
-            if (NULL == drval1str)
+            double drval1;
+            if (FALSE == S57_getAttReal(geoTouch, _DRVAL1, &drval1))
                 return NULL;
 
-            double drval1 = S52_atof(drval1str->str);
-
             // adjuste datum
             drval1 += S52_MP_get(S52_MAR_DATUM_OFFSET);
 
@@ -3400,7 +3620,6 @@ static GString *WRECKS02 (S57_geo *geo)
     GString *udwhaz03 = NULL;
     GString *quapnt01 = NULL;
 
-    GString *valsoustr   = S57_getAttVal(geo, "VALSOU");
     double   valsou      = UNKNOWN_DEPTH;
     double   least_depth = UNKNOWN_DEPTH;
     double   depth_value = UNKNOWN_DEPTH;
@@ -3416,8 +3635,7 @@ static GString *WRECKS02 (S57_geo *geo)
     //    //g_assert(0);
     //}
 
-    if (NULL != valsoustr) {
-        valsou      = S52_atof(valsoustr->str);
+    if (TRUE == S57_getAttReal(geo, _VALSOU, &valsou)) {
         depth_value = valsou;
         sndfrm02    = _SNDFRM02(geo, depth_value);
     } else {
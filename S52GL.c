@@ -181,6 +181,11 @@ static double _dotpitch_mm_y = 0.3;  // will be overwright at init()
 #error "GLSC2 need EGL"
 #endif
 
+// GL2: layer 9 drawn in an offscreen FB kept between S52_drawLast() - partial redraw
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2) && !defined(S52_USE_RADAR)
+#define S52_USE_LAST_FBO
+#endif
+
 // GL1.x
 #ifdef S52_USE_GL1
 #include "_GL1.i"
@@ -210,6 +215,9 @@ static guint   _nFrag  = 0;     // number of pixel fragment (color switch)
 static int     _drgare = 0;     // DRGARE
 static int     _depare = 0;     // DEPARE
 static int     _nAC    = 0;     // total AC (Area Color)
+static guint   _nACbatchDraw = 0;  // glDrawArrays() of AC batch (S52_GL_drawACBatch())
+static guint   _nLSbatchDraw = 0;  // glDrawArrays() of LS batch (S52_GL_drawLSBatch())
+static guint   _nTXTbatchDraw = 0; // glDrawArrays() of TXT batch (S52_GL_endTextBatch())
 
 // tesselated area stat
 static guint   _ntris     = 0;     // area GL_TRIANGLES      count
@@ -1605,6 +1613,78 @@ static double    _getWorldGridRef(S52_obj *obj, double *LLx, double *LLy, double
     return stagOffsetPix;
 }
 
+#ifdef S52_USE_GL2
+// AC batch: triangles of all AC of an AREAS render bin (cell/prio) merged in one VBO,
+// a run of obj of the journal is then filled with a few glDrawArrays() (one if contiguous)
+// Note: vertex Z = colour index in palette + AC_TRANS * trans - the colour
+// is looked up in uPalArray by the vertex shader, so a palette switch cost nothing
+#define AC_TRANS  64
+
+typedef struct _ACentry {
+    S52_obj *obj;
+    GLint    first;     // first vertex in VBO
+    GLsizei  count;     // nbr of vertex (GL_TRIANGLES)
+    guchar   cidx;      // colour in VBO - checked against the LUP at draw time (CS re-resolve)
+    char     trans;
+} _ACentry;
+
+typedef struct _S52_GL_ACbatch {
+    GPtrArray  *rbin;   // render bin batched (ref)
+    GArray     *entry;  // _ACentry in rbin order
+    GHashTable *objIdx; // S52_obj --> idx+1 in entry
+    GArray     *vert;   // vertex_t XYZ - copy of the VBO for colour update
+    GLuint      vboID;
+    gboolean    dirty;  // rbin changed - rebuild at next draw
+} _S52_GL_ACbatch;
+
+static gboolean _ACbatchOn = FALSE;  // TRUE: AC of obj drawn by S52_GL_drawACBatch()
+
+// AP batch: AP of a run of the AC batch filled from the same VBO, one glDrawArrays()
+// per pattern (more if not contiguous) - pattern tile in the AP atlas (_GL2.i)
+typedef struct _APrun {
+    _ACentry      *e;
+    _APslot       *slot;
+    S52_DListData *DListData;
+} _APrun;
+
+static GHashTable *_APbatchObj = NULL;  // set of S52_obj - AP drawn by _drawAPBatch()
+static GArray     *_APrunBuf   = NULL;  // _APrun - work buffer of _drawAPBatch()
+
+// LS batch: LS of the LINES render bin (cell/prio) merged in one VBO, grouped by
+// style / pen_w / colour, a run of obj of the journal is then drawn with one
+// glDrawArrays() per group (more if not contiguous)
+// Note: vertex is X Y Z, cumulative distance at the segment start and in the segment
+// (stipple continue accross vertex, wrapped in the vertex shader), extrusion
+#define LS_VERT_SZ 7
+
+typedef struct _LSgroup {
+    char     style;     // L/S/T
+    char     pen_w;
+    guchar   cidx;
+    char     trans;
+    gboolean wide;      // pen_w > _lineWidthMax - GL_TRIANGLES extruded in the vertex shader
+} _LSgroup;
+
+typedef struct _LSentry {
+    S52_obj *obj;
+    guint    group;                 // idx in groups
+    GLint    first[S57_LOD_NUM];    // first vertex in VBO, by LOD
+    GLsizei  count[S57_LOD_NUM];    // nbr of vertex (GL_LINES / GL_TRIANGLES)
+} _LSentry;
+
+typedef struct _S52_GL_LSbatch {
+    GPtrArray  *rbin;   // render bin batched (ref)
+    GArray     *group;  // _LSgroup
+    GArray     *entry;  // _LSentry in VBO order
+    GHashTable *objIdx; // S52_obj --> idx+1 in entry
+    GLuint      vboID;
+    gboolean    dirty;  // rbin changed - rebuild at next draw
+} _S52_GL_LSbatch;
+
+static gboolean _LSbatchOn = FALSE;  // TRUE: LS of obj drawn by S52_GL_drawLSBatch()
+static GArray  *_LSrunBuf  = NULL;   // _LSrun - work buffer of S52_GL_drawLSBatch()
+#endif  // S52_USE_GL2
+
 static int       _fillArea(S57_geo *geo)
 {
     S57_prim *prim = S57_getPrimGeo(geo);
@@ -1925,6 +2005,258 @@ static int       _getVesselVector(S52_obj *obj, double *course, double *speed)
     return FALSE;
 }
 
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+// SY instancing - point symbol of a journal run drawn once per symbol (see S52_GL_beginSYInst())
+typedef struct _SYinst {
+    S52_DListData *DListData;  // symbol (ref)
+    GArray        *inst;       // GLfloat: x, y, rotation (rad) - one per placement
+} _SYinst;
+
+static gboolean    _SYinstOn   = FALSE;  // TRUE: _renderSY() collect placement
+static GHashTable *_SYinstHash = NULL;   // S52_DListData --> _SYinst
+static GPtrArray  *_SYinstList = NULL;   // _SYinst in first seen order
+static GArray     *_SYinstVert = NULL;   // pseudo-instancing: expanded vertex_t XYZ
+static GLuint      _vboSYinstID = 0;     // stream VBO - instance or expanded vertex
+static guint       _nSYinstDraw = 0;     // glDraw*() of SY instancing
+
+static void      _freeSYinst(gpointer data)
+{
+    _SYinst *si = (_SYinst *)data;
+
+    g_array_free(si->inst, TRUE);
+    g_free(si);
+
+    return;
+}
+
+static int       _isSYinstValid(S52_DListData *DListData)
+// symbol that can be placed by a single transform (no _TRANSLATE)
+{
+    for (guint i=0; i<DListData->nbr; ++i) {
+        guint j     = 0;
+        GLint mode  = 0;
+        GLint first = 0;
+        GLint count = 0;
+
+        if (NULL == DListData->prim[i])
+            return FALSE;
+
+        while (TRUE == S57_getPrimIdx(DListData->prim[i], j++, &mode, &first, &count)) {
+            switch (mode) {
+                case GL_POINTS:
+                case GL_LINES:
+                case GL_LINE_STRIP:
+                case GL_LINE_LOOP:
+                case GL_TRIANGLES:
+                case GL_TRIANGLE_STRIP:
+                case GL_TRIANGLE_FAN:
+                    break;
+                default:
+                    return FALSE;
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+static int       _addSYinst(S52_obj *obj, double x, double y, double rotation)
+// return FALSE if this placement must be drawn now by _renderSY_POINT_T()
+{
+    if (FALSE == _SYinstOn)
+        return FALSE;
+
+    // debug - filter at GL level in _glCallList()
+    if (S52_CMD_WRD_FILTER_SY & (int) S52_MP_get(S52_CMD_WRD_FILTER))
+        return FALSE;
+
+    if (TRUE == S57_getHighlight(S52_PL_getGeo(obj)))
+        return FALSE;
+
+    S52_DListData *DListData = S52_PL_getDListData(obj);
+    if ((NULL==DListData) || (0==DListData->nbr) || (MAX_SUBLIST<DListData->nbr))
+        return FALSE;
+
+    _SYinst *si = (_SYinst *)g_hash_table_lookup(_SYinstHash, DListData);
+    if (NULL == si) {
+        if (FALSE == _isSYinstValid(DListData))
+            return FALSE;
+
+        si            = g_new0(_SYinst, 1);
+        si->DListData = DListData;
+        si->inst      = g_array_new(FALSE, FALSE, sizeof(GLfloat));
+        g_hash_table_insert(_SYinstHash, DListData, si);
+        g_ptr_array_add(_SYinstList, si);
+    }
+
+    GLfloat p[3] = {(GLfloat) x, (GLfloat) y, (GLfloat) (rotation * DEG_TO_RAD)};
+    g_array_append_vals(si->inst, p, 3);
+
+    return TRUE;
+}
+
+static void      _drawSYinstanced(_SYinst *si, double sx, double sy)
+// one glDrawArraysInstanced() per primitive - placement done in the vertex shader
+{
+    S52_DListData *DListData = si->DListData;
+    guint          nInst     = si->inst->len / 3;
+
+    glBindBuffer(GL_ARRAY_BUFFER, _vboSYinstID);
+    glBufferData(GL_ARRAY_BUFFER, si->inst->len*sizeof(GLfloat), (const void *)si->inst->data, GL_STREAM_DRAW);
+    glEnableVertexAttribArray(_aInst);
+    glVertexAttribPointer(_aInst, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    _glVertexAttribDivisor(_aInst, 1);
+
+    glUniform1i(_uInstOn, 1);
+    glUniform2f(_uInstScale, (GLfloat) sx, (GLfloat) -sy);
+
+    for (guint i=0; i<DListData->nbr; ++i) {
+        _setFragAttrib(&DListData->colors[i], FALSE);
+
+        glBindBuffer(GL_ARRAY_BUFFER, DListData->vboIds[i]);
+        glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+        guint j     = 0;
+        GLint mode  = 0;
+        GLint first = 0;
+        GLint count = 0;
+        while (TRUE == S57_getPrimIdx(DListData->prim[i], j++, &mode, &first, &count)) {
+            _glDrawArraysInstanced(mode, first, count, nInst);
+            ++_nSYinstDraw;
+            ++_nDrawCall;
+            _nDrawVert += count * nInst;
+        }
+    }
+
+    glUniform1i(_uInstOn, 0);
+    _glVertexAttribDivisor(_aInst, 0);
+    glDisableVertexAttribArray(_aInst);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    return;
+}
+
+static void      _addSYinstVert(GArray *dst, vertex_t *v, double X, double Y, double *m)
+// place vertex v at X,Y - m: 2x2 rotation / scale / flip Y (row major)
+{
+    vertex_t p[3] = {
+        (vertex_t) (X + m[0]*v[0] + m[1]*v[1]),
+        (vertex_t) (Y + m[2]*v[0] + m[3]*v[1]),
+        v[2]
+    };
+
+    g_array_append_vals(dst, p, 3);
+
+    return;
+}
+
+static void      _addSYinstPrim(GArray *dst, guint k, S57_prim *prim, double X, double Y, double *m)
+// expand the primitive of class k (0: triangle, 1: line, 2: point) of prim in
+// GL_TRIANGLES / GL_LINES / GL_POINTS placed at X,Y (strip, fan and loop are unrolled)
+{
+    vertex_t *v     = (vertex_t *)S57_getPrimVertex(prim)->data;
+    guint     j     = 0;
+    GLint     mode  = 0;
+    GLint     first = 0;
+    GLint     count = 0;
+
+    while (TRUE == S57_getPrimIdx(prim, j++, &mode, &first, &count)) {
+        if ((0==k) && (GL_TRIANGLES==mode)) {
+            for (GLint t=first; t<first+count; ++t)
+                _addSYinstVert(dst, v+t*3, X, Y, m);
+        }
+        if ((0==k) && (GL_TRIANGLE_STRIP==mode || GL_TRIANGLE_FAN==mode)) {
+            for (GLint t=first+2; t<first+count; ++t) {
+                _addSYinstVert(dst, v+((GL_TRIANGLE_FAN==mode) ? first : t-2)*3, X, Y, m);
+                _addSYinstVert(dst, v+(t-1)*3, X, Y, m);
+                _addSYinstVert(dst, v+t*3,     X, Y, m);
+            }
+        }
+        if ((1==k) && (GL_LINES==mode)) {
+            for (GLint t=first; t<first+count; ++t)
+                _addSYinstVert(dst, v+t*3, X, Y, m);
+        }
+        if ((1==k) && (GL_LINE_STRIP==mode || GL_LINE_LOOP==mode)) {
+            for (GLint t=first+1; t<first+count; ++t) {
+                _addSYinstVert(dst, v+(t-1)*3, X, Y, m);
+                _addSYinstVert(dst, v+t*3,     X, Y, m);
+            }
+            if ((GL_LINE_LOOP==mode) && (2<count)) {
+                _addSYinstVert(dst, v+(first+count-1)*3, X, Y, m);
+                _addSYinstVert(dst, v+first*3,           X, Y, m);
+            }
+        }
+        if ((2==k) && (GL_POINTS==mode)) {
+            for (GLint t=first; t<first+count; ++t)
+                _addSYinstVert(dst, v+t*3, X, Y, m);
+        }
+    }
+
+    return;
+}
+
+static void      _drawSYrange(S52_DListData *DListData, GLint range[][3][2], gboolean highlight)
+// draw expanded symbol from the bound VBO - one glDrawArrays() per sub-list and primitive class
+{
+    GLenum mode[3] = {GL_TRIANGLES, GL_LINES, GL_POINTS};
+
+    glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+    for (guint i=0; i<DListData->nbr; ++i) {
+        _setFragAttrib(&DListData->colors[i], highlight);
+
+        for (guint k=0; k<3; ++k) {
+            if (0 == range[i][k][1])
+                continue;
+
+            glDrawArrays(mode[k], range[i][k][0], range[i][k][1]);
+            ++_nSYinstDraw;
+        }
+    }
+
+    return;
+}
+
+static void      _drawSYpseudo(_SYinst *si, double sx, double sy)
+// pseudo-instancing: expand every placement in one stream VBO,
+// then one glDrawArrays() per sub-list and primitive class (triangle, line, point)
+{
+    S52_DListData *DListData = si->DListData;
+    guint          nInst     = si->inst->len / 3;
+    GLfloat       *inst      = (GLfloat *)si->inst->data;
+    GLint          range[MAX_SUBLIST][3][2];  // [sublist][GL_TRIANGLES,GL_LINES,GL_POINTS][first,count]
+
+    g_array_set_size(_SYinstVert, 0);
+
+    for (guint i=0; i<DListData->nbr; ++i) {
+        for (guint k=0; k<3; ++k) {
+            range[i][k][0] = _SYinstVert->len / 3;
+
+            for (guint n=0; n<nInst; ++n) {
+                GLfloat *in = inst + n*3;
+                double   c  = cos(in[2]);
+                double   s  = sin(in[2]);
+                // same transform as _renderSY_POINT_T()
+                double   m[4] = {sx*c, -sx*s, -sy*s, -sy*c};
+
+                _addSYinstPrim(_SYinstVert, k, DListData->prim[i], in[0], in[1], m);
+            }
+
+            range[i][k][1] = _SYinstVert->len / 3 - range[i][k][0];
+        }
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, _vboSYinstID);
+    glBufferData(GL_ARRAY_BUFFER, _SYinstVert->len*sizeof(vertex_t), (const void *)_SYinstVert->data, GL_STREAM_DRAW);
+
+    _drawSYrange(DListData, range, FALSE);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    return;
+}
+#endif  // S52_USE_GL2 && !S52_USE_GLSC2
+
 static int       _renderSY_POINT_T(S52_obj *obj, double x, double y, double rotation)
 {
     S52_DListData *DListData = S52_PL_getDListData(obj);
@@ -2694,6 +3026,10 @@ static int       _renderSY(S52_obj *obj)
         // all other point sym
         // FIXME: chart rotation - some should not rotate, like cardinal buoy BOYCAR - check chart
         //_renderSY_POINT_T(obj, ppt[0], ppt[1], orient+_north);  // CIP wrong
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+        if (TRUE == _addSYinst(obj, ppt[0], ppt[1], orient))
+            return TRUE;
+#endif
         _renderSY_POINT_T(obj, ppt[0], ppt[1], orient);           // CIP ok - buoy rotate
 
         return TRUE;
@@ -2910,12 +3246,35 @@ static int       _renderSY(S52_obj *obj)
     return FALSE;
 }
 
+// id of attribute read at each render - interned once
+static gsize     _attIDinit = 0;
+static S57_AttID _ORIENT    = 0;
+static S57_AttID _SECTR1    = 0;
+static S57_AttID _SECTR2    = 0;
+
+static int       _initAttID(void)
+{
+    if (g_once_init_enter(&_attIDinit)) {
+        _ORIENT = S57_getAttID("ORIENT");
+        _SECTR1 = S57_getAttID("SECTR1");
+        _SECTR2 = S57_getAttID("SECTR2");
+        g_once_init_leave(&_attIDinit, 1);
+    }
+
+    return TRUE;
+}
+
 static int       _renderLS_LIGHTS05(S52_obj *obj)
 {
+    _initAttID();
+
     S57_geo *geo       = S52_PL_getGeo(obj);
-    GString *orientstr = S57_getAttVal(geo, "ORIENT");
-    GString *sectr1str = S57_getAttVal(geo, "SECTR1");
-    GString *sectr2str = S57_getAttVal(geo, "SECTR2");
+    double   orient    = 0.0;
+    double   sectr1    = 0.0;
+    double   sectr2    = 0.0;
+    gboolean hasOrient = S57_getAttReal(geo, _ORIENT, &orient);
+    gboolean hasSectr1 = S57_getAttReal(geo, _SECTR1, &sectr1);
+    gboolean hasSectr2 = S57_getAttReal(geo, _SECTR2, &sectr2);
     // FIXME:  * 100.0
     double   leglenpix = 25.0 / S52_MP_get(S52_MAR_DOTPITCH_MM_X);
 
@@ -2935,8 +3294,8 @@ static int       _renderLS_LIGHTS05(S52_obj *obj)
     {
         double orientA = -1;  // sync with 'no orient' value in getSYorient()
         double orientB = S52_PL_getSYorient(obj);
-        if (NULL != orientstr) {
-            orientA = S52_atof(orientstr->str);
+        if (TRUE == hasOrient) {
+            orientA = orient;
         }
         if (orientA != orientB) {
             PRINTF("orientA != orientB A:%f, B:%f\n", orientA, orientB);
@@ -2986,9 +3345,7 @@ static int       _renderLS_LIGHTS05(S52_obj *obj)
         }
     }
 
-    if (NULL != orientstr) {
-        double orient = S52_atof(orientstr->str);
-
+    if (TRUE == hasOrient) {
         _glLoadIdentity(GL_MODELVIEW);
 
         _glTranslated(ppt[0], ppt[1], 0.0);
@@ -3007,9 +3364,7 @@ static int       _renderLS_LIGHTS05(S52_obj *obj)
 
     }
 
-    if (NULL != sectr1str) {
-        double sectr1 = S52_atof(sectr1str->str);
-
+    if (TRUE == hasSectr1) {
         _glLoadIdentity(GL_MODELVIEW);
 
         _glTranslated(ppt[0], ppt[1], 0.0);
@@ -3029,9 +3384,7 @@ static int       _renderLS_LIGHTS05(S52_obj *obj)
 
     }
 
-    if (NULL != sectr2str) {
-        double sectr2 = S52_atof(sectr2str->str);
-
+    if (TRUE == hasSectr2) {
         _glLoadIdentity(GL_MODELVIEW);
 
         _glTranslated(ppt[0], ppt[1], 0.0);
@@ -3379,6 +3732,22 @@ static int       _renderLS_afterglow(S52_obj *obj)
 }
 #endif  // S52_USE_AFGLOW
 
+#define LOD_ERR_PIX 1.0   // max error (pixel) of the simplified line
+
+static guint     _getLOD(void)
+// coarsest LOD that stay under LOD_ERR_PIX at this scale - pick use the geo as is
+{
+    guint lod = 0;
+
+    if (S52_GL_DRAW != _crnt_GL_cycle)
+        return 0;
+
+    while ((lod+1 < S57_LOD_NUM) && (S57_getLODtol(lod+1) <= LOD_ERR_PIX * _scalex))
+        ++lod;
+
+    return lod;
+}
+
 static int       _renderLS(S52_obj *obj)
 // Line Style
 // FIXME: GL1 is immediate but not GL2 - load vertex on GPU
@@ -3390,6 +3759,11 @@ static int       _renderLS(S52_obj *obj)
     if (S52_CMD_WRD_FILTER_LS & (int) S52_MP_get(S52_CMD_WRD_FILTER))
         return TRUE;
 
+#ifdef S52_USE_GL2
+    if (TRUE == _LSbatchOn)
+        return TRUE;
+#endif
+
     // COALNE 459
     /* DEPCNT 537
     if (459 == S57_getS57ID(S52_PL_getGeo(obj))) {
@@ -3492,7 +3866,7 @@ static int       _renderLS(S52_obj *obj)
                     // FIX: one more call to fillarea()
                     GLdouble *ppt     = NULL;
                     guint     npt     = 0;
-                    S57_getGeoData(geo, 0, &npt, &ppt);
+                    S57_getGeoDataLOD(geo, 0, _getLOD(), &npt, &ppt);
 
                     // get the current number of positon (this grow as GPS/AIS pos come in)
                     if (0 == g_strcmp0("pastrk", S57_getName(geo))) {
@@ -3686,6 +4060,56 @@ static int       _movePoint(double *x, double *y, double angle, double dist_m)
     return TRUE;
 }
 
+static int       _getLCseg(S52_obj *obj, pt3 *p1, pt3 *p2)
+// segment of LC - return FALSE if suppressed (overlap)
+{
+    S57_geo *geo = S52_PL_getGeo(obj);
+
+    //////////////////////////////////////////////////////
+    //
+    // overlapping Line Complex (LC) suppression
+    //
+    if (-S57_OVERLAP_GEO_Z==p1->z && -S57_OVERLAP_GEO_Z==p2->z) {
+        //PRINTF("NOTE: this line segment (%s) overlap a line segment with higher prioritity (Z=%f)\n", S57_getName(geo), z1);
+        return FALSE;
+    }
+    /////////////////////////////////////////////////////
+
+
+    //*
+    // do not draw the rest of leglin if arc drawn
+    if (0 == g_strcmp0("leglin", S57_getName(geo))) {
+        if (2.0==S52_MP_get(S52_MAR_DISP_WHOLIN) || 3.0==S52_MP_get(S52_MAR_DISP_WHOLIN)) {
+            // shorten x1,y1 of wholin_dist of previous leglin
+            //GLdouble segangRAD  = atan2(y2-y1, x2-x1);
+            GLdouble segangRAD  = atan2(p2->y-p1->y, p2->x-p1->x);
+            S52_obj *objPrevLeg = S52_PL_getPrevLeg(obj);
+            S57_geo *geoPrev    = S52_PL_getGeo(objPrevLeg);
+            GString *prev_wholin_diststr = S57_getAttVal(geoPrev, "_wholin_dist");
+            if (NULL != prev_wholin_diststr) {
+                double prev_wholin_dist = S52_atof(prev_wholin_diststr->str) * NM_METER;
+                //_movePoint(&x1, &y1, segangRAD + (180.0 * DEG_TO_RAD), prev_wholin_dist);
+                _movePoint(&p1->x, &p1->y, segangRAD + (180.0 * DEG_TO_RAD), prev_wholin_dist);
+            }
+
+            // shorten x2,y2 if there is a next curve
+            S52_obj *objNextLeg = S52_PL_getNextLeg(obj);
+            if (NULL != objNextLeg) {
+                GString *wholin_diststr = S57_getAttVal(geo, "_wholin_dist");
+                if (NULL != wholin_diststr) {
+                    double wholin_dist = S52_atof(wholin_diststr->str) * NM_METER;
+                    //_movePoint(&x2, &y2, segangRAD, wholin_dist);
+                    _movePoint(&p2->x, &p2->y, segangRAD, wholin_dist);
+                }
+
+            }
+        }
+    }
+    //*/
+
+    return TRUE;
+}
+
 static int       _renderLCring(S52_obj *obj, guint ringNo, double symlen_wrld)
 {
     g_array_set_size(_tmpWorkBuffer, 0);
@@ -3706,47 +4130,8 @@ static int       _renderLCring(S52_obj *obj, guint ringNo, double symlen_wrld)
         p1 = *ppt++;
         p2 = *ppt;
 
-        //////////////////////////////////////////////////////
-        //
-        // overlapping Line Complex (LC) suppression
-        //
-        if (-S57_OVERLAP_GEO_Z==p1.z && -S57_OVERLAP_GEO_Z==p2.z) {
-            //PRINTF("NOTE: this line segment (%s) overlap a line segment with higher prioritity (Z=%f)\n", S57_getName(geo), z1);
+        if (FALSE == _getLCseg(obj, &p1, &p2))
             continue;
-        }
-        /////////////////////////////////////////////////////
-
-
-        //*
-        // do not draw the rest of leglin if arc drawn
-        if (0 == g_strcmp0("leglin", S57_getName(geo))) {
-            if (2.0==S52_MP_get(S52_MAR_DISP_WHOLIN) || 3.0==S52_MP_get(S52_MAR_DISP_WHOLIN)) {
-                // shorten x1,y1 of wholin_dist of previous leglin
-                //GLdouble segangRAD  = atan2(y2-y1, x2-x1);
-                GLdouble segangRAD  = atan2(p2.y-p1.y, p2.x-p1.x);
-                S52_obj *objPrevLeg = S52_PL_getPrevLeg(obj);
-                S57_geo *geoPrev    = S52_PL_getGeo(objPrevLeg);
-                GString *prev_wholin_diststr = S57_getAttVal(geoPrev, "_wholin_dist");
-                if (NULL != prev_wholin_diststr) {
-                    double prev_wholin_dist = S52_atof(prev_wholin_diststr->str) * NM_METER;
-                    //_movePoint(&x1, &y1, segangRAD + (180.0 * DEG_TO_RAD), prev_wholin_dist);
-                    _movePoint(&p1.x, &p1.y, segangRAD + (180.0 * DEG_TO_RAD), prev_wholin_dist);
-                }
-
-                // shorten x2,y2 if there is a next curve
-                S52_obj *objNextLeg = S52_PL_getNextLeg(obj);
-                if (NULL != objNextLeg) {
-                    GString *wholin_diststr = S57_getAttVal(geo, "_wholin_dist");
-                    if (NULL != wholin_diststr) {
-                        double wholin_dist = S52_atof(wholin_diststr->str) * NM_METER;
-                        //_movePoint(&x2, &y2, segangRAD, wholin_dist);
-                        _movePoint(&p2.x, &p2.y, segangRAD, wholin_dist);
-                    }
-
-                }
-            }
-        }
-        //*/
 
         //if (FALSE == _clipToView(&x1, &y1, &x2, &y2))
         if (FALSE == _clipToView(&p1.x, &p1.y, &p2.x, &p2.y))
@@ -3817,84 +4202,296 @@ static int       _renderLCring(S52_obj *obj, guint ringNo, double symlen_wrld)
     return TRUE;
 }
 
-static int       _drawArc(S52_obj *objA, S52_obj *objB);  // forward decl
-static int       _renderLC(S52_obj *obj)
-// Line Complex (AREA, LINE)
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+// LC batch - symbol placement of all ring expanded in one VBO (see _renderLCbatch())
+#define LC_CACHE_MAX 8192  // max symbol placement of a whole obj kept in its cache
+
+typedef struct _LCcache {
+    S52_DListData *DListData;             // symbol of the expansion (obj can have many LC)
+    double  symlen_wrld;                  // scale of the expansion (X)
+    double  scaley;                       // scale of the expansion (Y)
+    GArray *vert;                         // vertex_t XYZ - expanded symbol
+    GLint   range[MAX_SUBLIST][3][2];     // [sublist][GL_TRIANGLES,GL_LINES,GL_POINTS][first,count]
+    GArray *ending;                       // pt3v GL_LINES - rest of segment after the last symbol
+    GLuint  vboID;                        // 0: not cached - use _vboSYinstID
+} _LCcache;
+
+static GHashTable *_LCcacheHash = NULL;   // S52_obj --> _LCcache
+static _LCcache    _LCtmp       = {NULL, 0.0, 0.0, NULL, {{{0}}}, NULL, 0};   // expansion of clipped obj
+static GArray     *_LCwork[MAX_SUBLIST][3];                        // expansion by sublist / class
+
+static void      _freeLCcache(gpointer data)
 {
-#ifdef S52_USE_GV
-    return FALSE;
-#endif
+    _LCcache *lc = (_LCcache *)data;
 
+    g_array_free(lc->vert,   TRUE);
+    g_array_free(lc->ending, TRUE);
+    if (0 != lc->vboID)
+        glDeleteBuffers(1, &lc->vboID);
+    g_free(lc);
 
-    /*
-        // FIXME: check invariant
-        {   // invariant: just to be sure that things don't explode
-            // the number of tile in pixel is proportional to the number
-            // of tile visible in world coordinate
-            GLdouble tileNbrX = (_vp[2] - _vp[0]) / tileWidthPix;
-            GLdouble tileNbrY = (_vp[3] - _vp[1]) / tileHeightPix;
-            GLdouble tileNbrU = (x2-x1) / w;
-            GLdouble tileNbrV = (y2-y1) / h;
-            // debug
-            //PRINTF("TX: %f TY: %f TU: %f TV: %f\n", tileNbrX,tileNbrY,tileNbrU,tileNbrV);
-            //PRINTF("WORLD: widht: %f height: %f tileW: %f tileH: %f\n", (x2-x1), (y2-y1), w, h);
-            //PRINTF("PIXEL: widht: %i height: %i tileW: %f tileH: %f\n", (_vp[2] - _vp[0]), (_vp[3] - _vp[1]), tileWidthPix, tileHeightPix);
-            if (tileNbrX + 4 < tileNbrU)
-                g_assert(0);
-            if (tileNbrY + 4 < tileNbrV)
-                g_assert(0);
-        }
-    */
+    return;
+}
 
-    if (S52_CMD_WRD_FILTER_LC & (int) S52_MP_get(S52_CMD_WRD_FILTER))
-        return TRUE;
+static guint     _getLCsymNbr(S52_obj *obj, double symlen_wrld)
+// upper bound of symbol placement for the whole obj
+{
+    S57_geo *geo  = S52_PL_getGeo(obj);
+    guint    rNbr = S57_getRingNbr(geo);
+    double   len  = 0.0;
+
+    for (guint r=0; r<rNbr; ++r) {
+        pt3  *ppt = NULL;
+        guint npt = 0;
+        if (FALSE == S57_getGeoData(geo, r, &npt, (double**)&ppt))
+            continue;
 
-    S57_geo *geo = S52_PL_getGeo(obj);
-    // draw arc if this is a leglin
-    if (0 == g_strcmp0("leglin", S57_getName(geo))) {
-        // check if user want to display arc
-        if ((2.0==S52_MP_get(S52_MAR_DISP_WHOLIN)) || (3.0==S52_MP_get(S52_MAR_DISP_WHOLIN))) {
-            S52_obj *objNextLeg = S52_PL_getNextLeg(obj);
+        for (guint i=1; i<npt; ++i)
+            len += sqrt(pow(ppt[i].x-ppt[i-1].x, 2) + pow(ppt[i].y-ppt[i-1].y, 2));
+    }
 
-            if (NULL != objNextLeg)
-                _drawArc(obj, objNextLeg);
-        }
+    return (guint) (len / symlen_wrld);
+}
 
-        //* draw guard zone if highligthed
-        // FIXME: what about arc!
-        //if (TRUE == S57_isHighlighted(geo)) {
-        if (TRUE == S57_getHighlight(geo)) {
-            _glLoadIdentity(GL_MODELVIEW);
+static int       _buildLC(S52_obj *obj, double symlen_wrld, gboolean clip, _LCcache *lc)
+// same placement as _renderLCring() for all ring, without the per symbol draw
+{
+    S57_geo       *geo       = S52_PL_getGeo(obj);
+    S52_DListData *DListData = S52_PL_getDListData(obj);
+    double         sx        = _scalex / (S52_MP_get(S52_MAR_DOTPITCH_MM_X) * 100.0);
+    double         sy        = _scaley / (S52_MP_get(S52_MAR_DOTPITCH_MM_Y) * 100.0);
 
-#ifdef S52_USE_GL2
-            glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
-#endif
-            _DrawArrays_LINE_STRIP(5, _hazardZone);
+    for (guint i=0; i<DListData->nbr; ++i) {
+        for (guint k=0; k<3; ++k) {
+            if (NULL == _LCwork[i][k])
+                _LCwork[i][k] = g_array_new(FALSE, FALSE, sizeof(vertex_t));
+            g_array_set_size(_LCwork[i][k], 0);
         }
-        //*/
     }
+    g_array_set_size(lc->ending, 0);
 
-    // set pen color & size here because values might not
-    // be set via call list --short line
-    S52_DListData *DListData = S52_PL_getDListData(obj);
-    S52_Color     *c         = DListData->colors;
-    _setFragAttrib(c, S57_getHighlight(geo));
-
-    GLdouble symlen = 0.0;
-    char     pen_w  = 0;
-    S52_PL_getLCdata(obj, &symlen, &pen_w);
-    _glLineWidth(pen_w - '0');
-    //_glLineWidth(pen_w - '0' + 0.375);
+    guint rNbr = S57_getRingNbr(geo);
+    for (guint r=0; r<rNbr; ++r) {
+        pt3  *ppt = NULL;
+        guint npt = 0;
+        if (FALSE == S57_getGeoData(geo, r, &npt, (double**)&ppt))
+            continue;
 
-    GLdouble symlen_pixl = symlen / (S52_MP_get(S52_MAR_DOTPITCH_MM_X) * 100.0);
-    GLdouble symlen_wrld = symlen_pixl * _scalex;
+        for (guint i=1; i<npt; ++i) {
+            pt3 p1 = ppt[i-1];
+            pt3 p2 = ppt[i];
 
-    guint rNbr = S57_getRingNbr(geo);
-    for (guint i=0; i<rNbr; ++i) {
-        _renderLCring(obj, i, symlen_wrld);
-    }
+            if (FALSE == _getLCseg(obj, &p1, &p2))
+                continue;
 
-    //_setBlend(FALSE);
+            if ((TRUE==clip) && (FALSE==_clipToView(&p1.x, &p1.y, &p2.x, &p2.y)))
+                continue;
+
+            double seglen_wrld   = sqrt(pow(p1.x-p2.x, 2) + pow(p1.y-p2.y, 2));
+            double segang        = atan2(p2.y-p1.y, p2.x-p1.x);
+            double c             = cos(segang);
+            double s             = sin(segang);
+            double symlen_wrld_x = c * symlen_wrld;
+            double symlen_wrld_y = s * symlen_wrld;
+            int    nsym          = (int) (seglen_wrld / symlen_wrld);
+            // same transform as _renderLCring() - rotate, flip Y, scale to pixel
+            double m[4]          = {c*sx, s*sy, s*sx, -c*sy};
+
+            for (int j=0; j<nsym; ++j) {
+                for (guint d=0; d<DListData->nbr; ++d) {
+                    for (guint k=0; k<3; ++k) {
+                        _addSYinstPrim(_LCwork[d][k], k, DListData->prim[d],
+                                       p1.x + j*symlen_wrld_x, p1.y + j*symlen_wrld_y, m);
+                    }
+                }
+            }
+
+            pt3v pt[2] = {{p1.x+nsym*symlen_wrld_x, p1.y+nsym*symlen_wrld_y, p1.z}, {p2.x, p2.y, p2.z}};
+            g_array_append_vals(lc->ending, pt, 2);
+        }
+    }
+
+    // concat sublist / class
+    g_array_set_size(lc->vert, 0);
+    for (guint i=0; i<DListData->nbr; ++i) {
+        for (guint k=0; k<3; ++k) {
+            lc->range[i][k][0] = lc->vert->len / 3;
+            lc->range[i][k][1] = _LCwork[i][k]->len / 3;
+            g_array_append_vals(lc->vert, _LCwork[i][k]->data, _LCwork[i][k]->len);
+        }
+    }
+    lc->DListData   = DListData;
+    lc->symlen_wrld = symlen_wrld;
+    lc->scaley      = _scaley;
+
+    return TRUE;
+}
+
+static int       _renderLCbatch(S52_obj *obj, double symlen_wrld)
+// LC symbol of all ring in one glDrawArrays() per sub-list and primitive class
+// ENC obj (static geo) keep its expansion, of the whole obj, in a VBO until the scale change
+// return FALSE if symbol can't be expanded - use _renderLCring()
+{
+    S57_geo       *geo       = S52_PL_getGeo(obj);
+    S52_DListData *DListData = S52_PL_getDListData(obj);
+
+    if ((NULL==DListData) || (0==DListData->nbr) || (MAX_SUBLIST<DListData->nbr))
+        return FALSE;
+
+    if (FALSE == _isSYinstValid(DListData))
+        return FALSE;
+
+    if (NULL == _LCcacheHash) {
+        _LCcacheHash = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, _freeLCcache);
+        _LCtmp.vert   = g_array_new(FALSE, FALSE, sizeof(vertex_t));
+        _LCtmp.ending = g_array_new(FALSE, FALSE, sizeof(pt3v));
+    }
+    if (0 == _vboSYinstID)
+        glGenBuffers(1, &_vboSYinstID);
+
+    // mariner obj (lower case name) can move
+    const char *name = S57_getName(geo);
+    _LCcache   *lc   = NULL;
+    if ((NULL!=name) && g_ascii_isupper(name[0])) {
+        lc = (_LCcache *)g_hash_table_lookup(_LCcacheHash, obj);
+        if ((NULL==lc) || (DListData!=lc->DListData) || (symlen_wrld!=lc->symlen_wrld) || (_scaley!=lc->scaley)) {
+            if (LC_CACHE_MAX < _getLCsymNbr(obj, symlen_wrld)) {
+                g_hash_table_remove(_LCcacheHash, obj);
+                lc = NULL;
+            } else {
+                if (NULL == lc) {
+                    lc         = g_new0(_LCcache, 1);
+                    lc->vert   = g_array_new(FALSE, FALSE, sizeof(vertex_t));
+                    lc->ending = g_array_new(FALSE, FALSE, sizeof(pt3v));
+                    glGenBuffers(1, &lc->vboID);
+                    g_hash_table_insert(_LCcacheHash, obj, lc);
+                }
+
+                _buildLC(obj, symlen_wrld, FALSE, lc);
+
+                glBindBuffer(GL_ARRAY_BUFFER, lc->vboID);
+                glBufferData(GL_ARRAY_BUFFER, lc->vert->len*sizeof(vertex_t), (const void *)lc->vert->data, GL_STATIC_DRAW);
+            }
+        }
+    }
+
+    if (NULL == lc) {
+        lc = &_LCtmp;
+        _buildLC(obj, symlen_wrld, TRUE, lc);
+
+        glBindBuffer(GL_ARRAY_BUFFER, _vboSYinstID);
+        glBufferData(GL_ARRAY_BUFFER, lc->vert->len*sizeof(vertex_t), (const void *)lc->vert->data, GL_STREAM_DRAW);
+    } else {
+        glBindBuffer(GL_ARRAY_BUFFER, lc->vboID);
+    }
+
+    // set identity matrix
+    _glUniformMatrix4fv_uModelview();
+    glEnableVertexAttribArray(_aPosition);
+
+    // see _glCallList()
+    glDisable(GL_CULL_FACE);
+
+    // Note: like _glCallList(), all sub-list set their fragment attribute when a symbol fit
+    if (0 < lc->vert->len)
+        _drawSYrange(DListData, lc->range, S57_getHighlight(geo));
+
+    glEnable(GL_CULL_FACE);
+    glDisableVertexAttribArray(_aPosition);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // render all lines ending
+    _DrawArrays_LINES(lc->ending->len, (vertex_t*)lc->ending->data);
+
+    _checkError("_renderLCbatch()");
+
+    return TRUE;
+}
+#endif  // S52_USE_GL2 && !S52_USE_GLSC2
+
+static int       _drawArc(S52_obj *objA, S52_obj *objB);  // forward decl
+static int       _renderLC(S52_obj *obj)
+// Line Complex (AREA, LINE)
+{
+#ifdef S52_USE_GV
+    return FALSE;
+#endif
+
+
+    /*
+        // FIXME: check invariant
+        {   // invariant: just to be sure that things don't explode
+            // the number of tile in pixel is proportional to the number
+            // of tile visible in world coordinate
+            GLdouble tileNbrX = (_vp[2] - _vp[0]) / tileWidthPix;
+            GLdouble tileNbrY = (_vp[3] - _vp[1]) / tileHeightPix;
+            GLdouble tileNbrU = (x2-x1) / w;
+            GLdouble tileNbrV = (y2-y1) / h;
+            // debug
+            //PRINTF("TX: %f TY: %f TU: %f TV: %f\n", tileNbrX,tileNbrY,tileNbrU,tileNbrV);
+            //PRINTF("WORLD: widht: %f height: %f tileW: %f tileH: %f\n", (x2-x1), (y2-y1), w, h);
+            //PRINTF("PIXEL: widht: %i height: %i tileW: %f tileH: %f\n", (_vp[2] - _vp[0]), (_vp[3] - _vp[1]), tileWidthPix, tileHeightPix);
+            if (tileNbrX + 4 < tileNbrU)
+                g_assert(0);
+            if (tileNbrY + 4 < tileNbrV)
+                g_assert(0);
+        }
+    */
+
+    if (S52_CMD_WRD_FILTER_LC & (int) S52_MP_get(S52_CMD_WRD_FILTER))
+        return TRUE;
+
+    S57_geo *geo = S52_PL_getGeo(obj);
+    // draw arc if this is a leglin
+    if (0 == g_strcmp0("leglin", S57_getName(geo))) {
+        // check if user want to display arc
+        if ((2.0==S52_MP_get(S52_MAR_DISP_WHOLIN)) || (3.0==S52_MP_get(S52_MAR_DISP_WHOLIN))) {
+            S52_obj *objNextLeg = S52_PL_getNextLeg(obj);
+
+            if (NULL != objNextLeg)
+                _drawArc(obj, objNextLeg);
+        }
+
+        //* draw guard zone if highligthed
+        // FIXME: what about arc!
+        //if (TRUE == S57_isHighlighted(geo)) {
+        if (TRUE == S57_getHighlight(geo)) {
+            _glLoadIdentity(GL_MODELVIEW);
+
+#ifdef S52_USE_GL2
+            glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
+#endif
+            _DrawArrays_LINE_STRIP(5, _hazardZone);
+        }
+        //*/
+    }
+
+    // set pen color & size here because values might not
+    // be set via call list --short line
+    S52_DListData *DListData = S52_PL_getDListData(obj);
+    S52_Color     *c         = DListData->colors;
+    _setFragAttrib(c, S57_getHighlight(geo));
+
+    GLdouble symlen = 0.0;
+    char     pen_w  = 0;
+    S52_PL_getLCdata(obj, &symlen, &pen_w);
+    _glLineWidth(pen_w - '0');
+    //_glLineWidth(pen_w - '0' + 0.375);
+
+    GLdouble symlen_pixl = symlen / (S52_MP_get(S52_MAR_DOTPITCH_MM_X) * 100.0);
+    GLdouble symlen_wrld = symlen_pixl * _scalex;
+
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    if (TRUE == _renderLCbatch(obj, symlen_wrld))
+        return TRUE;
+#endif
+
+    guint rNbr = S57_getRingNbr(geo);
+    for (guint i=0; i<rNbr; ++i) {
+        _renderLCring(obj, i, symlen_wrld);
+    }
+
+    //_setBlend(FALSE);
 
     // debug
     //glEnable(GL_BLEND);
@@ -3946,15 +4543,15 @@ static int       _renderAC_NODATA_layer0(void)
 static int       _renderAC_LIGHTS05(S52_obj *obj)
 // this code is specific to CS LIGHTS05
 {
+    _initAttID();
+
     S57_geo *geo       = S52_PL_getGeo(obj);
-    GString *sectr1str = S57_getAttVal(geo, "SECTR1");
-    GString *sectr2str = S57_getAttVal(geo, "SECTR2");
+    double   sectr1    = 0.0;
+    double   sectr2    = 0.0;
 
-    if ((NULL!=sectr1str) && (NULL!=sectr2str)) {
+    if ((TRUE==S57_getAttReal(geo, _SECTR1, &sectr1)) && (TRUE==S57_getAttReal(geo, _SECTR2, &sectr2))) {
         S52_Color *c         = S52_PL_getACdata(obj);
         S52_Color *black     = S52_PL_getColor("CHBLK");
-        GLdouble   sectr1    = S52_atof(sectr1str->str);
-        GLdouble   sectr2    = S52_atof(sectr2str->str);
         double     sweep     = (sectr1 > sectr2) ? sectr2-sectr1+360 : sectr2-sectr1;
         GString   *extradstr = S57_getAttVal(geo, "_extend_arc_radius");
         GLdouble   radius    = 0.0;
@@ -4167,6 +4764,12 @@ static int       _renderAC(S52_obj *obj)
 #endif  // 0
 
 
+#ifdef S52_USE_GL2
+    // allready drawn by S52_GL_drawACBatch()
+    if (TRUE == _ACbatchOn)
+        return TRUE;
+#endif
+
     _setFragAttrib(c, S57_getHighlight(geo));
 
     // FIXME: break cursor pick
@@ -4349,6 +4952,10 @@ static int       _renderAP(S52_obj *obj)
     //*/
 
 #ifdef S52_USE_GL2
+    // already drawn by _drawAPBatch()
+    if ((TRUE==_ACbatchOn) && (NULL!=_APbatchObj) && (NULL!=g_hash_table_lookup(_APbatchObj, obj)))
+        return TRUE;
+
     return _renderAP_gl2(obj);
 #endif
 #ifdef S52_USE_GL1
@@ -4381,6 +4988,100 @@ static int       _traceOP(S52_obj *obj)
     return TRUE;
 }
 
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2) && defined(S52_USE_FREETYPE_GL)
+// TXT batch: glyph of all text of obj of a frame (cell textList, drawLast) in one stream VBO,
+// drawn with one glDrawArrays() - freetype-gl has one atlas for all font size
+// Note: vertex is X Y Z S T (glyph in pixel, Z = colour index in palette) + anchor X Y rotation (aInst)
+#define TXT_VERT_SZ    8
+#define TXT_CACHE_MAX  4096    // glyph run cached - flushed when full (AIS label change often)
+
+typedef struct _TXTrun {
+    GArray *vert;              // _freetype_gl_vertex_t - string layout
+    double  strWpx;
+    double  strHpx;
+} _TXTrun;
+
+static gboolean    _TXTbatchOn    = FALSE;  // TRUE: _renderTXTAA() collect text of obj
+static GHashTable *_TXTrunHash    = NULL;   // "bsize:str" --> _TXTrun
+static GArray     *_TXTbatchVert  = NULL;   // GLfloat - TXT_VERT_SZ per vertex
+static GLuint      _vboTXTbatchID = 0;      // stream VBO
+
+static void      _freeTXTrun(gpointer data)
+{
+    _TXTrun *run = (_TXTrun *) data;
+
+    g_array_free(run->vert, TRUE);
+    g_free(run);
+}
+
+static _TXTrun  *_getTXTrun(const char *str, unsigned int bsize)
+// glyph layout of str - done once per (str, bsize)
+{
+    gchar   *key = g_strdup_printf("%u:%s", bsize, str);
+    _TXTrun *run = (_TXTrun *) g_hash_table_lookup(_TXTrunHash, key);
+    if (NULL != run) {
+        g_free(key);
+        return run;
+    }
+
+    if (TXT_CACHE_MAX <= g_hash_table_size(_TXTrunHash))
+        g_hash_table_remove_all(_TXTrunHash);
+
+    run       = g_new0(_TXTrun, 1);
+    run->vert = g_array_new(FALSE, FALSE, sizeof(_freetype_gl_vertex_t));
+    run->vert = _fill_freetype_gl_buffer(run->vert, str, bsize, &run->strWpx, &run->strHpx);
+
+    g_hash_table_insert(_TXTrunHash, key, run);
+
+    return run;
+}
+
+static int       _addTXTrun(_TXTrun *run, S52_Color *c, double x, double y)
+// same placement as _renderTXTAA_gl2() - text alway horizontal
+// Note: trans of text colour not used (as uColor.a in fragment shader)
+{
+    GLfloat z = (GLfloat) c->fragAtt.cidx;
+    GLfloat r = (GLfloat) (-_view.north * DEG_TO_RAD);
+    _freetype_gl_vertex_t *v = (_freetype_gl_vertex_t *) run->vert->data;
+
+    for (guint i=0; i<run->vert->len; ++i) {
+        GLfloat vert[TXT_VERT_SZ] = {v[i].x, v[i].y, z, v[i].s, v[i].t, (GLfloat) x, (GLfloat) y, r};
+        g_array_append_vals(_TXTbatchVert, vert, TXT_VERT_SZ);
+    }
+
+    return TRUE;
+}
+
+static int       _addTXTbatch(S52_obj *obj, S52_Color *color, double x, double y, unsigned int bsize, const char *str)
+// collect text of obj - same justification, shadow and highlight as _renderTXTAA()
+{
+    _TXTrun *run = _getTXTrun(str, bsize);
+    if (0 == run->vert->len)
+        return TRUE;
+
+    char hjust = '3';  // LEFT   (default)
+    char vjust = '1';  // BOTTOM (default)
+    if (S52_GL_DRAW == _crnt_GL_cycle) {
+        guint  len   = 0;
+        double dummy = 0.0;
+        S52_PL_getFreetypeGL_VBO(obj, &len, &dummy, &dummy, &hjust, &vjust);
+    }
+
+    _justifyTXTPos(run->strWpx, run->strHpx, hjust, vjust, &x, &y);
+
+#ifdef S52_USE_TXT_SHADOW
+    _addTXTrun(run, S52_PL_getColor("UIBCK"), x+_scalex, y-_scaley);
+#endif
+
+    if (TRUE == S57_getHighlight(S52_PL_getGeo(obj)))
+        color = S52_PL_getColor("DNGHL");
+
+    _addTXTrun(run, color, x, y);
+
+    return TRUE;
+}
+#endif  // S52_USE_GL2 && !S52_USE_GLSC2 && S52_USE_FREETYPE_GL
+
 //static int       _renderTXTAA(S52_obj *obj, S52_Color *color, double x, double y, unsigned int bsize, unsigned int weight, const char *str)
 static int       _renderTXTAA(S52_obj *obj, S52_Color *color, double x, double y, unsigned int bsize, const char *str)
 // render text in AA if Mar Param set
@@ -4432,6 +5133,12 @@ static int       _renderTXTAA(S52_obj *obj, S52_Color *color, double x, double y
         return FALSE;
     }
 
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2) && defined(S52_USE_FREETYPE_GL)
+    // drawn by S52_GL_endTextBatch()
+    if ((NULL!=obj) && (TRUE==_TXTbatchOn))
+        return _addTXTbatch(obj, color, x, y, bsize, str);
+#endif
+
 // ---- FREETYPE GL ----------------------------------------------------
 #ifdef S52_USE_FREETYPE_GL
 #ifdef S52_USE_GL2
@@ -5389,6 +6096,144 @@ int        S52_GL_isOFFview(S52_obj *obj)
     return FALSE;
 }
 
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+// GPU timer query: one query per run of display priority - queries can't nest
+// command word are timed only by batch draw (AC, AP, LS, SY instanced, TX), other go in _GPU_OTHER
+// so that the number of query is bound by the number of (cell, priority, batch) not of obj
+// result read GPU_NRING draw()/drawLast() later at most, never wait on the GPU
+#define GPU_NRING     8       // draw() / drawLast() in flight
+#define GPU_MAXQUERY  4096    // per draw() / drawLast() - more: no result for this one
+#define GPU_CMDQUERY  (GPU_MAXQUERY/2)  // past this, batch not timed apart (display priority only)
+
+typedef enum _GPUcmd {        // idx in S52_GL_gpuTimer.cmd_ms
+    _GPU_AC = 0,
+    _GPU_AP,
+    _GPU_LS,
+    _GPU_LC,
+    _GPU_SY,
+    _GPU_TX,
+    _GPU_OTHER                // raster, graticule, tile composite, ..
+} _GPUcmd;
+
+typedef struct _GPUquery {
+    GLuint id;
+    gint   slot;              // (prio+1) * S52_STATS_NCMD + cmd
+} _GPUquery;
+
+typedef struct _GPUframe {
+    guint   frame;
+    GArray *query;            // _GPUquery in issue order
+    int     ok;               // FALSE: overflow or disjoint - discard
+} _GPUframe;
+
+static _GPUframe _GPUring[GPU_NRING];
+static guint     _GPUhead  = 0;      // next frame issued
+static guint     _GPUtail  = 0;      // oldest frame in flight
+static GArray   *_GPUfree  = NULL;   // GLuint - query obj reused
+static int       _GPUon    = FALSE;  // TRUE: between S52_GL_beginGPUTimer() / S52_GL_endGPUTimer()
+static gint      _GPUslot  = -1;     // slot of the query running, -1: none
+static int       _GPUprio  = -1;     // display priority of the query running, -1: none
+
+static void      _GPUtimer(int prio, _GPUcmd cmd)
+// end the query running and begin one for (prio, cmd) - nothing if same
+{
+    if (FALSE == _GPUon)
+        return;
+
+    _GPUframe *f = &_GPUring[_GPUhead % GPU_NRING];
+    if (FALSE == f->ok)
+        return;
+
+    // too many batch run - keep the display priority time of this frame
+    if (GPU_CMDQUERY <= f->query->len)
+        cmd = _GPU_OTHER;
+
+    gint slot = (prio + 1) * S52_STATS_NCMD + cmd;
+    if (slot == _GPUslot)
+        return;
+
+    if (-1 != _GPUslot)
+        _glEndQuery(GL_TIME_ELAPSED_EXT);
+
+    if (GPU_MAXQUERY <= f->query->len) {
+        static int silent = FALSE;
+        if (FALSE == silent) {
+            PRINTF("WARNING: more than %i GPU timer query - no GPU time for this frame\n", GPU_MAXQUERY);
+            silent = TRUE;
+        }
+        f->ok     = FALSE;
+        _GPUslot  = -1;
+        return;
+    }
+
+    _GPUquery q = {0, slot};
+    if (0 < _GPUfree->len) {
+        q.id = g_array_index(_GPUfree, GLuint, _GPUfree->len-1);
+        g_array_set_size(_GPUfree, _GPUfree->len-1);
+    } else {
+        _glGenQueries(1, &q.id);
+    }
+    _glBeginQuery(GL_TIME_ELAPSED_EXT, q.id);
+    g_array_append_val(f->query, q);
+
+    _GPUslot = slot;
+    _GPUprio = prio;
+
+    return;
+}
+
+static void      _GPUtimerCmd(S52_obj *obj, S52_CmdWrd cmdWrd)
+// GPU timer of the display priority of obj (command word not drawn by a batch)
+// skip command drawn later by a batch - no query switch between obj of a batch run
+{
+    if (FALSE == _GPUon)
+        return;
+
+    switch (cmdWrd) {
+        case S52_CMD_ARE_CO:
+            if (TRUE == _ACbatchOn)
+                return;
+            break;
+        case S52_CMD_ARE_PA:
+            if ((TRUE==_ACbatchOn) && (NULL!=_APbatchObj) && (NULL!=g_hash_table_lookup(_APbatchObj, obj)))
+                return;
+            break;
+        case S52_CMD_SIM_LN:
+            if (TRUE == _LSbatchOn)
+                return;
+            break;
+        case S52_CMD_SYM_PT:
+            if (TRUE == _SYinstOn)
+                return;
+            break;
+        case S52_CMD_TXT_TX:
+        case S52_CMD_TXT_TE:
+#ifdef S52_USE_FREETYPE_GL
+            if (TRUE == _TXTbatchOn)
+                return;
+#endif
+            break;
+        default: break;
+    }
+
+    _GPUtimer(S52_PL_getDPRI(obj), _GPU_OTHER);
+
+    return;
+}
+
+static void      _GPUrecycle(_GPUframe *f)
+{
+    for (guint i=0; i<f->query->len; ++i)
+        g_array_append_val(_GPUfree, g_array_index(f->query, _GPUquery, i).id);
+    g_array_set_size(f->query, 0);
+
+    return;
+}
+#else   // S52_USE_GL2 && !S52_USE_GLSC2
+#define _GPUtimer(prio, cmd)
+#define _GPUtimerCmd(obj, cmdWrd)
+#endif  // S52_USE_GL2 && !S52_USE_GLSC2
+
 #ifdef S52_USE_GL2
 #ifdef S52_USE_RASTER
 static int       _udtTexture(S52_GL_ras *raster)
@@ -5481,6 +6326,8 @@ int        S52_GL_drawRaster(S52_GL_ras *raster)
         return TRUE;
     }
 
+    _GPUtimer(-1, _GPU_OTHER);
+
 #ifdef S52_USE_RADAR
     // get user radar texture
     if (TRUE == raster->isRADAR) {
@@ -5594,7 +6441,7 @@ int        S52_GL_drawText(S52_obj *obj, gpointer user_data)
     while (S52_CMD_NONE != cmdWrd) {
         switch (cmdWrd) {
             case S52_CMD_TXT_TX:
-            case S52_CMD_TXT_TE: _ncmd++; _renderTXT(obj); break;
+            case S52_CMD_TXT_TE: _ncmd++; _GPUtimerCmd(obj, cmdWrd); _renderTXT(obj); break;
 
             default: break;
         }
@@ -5683,11 +6530,11 @@ int        S52_GL_draw(S52_obj *obj, gpointer user_data)
             case S52_CMD_TXT_TX:
             case S52_CMD_TXT_TE: break;   // TE&TX
 
-            case S52_CMD_SYM_PT: _renderSY(obj); _ncmd++; break;   // SY
-            case S52_CMD_SIM_LN: _renderLS(obj); _ncmd++; break;   // LS
-            case S52_CMD_COM_LN: _renderLC(obj); _ncmd++; break;   // LC
-            case S52_CMD_ARE_CO: _renderAC(obj); _ncmd++; break;   // AC
-            case S52_CMD_ARE_PA: _renderAP(obj); _ncmd++; break;   // AP
+            case S52_CMD_SYM_PT: _GPUtimerCmd(obj, cmdWrd); _renderSY(obj); _ncmd++; break;   // SY
+            case S52_CMD_SIM_LN: _GPUtimerCmd(obj, cmdWrd); _renderLS(obj); _ncmd++; break;   // LS
+            case S52_CMD_COM_LN: _GPUtimerCmd(obj, cmdWrd); _renderLC(obj); _ncmd++; break;   // LC
+            case S52_CMD_ARE_CO: _GPUtimerCmd(obj, cmdWrd); _renderAC(obj); _ncmd++; break;   // AC
+            case S52_CMD_ARE_PA: _GPUtimerCmd(obj, cmdWrd); _renderAP(obj); _ncmd++; break;   // AP
 
             // trap CS call that have not been resolve
             case S52_CMD_CND_SY: _traceCS(obj); break;   // CS
@@ -5716,39 +6563,1032 @@ int        S52_GL_draw(S52_obj *obj, gpointer user_data)
     return TRUE;
 }
 
-int        S52_GL_drawBlit(double scale_x, double scale_y, double scale_z, double north)
+#ifdef S52_USE_GL2
+static S52_Color *_getACcol(S52_obj *obj)
+// colour of the AC of obj, NULL if no AC or more than one
 {
-    // FIXME: call _renderAC_NODATA_layer0() when drag - to erease line artefact
-    //_renderAC_NODATA_layer0(); nop!
-    // WRAP_S/T GL_REPEAT - nop!
+    S52_Color *col = NULL;
+    int        nAC = 0;
 
-    // set rotation (via _glMatrixSet())
-    double northtmp = _view.north;
-    _view.north = north;
-    _glMatrixSet(VP_PRJ);
-    _view.north = northtmp;
+    S52_CmdWrd cmdWrd = S52_PL_iniCmd(obj);
+    while (S52_CMD_NONE != cmdWrd) {
+        if (S52_CMD_ARE_CO == cmdWrd) {
+            col = S52_PL_getACdata(obj);
+            ++nAC;
+        }
+        cmdWrd = S52_PL_getCmdNext(obj);
+    }
 
-    glBindTexture(GL_TEXTURE_2D, _fb_pixels_id);
+    return (1 == nAC) ? col : NULL;
+}
 
-#ifdef S52_USE_GL2
-    // turn ON 'sampler2d'
-    //glUniform1f(_uBlitOn, 1.0);
-    glUniform1i(_uBlitOn, 1);
+static vertex_t   _getACz(S52_Color *c)
+{
+    return (vertex_t) (c->fragAtt.cidx + AC_TRANS * (c->fragAtt.trans - '0'));
+}
 
-    GLfloat ppt[4*3 + 4*2] = {
-        _pmin.u, _pmin.v, 0.0,   0.0 + scale_x + scale_z, 0.0 + scale_y + scale_z,
-        _pmin.u, _pmax.v, 0.0,   0.0 + scale_x + scale_z, 1.0 + scale_y - scale_z,
-        _pmax.u, _pmax.v, 0.0,   1.0 + scale_x - scale_z, 1.0 + scale_y - scale_z,
-        _pmax.u, _pmin.v, 0.0,   1.0 + scale_x - scale_z, 0.0 + scale_y + scale_z
-    };
+static int        _addACvert(GArray *vert, vertex_t *v, GLint i, vertex_t z)
+{
+    vertex_t xyz[3] = {v[i*3 + 0], v[i*3 + 1], z};
+    g_array_append_vals(vert, xyz, 3);
 
-    glEnableVertexAttribArray(_aUV);
-    glVertexAttribPointer    (_aUV,       2, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), &ppt[3]);
+    return TRUE;
+}
 
-    glEnableVertexAttribArray(_aPosition);
-    glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), ppt);
+static int        _buildACBatch(_S52_GL_ACbatch *batch)
+// merge the tessellated area of rbin in GL_TRIANGLES (fan and strip are unrolled)
+{
+    g_array_set_size(batch->entry, 0);
+    g_array_set_size(batch->vert,  0);
+    g_hash_table_remove_all(batch->objIdx);
 
-    glFrontFace(GL_CW);
+    for (guint i=0; i<batch->rbin->len; ++i) {
+        S52_obj *obj = (S52_obj *)g_ptr_array_index(batch->rbin, i);
+        S57_geo *geo = S52_PL_getGeo(obj);
+
+        if (S57_AREAS_T != S57_getObjtype(geo))
+            continue;
+
+        S52_Color *c = _getACcol(obj);
+        if (NULL == c)
+            continue;
+
+        S57_prim *prim = S57_getPrimGeo(geo);
+        if (NULL == prim) {
+            prim = _tessd(_tobj, geo);
+        }
+
+        guint     primNbr = 0;
+        vertex_t *v       = NULL;
+        guint     vertNbr = 0;
+        guint     vboID   = 0;
+        if (FALSE == S57_getPrimData(prim, &primNbr, &v, &vertNbr, &vboID))
+            continue;
+
+        _ACentry e     = {obj, batch->vert->len/3, 0, c->fragAtt.cidx, c->fragAtt.trans};
+        vertex_t z     = _getACz(c);
+        gboolean valid = TRUE;
+        for (guint j=0; j<primNbr && TRUE==valid; ++j) {
+            GLint mode  = 0;
+            GLint first = 0;
+            GLint count = 0;
+            S57_getPrimIdx(prim, j, &mode, &first, &count);
+
+            switch (mode) {
+                case GL_TRIANGLES:
+                    for (GLint k=0; k<count; ++k)
+                        _addACvert(batch->vert, v, first+k, z);
+                    break;
+                case GL_TRIANGLE_STRIP:
+                    for (GLint k=2; k<count; ++k) {
+                        _addACvert(batch->vert, v, first+k-2, z);
+                        _addACvert(batch->vert, v, first+k-1, z);
+                        _addACvert(batch->vert, v, first+k,   z);
+                    }
+                    break;
+                case GL_TRIANGLE_FAN:
+                    for (GLint k=2; k<count; ++k) {
+                        _addACvert(batch->vert, v, first,     z);
+                        _addACvert(batch->vert, v, first+k-1, z);
+                        _addACvert(batch->vert, v, first+k,   z);
+                    }
+                    break;
+                default:
+                    PRINTF("DEBUG: AC batch, unknown prim mode [0x%x] - %s filled alone\n", mode, S57_getName(geo));
+                    valid = FALSE;
+            }
+        }
+
+        e.count = batch->vert->len/3 - e.first;
+        if ((FALSE==valid) || (0==e.count)) {
+            g_array_set_size(batch->vert, e.first*3);
+            continue;
+        }
+
+        g_array_append_val(batch->entry, e);
+        g_hash_table_insert(batch->objIdx, obj, GUINT_TO_POINTER(batch->entry->len));
+    }
+
+    if (0 == batch->vboID)
+        _glGenBuffers(&batch->vboID);
+
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vboID);
+    glBufferData(GL_ARRAY_BUFFER, batch->vert->len*sizeof(vertex_t), (const void *)batch->vert->data, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    batch->dirty = FALSE;
+
+    _checkError("_buildACBatch()");
+
+    return TRUE;
+}
+
+static int        _udpACBatchCol(_S52_GL_ACbatch *batch, _ACentry *e, S52_Color *c)
+// CS re-resolve changed the colour of this obj - VBO must be bound
+{
+    vertex_t *v = &g_array_index(batch->vert, vertex_t, e->first*3);
+    vertex_t  z = _getACz(c);
+
+    for (GLsizei i=0; i<e->count; ++i)
+        v[i*3 + 2] = z;
+
+    glBufferSubData(GL_ARRAY_BUFFER, e->first*3*sizeof(vertex_t), e->count*3*sizeof(vertex_t), (const void *)v);
+
+    e->cidx  = c->fragAtt.cidx;
+    e->trans = c->fragAtt.trans;
+
+    return TRUE;
+}
+
+static _APslot   *_getAPbatchSlot(S52_obj *obj, S52_DListData **DListData)
+// atlas slot of the AP of obj, NULL if no AP, more than one or filtered by _renderAP()
+{
+    _APslot *slot = NULL;
+    int      nAP  = 0;
+
+    S52_CmdWrd cmdWrd = S52_PL_iniCmd(obj);
+    while (S52_CMD_NONE != cmdWrd) {
+        if (S52_CMD_ARE_PA == cmdWrd) {
+            ++nAP;
+            // NODATA03 skipped by _renderAP()
+            if (0 != S52_PL_cmpCmdParam(obj, "NODATA03")) {
+                slot       = _getAPslot(obj);
+                *DListData = S52_PL_getDListData(obj);
+            }
+        }
+        cmdWrd = S52_PL_getCmdNext(obj);
+    }
+
+    return (1 == nAP) ? slot : NULL;
+}
+
+static int        _cmpAPrun(gconstpointer a, gconstpointer b)
+// by pattern then VBO order
+{
+    const _APrun *A = (const _APrun *) a;
+    const _APrun *B = (const _APrun *) b;
+
+    if (A->slot != B->slot)
+        return (A->slot < B->slot) ? -1 : 1;
+
+    return (A->e->first < B->e->first) ? -1 : (A->e->first > B->e->first) ? 1 : 0;
+}
+
+static int        _setAPbatchSlot(_APslot *slot, S52_DListData *DListData)
+// same as _renderAP_gl2() - grid on view LL (a multiple of the tile is the same grid)
+{
+    double w0 = slot->tileWpx * _scalex;
+    double h0 = slot->tileHpx * _scaley;
+
+    _setFragAttrib(DListData->colors, FALSE);
+
+    glUniform1f (_uPattGridX, floor(_pmin.u /  w0)     *  w0);
+    glUniform1f (_uPattGridY, floor(_pmin.v / (2*h0))  * (2*h0));
+    glUniform1f (_uPattW,     w0);
+    glUniform1f (_uPattH,     h0);
+    glUniform4fv(_uPattAtlas, 1, slot->rect);
+
+    return TRUE;
+}
+
+static guint      _drawAPBatch(_S52_GL_ACbatch *batch, S52_obj **objList, guint nRun)
+// fill AP of the run from the AC VBO - return the nbr of obj drawn
+{
+    // debug - filter AP in _renderAP()
+    if (S52_CMD_WRD_FILTER_AP & (int) S52_MP_get(S52_CMD_WRD_FILTER))
+        return 0;
+
+    // GLSC2 has no atlas
+    if (-1 == _uPattAtlas)
+        return 0;
+
+    if (NULL == _APrunBuf) {
+        _APrunBuf   = g_array_new(FALSE, FALSE, sizeof(_APrun));
+        _APbatchObj = g_hash_table_new(g_direct_hash, g_direct_equal);
+    }
+    g_array_set_size(_APrunBuf, 0);
+
+    gboolean DRGAREon = (TRUE == (int) S52_MP_get(S52_MAR_DISP_DRGARE_PATTERN));
+    for (guint i=0; i<nRun; ++i) {
+        S52_obj *obj = objList[i];
+
+        if ((FALSE==DRGAREon) && (0==g_strcmp0("DRGARE", S52_PL_getOBCL(obj))))
+            continue;
+
+        S52_DListData *DListData = NULL;
+        _APslot       *slot      = _getAPbatchSlot(obj, &DListData);
+        if ((NULL==slot) || (NULL==DListData))
+            continue;
+
+        guint  idx = GPOINTER_TO_UINT(g_hash_table_lookup(batch->objIdx, obj));
+        _APrun run = {&g_array_index(batch->entry, _ACentry, idx-1), slot, DListData};
+        g_array_append_val(_APrunBuf, run);
+        g_hash_table_insert(_APbatchObj, obj, obj);
+    }
+
+    if (0 == _APrunBuf->len)
+        return 0;
+
+    g_array_sort(_APrunBuf, _cmpAPrun);
+
+    _GPUtimer(S52_PL_getDPRI(objList[0]), _GPU_AP);
+
+    // vertex Z is the palette code
+    _glLoadIdentity(GL_MODELVIEW);
+    _glScaled(1.0, 1.0, 0.0);
+    glUniformMatrix4fv(_uModelview, 1, GL_FALSE, _mvm[_mvmTop]);
+
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vboID);
+    glEnableVertexAttribArray(_aPosition);
+    glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+    glUniform1i(_uPattOn, 1);
+    glBindTexture(GL_TEXTURE_2D, _APatlasTexID);
+
+    _APrun *run   = (_APrun *) _APrunBuf->data;
+    GLint   first = run[0].e->first;
+    GLsizei count = run[0].e->count;
+    _setAPbatchSlot(run[0].slot, run[0].DListData);
+    for (guint i=1; i<_APrunBuf->len; ++i) {
+        if ((run[i].slot==run[i-1].slot) && (first+count==run[i].e->first)) {
+            count += run[i].e->count;
+            continue;
+        }
+
+        glDrawArrays(GL_TRIANGLES, first, count);
+        ++_nACbatchDraw;
+
+        if (run[i].slot != run[i-1].slot)
+            _setAPbatchSlot(run[i].slot, run[i].DListData);
+
+        first = run[i].e->first;
+        count = run[i].e->count;
+    }
+    glDrawArrays(GL_TRIANGLES, first, count);
+    ++_nACbatchDraw;
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUniform1i (_uPattOn,    0);
+    glUniform1f (_uPattGridX, 0.0);
+    glUniform1f (_uPattGridY, 0.0);
+    glUniform1f (_uPattW,     0.0);
+    glUniform1f (_uPattH,     0.0);
+    glUniform4f (_uPattAtlas, 0.0, 0.0, 0.0, 0.0);
+
+    glDisableVertexAttribArray(_aPosition);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    _glLoadIdentity(GL_MODELVIEW);
+    glUniformMatrix4fv(_uModelview, 1, GL_FALSE, _mvm[_mvmTop]);
+
+    _checkError("_drawAPBatch()");
+
+    return _APrunBuf->len;
+}
+#endif  // S52_USE_GL2
+
+S52_GL_ACbatch *S52_GL_newACBatch(GPtrArray *rbin)
+{
+    return_if_null(rbin);
+
+#ifdef S52_USE_GL2
+    _S52_GL_ACbatch *batch = g_new0(_S52_GL_ACbatch, 1);
+    batch->rbin   = rbin;
+    batch->entry  = g_array_new(FALSE, FALSE, sizeof(_ACentry));
+    batch->objIdx = g_hash_table_new(g_direct_hash, g_direct_equal);
+    batch->vert   = g_array_new(FALSE, FALSE, sizeof(vertex_t));
+    batch->dirty  = TRUE;
+
+    return batch;
+#else
+    return NULL;
+#endif
+}
+
+S52_GL_ACbatch *S52_GL_doneACBatch(S52_GL_ACbatch *batch)
+{
+    if (NULL == batch)
+        return NULL;
+
+#ifdef S52_USE_GL2
+    if (GL_TRUE == glIsBuffer(batch->vboID))
+        glDeleteBuffers(1, &batch->vboID);
+
+    g_array_free(batch->entry, TRUE);
+    g_hash_table_destroy(batch->objIdx);
+    g_array_free(batch->vert,  TRUE);
+    g_free(batch);
+#endif
+
+    return NULL;
+}
+
+int        S52_GL_dirtyACBatch(S52_GL_ACbatch *batch)
+{
+    if (NULL == batch)
+        return FALSE;
+
+#ifdef S52_USE_GL2
+    batch->dirty = TRUE;
+#endif
+
+    return TRUE;
+}
+
+guint      S52_GL_drawACBatch(S52_GL_ACbatch *batch, S52_obj **objList, guint n)
+{
+#ifdef S52_USE_GL2
+    if ((NULL==batch) || (NULL==objList) || (0==n))
+        return 0;
+
+    // pick need one colour per obj - GLSC2 has no uPalArray
+    if ((S52_GL_DRAW!=_crnt_GL_cycle) || (-1==_uPalOn))
+        return 0;
+
+    // debug - filter AC in _renderAC()
+    if (S52_CMD_WRD_FILTER_AC & (int) S52_MP_get(S52_CMD_WRD_FILTER))
+        return 0;
+
+    if (TRUE == batch->dirty)
+        _buildACBatch(batch);
+
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vboID);
+
+    // run: obj of the batch that are next to each other in the journal
+    gboolean blend = FALSE;
+    guint    nRun  = 0;
+    for (; nRun<n; ++nRun) {
+        S52_obj *obj = objList[nRun];
+        guint    idx = GPOINTER_TO_UINT(g_hash_table_lookup(batch->objIdx, obj));
+        if (0 == idx)
+            break;
+
+        // highlight, no AC anymore, .. - left to _renderAC()
+        S52_Color *c = _getACcol(obj);
+        if ((NULL==c) || (TRUE==S57_getHighlight(S52_PL_getGeo(obj))))
+            break;
+
+        _ACentry *e = &g_array_index(batch->entry, _ACentry, idx-1);
+        if ((c->fragAtt.cidx!=e->cidx) || (c->fragAtt.trans!=e->trans))
+            _udpACBatchCol(batch, e, c);
+
+        if ('0' != e->trans)
+            blend = TRUE;
+    }
+
+    if (0 == nRun) {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return 0;
+    }
+
+    _GPUtimer(S52_PL_getDPRI(objList[0]), _GPU_AC);
+
+    // same as _setFragAttrib()
+    if ((TRUE==blend) && (TRUE==(int) S52_MP_get(S52_MAR_ANTIALIAS)))
+        glEnable(GL_BLEND);
+
+    GArray *rgba = S52_PL_getPalRGBA();
+    if (NULL != rgba) {
+        glUniform4fv(_uPalArray, rgba->len, (GLfloat*)rgba->data);
+    }
+
+    glUniform1i(_uPalOn, 1);
+    _glUniformMatrix4fv_uModelview();
+
+    glEnableVertexAttribArray(_aPosition);
+    glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+    // coalesce contiguous range - in journal order
+    GLint   first = 0;
+    GLsizei count = 0;
+    for (guint i=0; i<nRun; ++i) {
+        guint     idx = GPOINTER_TO_UINT(g_hash_table_lookup(batch->objIdx, objList[i]));
+        _ACentry *e   = &g_array_index(batch->entry, _ACentry, idx-1);
+
+        if ((0!=count) && (first+count==e->first)) {
+            count += e->count;
+            continue;
+        }
+
+        if (0 != count) {
+            glDrawArrays(GL_TRIANGLES, first, count);
+            ++_nACbatchDraw;
+        }
+
+        first = e->first;
+        count = e->count;
+    }
+    glDrawArrays(GL_TRIANGLES, first, count);
+    ++_nACbatchDraw;
+
+    glDisableVertexAttribArray(_aPosition);
+    glUniform1i(_uPalOn, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    _checkError("S52_GL_drawACBatch()");
+
+    // then AP of the run from the same VBO
+    guint nAP = _drawAPBatch(batch, objList, nRun);
+
+    // then the other command of the run
+    _ACbatchOn = TRUE;
+    for (guint i=0; i<nRun; ++i)
+        S52_GL_draw(objList[i], NULL);
+    _ACbatchOn = FALSE;
+
+    if (0 != nAP)
+        g_hash_table_remove_all(_APbatchObj);
+
+    return nRun;
+#else
+    (void)batch;
+    (void)objList;
+    (void)n;
+
+    return 0;
+#endif
+}
+
+#ifdef S52_USE_GL2
+static S52_Color *_getLSdata(S52_obj *obj, char *pen_w, char *style)
+// colour / pen_w / style of the LS of obj, NULL if no LS or more than one
+{
+    S52_Color *col = NULL;
+    int        nLS = 0;
+
+    S52_CmdWrd cmdWrd = S52_PL_iniCmd(obj);
+    while (S52_CMD_NONE != cmdWrd) {
+        if (S52_CMD_SIM_LN == cmdWrd) {
+            S52_PL_getLSdata(obj, pen_w, style, &col);
+            ++nLS;
+        }
+        cmdWrd = S52_PL_getCmdNext(obj);
+    }
+
+    return (1 == nLS) ? col : NULL;
+}
+
+static guint      _getLSgroup(GArray *group, char style, char pen_w, S52_Color *c)
+{
+    for (guint i=0; i<group->len; ++i) {
+        _LSgroup *g = &g_array_index(group, _LSgroup, i);
+        if ((style==g->style) && (pen_w==g->pen_w) && (c->fragAtt.cidx==g->cidx) && (c->fragAtt.trans==g->trans))
+            return i;
+    }
+
+    _LSgroup g = {style, pen_w, c->fragAtt.cidx, c->fragAtt.trans, ((pen_w - '0') > _lineWidthMax)};
+    g_array_append_val(group, g);
+
+    return group->len - 1;
+}
+
+static int        _addLSvert(GArray *vert, pt3 *p, double dist, double off, double ex, double ey)
+{
+    vertex_t v[LS_VERT_SZ] = {(vertex_t) p->x,   (vertex_t) p->y,  (vertex_t) p->z,
+                              (vertex_t) dist,   (vertex_t) off,
+                              (vertex_t) ex,     (vertex_t) ey};
+    g_array_append_vals(vert, v, LS_VERT_SZ);
+
+    return TRUE;
+}
+
+static int        _buildLSBatch(_S52_GL_LSbatch *batch)
+// merge the LS of rbin, obj in the same group are next to each other in the VBO
+{
+    g_array_set_size(batch->group, 0);
+    g_array_set_size(batch->entry, 0);
+    g_hash_table_remove_all(batch->objIdx);
+
+    // obj idx in rbin by group
+    GPtrArray *byGroup = g_ptr_array_new_with_free_func((GDestroyNotify)g_array_unref);
+    for (guint i=0; i<batch->rbin->len; ++i) {
+        S52_obj *obj = (S52_obj *)g_ptr_array_index(batch->rbin, i);
+        S57_geo *geo = S52_PL_getGeo(obj);
+
+        // mariner obj (lower case name) can move / grow (pastrk)
+        const char *name = S57_getName(geo);
+        if ((S57_LINES_T!=S57_getObjtype(geo)) || (NULL==name) || !g_ascii_isupper(name[0]))
+            continue;
+
+        char       pen_w = 0;
+        char       style = 0;
+        S52_Color *c     = _getLSdata(obj, &pen_w, &style);
+        if ((NULL==c) || !('L'==style || 'S'==style || 'T'==style))
+            continue;
+
+        guint g = _getLSgroup(batch->group, style, pen_w, c);
+        if (byGroup->len <= g)
+            g_ptr_array_add(byGroup, g_array_new(FALSE, FALSE, sizeof(guint)));
+        g_array_append_val((GArray *)g_ptr_array_index(byGroup, g), i);
+    }
+
+    // all LOD in the same VBO - group are contiguous in each LOD
+    GArray *vert = g_array_new(FALSE, FALSE, sizeof(vertex_t));
+    for (guint lod=0; lod<S57_LOD_NUM; ++lod) {
+        for (guint g=0; g<byGroup->len; ++g) {
+            GArray   *idx  = (GArray *)g_ptr_array_index(byGroup, g);
+            gboolean  wide = g_array_index(batch->group, _LSgroup, g).wide;
+
+            for (guint k=0; k<idx->len; ++k) {
+                S52_obj *obj = (S52_obj *)g_ptr_array_index(batch->rbin, g_array_index(idx, guint, k));
+                S57_geo *geo = S52_PL_getGeo(obj);
+                pt3     *ppt = NULL;
+                guint    npt = 0;
+                if ((FALSE==S57_getGeoDataLOD(geo, 0, lod, &npt, (double**)&ppt)) || (npt<2))
+                    continue;
+
+                _LSentry *e = NULL;
+                if (0 == lod) {
+                    _LSentry e0 = {obj, g, {0}, {0}};
+                    g_array_append_val(batch->entry, e0);
+                    g_hash_table_insert(batch->objIdx, obj, GUINT_TO_POINTER(batch->entry->len));
+                    e = &g_array_index(batch->entry, _LSentry, batch->entry->len-1);
+                } else {
+                    guint i = GPOINTER_TO_UINT(g_hash_table_lookup(batch->objIdx, obj));
+                    if (0 == i)
+                        continue;
+                    e = &g_array_index(batch->entry, _LSentry, i-1);
+
+                    // same geo data as the finer LOD - share its range
+                    pt3  *ppt0 = NULL;
+                    guint npt0 = 0;
+                    S57_getGeoDataLOD(geo, 0, lod-1, &npt0, (double**)&ppt0);
+                    if (ppt0 == ppt) {
+                        e->first[lod] = e->first[lod-1];
+                        e->count[lod] = e->count[lod-1];
+                        continue;
+                    }
+                }
+
+                e->first[lod] = vert->len/LS_VERT_SZ;
+                double d = 0.0;
+                for (guint i=1; i<npt; ++i) {
+                    pt3   *p1  = ppt + i - 1;
+                    pt3   *p2  = ppt + i;
+                    double dx  = p2->x - p1->x;
+                    double dy  = p2->y - p1->y;
+                    double len = sqrt(dx*dx + dy*dy);
+
+                    if (FALSE == wide) {
+                        _addLSvert(vert, p1, d, 0.0, 0.0, 0.0);
+                        _addLSvert(vert, p2, d, len, 0.0, 0.0);
+                    } else if (0.0 < len) {
+                        // quad of the segment - extruded by uLineHalfW
+                        double nx = -dy / len;
+                        double ny =  dx / len;
+                        _addLSvert(vert, p1, d, 0.0,  nx,  ny);
+                        _addLSvert(vert, p1, d, 0.0, -nx, -ny);
+                        _addLSvert(vert, p2, d, len,  nx,  ny);
+                        _addLSvert(vert, p2, d, len,  nx,  ny);
+                        _addLSvert(vert, p1, d, 0.0, -nx, -ny);
+                        _addLSvert(vert, p2, d, len, -nx, -ny);
+                    }
+
+                    d += len;
+                }
+                e->count[lod] = vert->len/LS_VERT_SZ - e->first[lod];
+            }
+        }
+    }
+    g_ptr_array_free(byGroup, TRUE);
+
+    if (0 == batch->vboID)
+        _glGenBuffers(&batch->vboID);
+
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vboID);
+    glBufferData(GL_ARRAY_BUFFER, vert->len*sizeof(vertex_t), (const void *)vert->data, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    g_array_free(vert, TRUE);
+
+    batch->dirty = FALSE;
+
+    _checkError("_buildLSBatch()");
+
+    return TRUE;
+}
+
+typedef struct _LSrun {
+    _LSentry  *e;
+    S52_Color *c;       // colour of the LUP (palette) - same cidx for the whole group
+    GLint      first;   // range of the current LOD
+    GLsizei    count;
+} _LSrun;
+
+static int        _cmpLSrun(const void *a, const void *b)
+{
+    const _LSrun *A = (const _LSrun *) a;
+    const _LSrun *B = (const _LSrun *) b;
+
+    return (A->first < B->first) ? -1 : (A->first > B->first) ? 1 : 0;
+}
+
+static int        _setLSgroup(_LSgroup *g, S52_Color *c)
+// same fragment state as _renderLS() / _renderLS_gl2()
+{
+    _setFragAttrib(c, FALSE);
+
+    if (TRUE == g->wide) {
+        glUniform1f(_uLineHalfW, (g->pen_w - '0') * 0.5 * _scalex);
+    } else {
+        glUniform1f(_uLineHalfW, 0.0);
+        _glLineWidth(g->pen_w - '0');
+    }
+
+    switch (g->style) {
+        case 'S': glBindTexture(GL_TEXTURE_2D, _dashpa_mask_texID);
+                  glUniform1f(_uStipOn, _scalex);
+                  break;
+        case 'T': glBindTexture(GL_TEXTURE_2D, _dottpa_mask_texID);
+                  glUniform1f(_uStipOn, _scalex);
+                  break;
+        default:  glBindTexture(GL_TEXTURE_2D, 0);
+                  glUniform1f(_uStipOn, 0.0);
+    }
+
+    return TRUE;
+}
+#endif  // S52_USE_GL2
+
+S52_GL_LSbatch *S52_GL_newLSBatch(GPtrArray *rbin)
+{
+    return_if_null(rbin);
+
+#ifdef S52_USE_GL2
+    _S52_GL_LSbatch *batch = g_new0(_S52_GL_LSbatch, 1);
+    batch->rbin   = rbin;
+    batch->group  = g_array_new(FALSE, FALSE, sizeof(_LSgroup));
+    batch->entry  = g_array_new(FALSE, FALSE, sizeof(_LSentry));
+    batch->objIdx = g_hash_table_new(g_direct_hash, g_direct_equal);
+    batch->dirty  = TRUE;
+
+    return batch;
+#else
+    return NULL;
+#endif
+}
+
+S52_GL_LSbatch *S52_GL_doneLSBatch(S52_GL_LSbatch *batch)
+{
+    if (NULL == batch)
+        return NULL;
+
+#ifdef S52_USE_GL2
+    if (GL_TRUE == glIsBuffer(batch->vboID))
+        glDeleteBuffers(1, &batch->vboID);
+
+    g_array_free(batch->group, TRUE);
+    g_array_free(batch->entry, TRUE);
+    g_hash_table_destroy(batch->objIdx);
+    g_free(batch);
+#endif
+
+    return NULL;
+}
+
+int        S52_GL_dirtyLSBatch(S52_GL_LSbatch *batch)
+{
+    if (NULL == batch)
+        return FALSE;
+
+#ifdef S52_USE_GL2
+    batch->dirty = TRUE;
+#endif
+
+    return TRUE;
+}
+
+guint      S52_GL_drawLSBatch(S52_GL_LSbatch *batch, S52_obj **objList, guint n)
+{
+#ifdef S52_USE_GL2
+    if ((NULL==batch) || (NULL==objList) || (0==n))
+        return 0;
+
+    // pick need one colour per obj - GLSC2 shader has no aDist
+    if ((S52_GL_DRAW!=_crnt_GL_cycle) || (-1==_uDistOn) || (-1==_aDist) || (-1==_aExt))
+        return 0;
+
+    // debug - filter LS in _renderLS()
+    if (S52_CMD_WRD_FILTER_LS & (int) S52_MP_get(S52_CMD_WRD_FILTER))
+        return 0;
+
+    if (TRUE == batch->dirty)
+        _buildLSBatch(batch);
+
+    guint lod = _getLOD();
+
+    // run: obj of the batch that are next to each other in the journal
+    if (NULL == _LSrunBuf)
+        _LSrunBuf = g_array_new(FALSE, FALSE, sizeof(_LSrun));
+    g_array_set_size(_LSrunBuf, 0);
+
+    guint nRun = 0;
+    for (; nRun<n; ++nRun) {
+        S52_obj *obj = objList[nRun];
+        guint    idx = GPOINTER_TO_UINT(g_hash_table_lookup(batch->objIdx, obj));
+        if (0 == idx)
+            break;
+
+        if (TRUE == S57_getHighlight(S52_PL_getGeo(obj)))
+            break;
+
+        // CS re-resolve changed the LS of this obj - left to _renderLS(), rebuild at next draw
+        _LSentry  *e     = &g_array_index(batch->entry, _LSentry, idx-1);
+        _LSgroup  *g     = &g_array_index(batch->group, _LSgroup, e->group);
+        char       pen_w = 0;
+        char       style = 0;
+        S52_Color *c     = _getLSdata(obj, &pen_w, &style);
+        if ((NULL==c) || (pen_w!=g->pen_w) || (style!=g->style) ||
+            (c->fragAtt.cidx!=g->cidx) || (c->fragAtt.trans!=g->trans)) {
+            batch->dirty = TRUE;
+            break;
+        }
+
+        if (0 == e->count[lod])
+            continue;
+
+        _LSrun r = {e, c, e->first[lod], e->count[lod]};
+        g_array_append_val(_LSrunBuf, r);
+    }
+
+    if (0 == nRun)
+        return 0;
+
+    _GPUtimer(S52_PL_getDPRI(objList[0]), _GPU_LS);
+
+    // group are contiguous in the VBO - sort on first to coalesce
+    g_array_sort(_LSrunBuf, _cmpLSrun);
+
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vboID);
+
+    _glUniformMatrix4fv_uModelview();
+    glUniform1i(_uDistOn, 1);
+
+    // wide line quad winding follow the line direction
+    glDisable(GL_CULL_FACE);
+
+    glEnableVertexAttribArray(_aPosition);
+    glEnableVertexAttribArray(_aDist);
+    glEnableVertexAttribArray(_aExt);
+    glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, LS_VERT_SZ*sizeof(vertex_t), 0);
+    glVertexAttribPointer(_aDist,     2, GL_FLOAT, GL_FALSE, LS_VERT_SZ*sizeof(vertex_t), (const GLvoid *)(3*sizeof(vertex_t)));
+    glVertexAttribPointer(_aExt,      2, GL_FLOAT, GL_FALSE, LS_VERT_SZ*sizeof(vertex_t), (const GLvoid *)(5*sizeof(vertex_t)));
+
+    // coalesce contiguous range of the same group
+    guint   group = G_MAXUINT;
+    GLint   first = 0;
+    GLsizei count = 0;
+    for (guint i=0; i<=_LSrunBuf->len; ++i) {
+        _LSrun   *r = (i < _LSrunBuf->len) ? &g_array_index(_LSrunBuf, _LSrun, i) : NULL;
+        _LSentry *e = (NULL == r) ? NULL : r->e;
+
+        if ((NULL!=e) && (0!=count) && (group==e->group) && (first+count==r->first)) {
+            count += r->count;
+            continue;
+        }
+
+        if (0 != count) {
+            _LSgroup *g = &g_array_index(batch->group, _LSgroup, group);
+            glDrawArrays((TRUE==g->wide) ? GL_TRIANGLES : GL_LINES, first, count);
+            ++_nLSbatchDraw;
+        }
+
+        if (NULL == e)
+            break;
+
+        if (group != e->group) {
+            group = e->group;
+            _setLSgroup(&g_array_index(batch->group, _LSgroup, group), r->c);
+        }
+
+        first = r->first;
+        count = r->count;
+    }
+
+    glEnable(GL_CULL_FACE);
+    glDisableVertexAttribArray(_aExt);
+    glDisableVertexAttribArray(_aDist);
+    glDisableVertexAttribArray(_aPosition);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUniform1f(_uStipOn,    0.0);
+    glUniform1f(_uLineHalfW, 0.0);
+    glUniform1i(_uDistOn,    0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    _checkError("S52_GL_drawLSBatch()");
+
+    // then the other command of the run
+    _LSbatchOn = TRUE;
+    for (guint i=0; i<nRun; ++i)
+        S52_GL_draw(objList[i], NULL);
+    _LSbatchOn = FALSE;
+
+    return nRun;
+#else
+    (void)batch;
+    (void)objList;
+    (void)n;
+
+    return 0;
+#endif
+}
+
+int        S52_GL_beginSYInst(void)
+{
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    // pick need one colour per obj
+    if (S52_GL_DRAW != _crnt_GL_cycle)
+        return FALSE;
+
+    if (NULL == _SYinstHash) {
+        _SYinstHash = g_hash_table_new(g_direct_hash, g_direct_equal);
+        _SYinstList = g_ptr_array_new_with_free_func(_freeSYinst);
+        _SYinstVert = g_array_new(FALSE, FALSE, sizeof(vertex_t));
+    }
+    if (0 == _vboSYinstID)
+        glGenBuffers(1, &_vboSYinstID);
+
+    _SYinstOn = TRUE;
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_endSYInst(void)
+{
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    if (FALSE == _SYinstOn)
+        return FALSE;
+
+    _SYinstOn = FALSE;
+
+    if (0 == _SYinstList->len)
+        return TRUE;
+
+    // same display priority as the SY run
+    _GPUtimer(_GPUprio, _GPU_SY);
+
+    // same scale as _renderSY_POINT_T()
+    double sx = _scalex / (S52_MP_get(S52_MAR_DOTPITCH_MM_X) * 100.0);
+    double sy = _scaley / (S52_MP_get(S52_MAR_DOTPITCH_MM_Y) * 100.0);
+
+    gboolean instanced = (TRUE==_GL_EXT_instanced_arrays) && (NULL!=_glDrawArraysInstanced) &&
+                         (-1!=_aInst) && (-1!=_uInstOn);
+
+    // placement in vertex
+    _glUniformMatrix4fv_uModelview();
+    glEnableVertexAttribArray(_aPosition);
+
+    // see _glCallList()
+    glDisable(GL_CULL_FACE);
+
+    for (guint i=0; i<_SYinstList->len; ++i) {
+        _SYinst *si = (_SYinst *)g_ptr_array_index(_SYinstList, i);
+
+        if (TRUE == instanced)
+            _drawSYinstanced(si, sx, sy);
+        else
+            _drawSYpseudo(si, sx, sy);
+    }
+
+    glEnable(GL_CULL_FACE);
+    glDisableVertexAttribArray(_aPosition);
+
+    g_hash_table_remove_all(_SYinstHash);
+    g_ptr_array_set_size(_SYinstList, 0);
+
+    _checkError("S52_GL_endSYInst()");
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_beginTextBatch(void)
+{
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2) && defined(S52_USE_FREETYPE_GL)
+    // pick text not handled - GLSC2 has no uPalArray / aInst
+    if ((S52_GL_DRAW!=_crnt_GL_cycle) && (S52_GL_LAST!=_crnt_GL_cycle))
+        return FALSE;
+    if ((-1==_uPalOn) || (-1==_uInstOn) || (-1==_aInst) || (NULL==_freetype_gl_atlas))
+        return FALSE;
+
+    if (S52_CMD_WRD_FILTER_TX & (int) S52_MP_get(S52_CMD_WRD_FILTER))
+        return FALSE;
+
+    if (NULL == _TXTrunHash) {
+        _TXTrunHash   = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, _freeTXTrun);
+        _TXTbatchVert = g_array_new(FALSE, FALSE, sizeof(GLfloat));
+    }
+    if (0 == _vboTXTbatchID)
+        glGenBuffers(1, &_vboTXTbatchID);
+
+    _TXTbatchOn = TRUE;
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_endTextBatch(void)
+{
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2) && defined(S52_USE_FREETYPE_GL)
+    if (FALSE == _TXTbatchOn)
+        return FALSE;
+
+    _TXTbatchOn = FALSE;
+
+    if (0 == _TXTbatchVert->len)
+        return TRUE;
+
+    _GPUtimer(-1, _GPU_TX);
+
+    GArray *rgba = S52_PL_getPalRGBA();
+    if (NULL != rgba) {
+        glUniform4fv(_uPalArray, rgba->len, (GLfloat*)rgba->data);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, _vboTXTbatchID);
+    glBufferData(GL_ARRAY_BUFFER, _TXTbatchVert->len*sizeof(GLfloat), (const void *)_TXTbatchVert->data, GL_STREAM_DRAW);
+
+    GLsizei stride = TXT_VERT_SZ * sizeof(GLfloat);
+    glEnableVertexAttribArray(_aPosition);
+    glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, stride, (const GLvoid *)0);
+    glEnableVertexAttribArray(_aUV);
+    glVertexAttribPointer    (_aUV,       2, GL_FLOAT, GL_FALSE, stride, (const GLvoid *)(3*sizeof(GLfloat)));
+    glEnableVertexAttribArray(_aInst);
+    glVertexAttribPointer    (_aInst,     3, GL_FLOAT, GL_FALSE, stride, (const GLvoid *)(5*sizeof(GLfloat)));
+
+    // placement in vertex - same as _renderTXTAA_gl2() _pushScaletoPixel(FALSE)
+    _glUniformMatrix4fv_uModelview();
+    glUniform1i(_uPalOn,     1);
+    glUniform1i(_uInstOn,    1);
+    glUniform2f(_uInstScale, (GLfloat) _scalex, (GLfloat) _scaley);
+    glUniform1i(_uTextOn,    1);
+
+    glBindTexture(GL_TEXTURE_2D, _freetype_gl_atlas->id);
+
+    glDrawArrays(GL_TRIANGLES, 0, _TXTbatchVert->len / TXT_VERT_SZ);
+    ++_nTXTbatchDraw;
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glUniform1i(_uTextOn, 0);
+    glUniform1i(_uInstOn, 0);
+    glUniform1i(_uPalOn,  0);
+
+    glDisableVertexAttribArray(_aInst);
+    glDisableVertexAttribArray(_aUV);
+    glDisableVertexAttribArray(_aPosition);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    g_array_set_size(_TXTbatchVert, 0);
+
+    _checkError("S52_GL_endTextBatch()");
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_drawBlit(double scale_x, double scale_y, double scale_z, double north)
+{
+    // FIXME: call _renderAC_NODATA_layer0() when drag - to erease line artefact
+    //_renderAC_NODATA_layer0(); nop!
+    // WRAP_S/T GL_REPEAT - nop!
+
+    // set rotation (via _glMatrixSet())
+    double northtmp = _view.north;
+    _view.north = north;
+    _glMatrixSet(VP_PRJ);
+    _view.north = northtmp;
+
+    glBindTexture(GL_TEXTURE_2D, _fb_pixels_id);
+
+#ifdef S52_USE_GL2
+    // turn ON 'sampler2d'
+    //glUniform1f(_uBlitOn, 1.0);
+    glUniform1i(_uBlitOn, 1);
+
+    GLfloat ppt[4*3 + 4*2] = {
+        _pmin.u, _pmin.v, 0.0,   0.0 + scale_x + scale_z, 0.0 + scale_y + scale_z,
+        _pmin.u, _pmax.v, 0.0,   0.0 + scale_x + scale_z, 1.0 + scale_y - scale_z,
+        _pmax.u, _pmax.v, 0.0,   1.0 + scale_x - scale_z, 1.0 + scale_y - scale_z,
+        _pmax.u, _pmin.v, 0.0,   1.0 + scale_x - scale_z, 0.0 + scale_y + scale_z
+    };
+
+    glEnableVertexAttribArray(_aUV);
+    glVertexAttribPointer    (_aUV,       2, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), &ppt[3]);
+
+    glEnableVertexAttribArray(_aPosition);
+    glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), ppt);
+
+    glFrontFace(GL_CW);
 
     glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 
@@ -5775,6 +7615,363 @@ int        S52_GL_drawBlit(double scale_x, double scale_y, double scale_z, doubl
     return TRUE;
 }
 
+#if defined(S52_USE_TILECACHE) && defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+// tile cache: layer 0-8 rendered in FBO texture on a grid in projected coord (Mercator)
+// one grid per scale (MPP), the view is composed from tile (S52_GL_drawTiles())
+// so only tile newly exposed by a pan are rendered
+#define TILE_PIX     256    // tile size in pixel (POT)
+#define TILE_MARGIN  128    // pixel - cull margin so that symbol/text across tile edge are drawn in both tile
+#define TILE_MAX     192    // nbr of tile texture kept (LRU) - 48MB
+#define TILE_EPS     1e-6   // relative - MPP of the view and of a grid level that differ by less are the same level
+
+typedef struct _tile {
+    gint64 col;             // grid index - tile origin: col * TILE_PIX * MPP
+    gint64 row;
+    double scale;           // grid level - MPP the tile was rendered at
+    GLuint texID;           // 0 - slot never used
+    guint  stamp;           // frame of last use (LRU)
+    int    valid;           // FALSE - stale or being rendered
+} _tile;
+
+static _tile   _tileCache[TILE_MAX];
+static guint   _tileFrame = 0;         // S52_GL_beginTiles() count
+static int     _tileFlush = FALSE;     // TRUE - all tile stale (palette, MP, cell, ..)
+static int     _tileNorthUp = TRUE;    // tile rendered north up view - with text (see S52_GL_isTileText())
+static _tile  *_tileCrnt  = NULL;      // tile being rendered
+static GLuint  _fboTileID = 0;
+
+// grid level of this frame - MPP of the view snapped to the level of a cached tile (see TILE_EPS)
+static double  _tileSX    = 0.0;
+static double  _tileSY    = 0.0;
+
+// tile range of the (rotated) view
+static gint64  _tileCol0 = 0;
+static gint64  _tileCol1 = -1;
+static gint64  _tileRow0 = 0;
+static gint64  _tileRow1 = -1;
+static gint64  _tileNext = 0;          // next tile of the range checked by S52_GL_beginTile()
+
+// view saved while a tile is rendered
+static vp_t    _tileVP;
+static projUV  _tilePmin;
+static projUV  _tilePmax;
+static projUV  _tileGmin;
+static projUV  _tileGmax;
+static double  _tileNorth = 0.0;
+
+static _tile    *_tileFind(gint64 col, gint64 row)
+{
+    for (guint i=0; i<TILE_MAX; ++i) {
+        _tile *t = &_tileCache[i];
+        // Note: exact - _tileSX is snapped to t->scale in S52_GL_beginTiles()
+        if (TRUE==t->valid && col==t->col && row==t->row && _tileSX==t->scale)
+            return t;
+    }
+
+    return NULL;
+}
+
+static _tile    *_tileSlot(void)
+// stale slot first, then least recently used - never a tile of this frame
+{
+    _tile *lru = NULL;
+
+    for (guint i=0; i<TILE_MAX; ++i) {
+        _tile *t = &_tileCache[i];
+        if (FALSE == t->valid)
+            return t;
+        if (_tileFrame == t->stamp)
+            continue;
+        if (NULL==lru || t->stamp<lru->stamp)
+            lru = t;
+    }
+
+    return lru;
+}
+#endif  // S52_USE_TILECACHE
+
+int        S52_GL_delTiles(void)
+// Note: no GL call - tile are flushed at the next S52_GL_beginTiles()
+{
+#if defined(S52_USE_TILECACHE) && defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    _tileFlush = TRUE;
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_beginTiles(void)
+{
+#if defined(S52_USE_TILECACHE) && defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    if (S52_GL_DRAW != _crnt_GL_cycle)
+        return FALSE;
+
+    // RADAR / raster change at each frame
+    if (1.0 == S52_MP_get(S52_MAR_DISP_RADAR_LAYER))
+        return FALSE;
+
+    // text in tile only when north up - flush when switching to / from a rotated view
+    int northUp = (0.0 == _view.north) ? TRUE : FALSE;
+    if (northUp != _tileNorthUp) {
+        _tileNorthUp = northUp;
+        _tileFlush   = TRUE;
+    }
+
+    if (TRUE == _tileFlush) {
+        for (guint i=0; i<TILE_MAX; ++i)
+            _tileCache[i].valid = FALSE;
+        _tileFlush = FALSE;
+    }
+
+    ++_tileFrame;
+
+    // grid level - rounding in the view MPP (S52_setView(), pan) must not miss the cache
+    _tileSX = _scalex;
+    for (guint i=0; i<TILE_MAX; ++i) {
+        _tile *t = &_tileCache[i];
+        if ((TRUE==t->valid) && (ABS(t->scale - _scalex) <= TILE_EPS*_scalex)) {
+            _tileSX = t->scale;
+            break;
+        }
+    }
+    _tileSY = _tileSX * (_scaley / _scalex);
+
+    // bbox of the view rotated about its center
+    double cx = (_pmin.u + _pmax.u) / 2.0;
+    double cy = (_pmin.v + _pmax.v) / 2.0;
+    double hw = (_pmax.u - _pmin.u) / 2.0;
+    double hh = (_pmax.v - _pmin.v) / 2.0;
+    double c  = ABS(cos(_view.north * DEG_TO_RAD));
+    double s  = ABS(sin(_view.north * DEG_TO_RAD));
+    double bw = hw*c + hh*s;
+    double bh = hw*s + hh*c;
+
+    double tw = TILE_PIX * _tileSX;
+    double th = TILE_PIX * _tileSY;
+
+    _tileCol0 = (gint64) floor((cx - bw) / tw);
+    _tileCol1 = (gint64) floor((cx + bw) / tw);
+    _tileRow0 = (gint64) floor((cy - bh) / th);
+    _tileRow1 = (gint64) floor((cy + bh) / th);
+    _tileNext = 0;
+
+    gint64 nTile = (_tileCol1 - _tileCol0 + 1) * (_tileRow1 - _tileRow0 + 1);
+    if (TILE_MAX < nTile) {
+        PRINTF("WARNING: view need %li tile, max is %i - no tile cache for this frame\n", (long)nTile, TILE_MAX);
+        return FALSE;
+    }
+
+    // keep tile of this view from LRU
+    for (gint64 row=_tileRow0; row<=_tileRow1; ++row) {
+        for (gint64 col=_tileCol0; col<=_tileCol1; ++col) {
+            _tile *t = _tileFind(col, row);
+            if (NULL != t)
+                t->stamp = _tileFrame;
+        }
+    }
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_beginTile(double *S, double *W, double *N, double *E)
+{
+#if defined(S52_USE_TILECACHE) && defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    gint64 nCol = _tileCol1 - _tileCol0 + 1;
+    gint64 nRow = _tileRow1 - _tileRow0 + 1;
+
+    for (; _tileNext<nCol*nRow; ++_tileNext) {
+        gint64 col = _tileCol0 + (_tileNext % nCol);
+        gint64 row = _tileRow0 + (_tileNext / nCol);
+
+        if (NULL != _tileFind(col, row))
+            continue;
+
+        _tile *t = _tileSlot();
+        if (NULL == t)
+            return FALSE;
+
+        ++_tileNext;
+
+        if (0 == t->texID) {
+            t->texID = _initAPtexStore(TILE_PIX, TILE_PIX, NULL);
+            glBindTexture  (GL_TEXTURE_2D, t->texID);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glBindTexture  (GL_TEXTURE_2D, 0);
+        }
+        t->col   = col;
+        t->row   = row;
+        t->scale = _tileSX;
+        t->stamp = _tileFrame;
+        t->valid = FALSE;
+        _tileCrnt = t;
+
+        if (0 == _fboTileID)
+            glGenFramebuffers(1, &_fboTileID);
+        glBindFramebuffer     (GL_FRAMEBUFFER, _fboTileID);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, t->texID, 0);
+        _fboCrntID = _fboTileID;
+
+        // save view
+        _tileVP    = _vp;
+        _tilePmin  = _pmin;
+        _tilePmax  = _pmax;
+        _tileGmin  = _gmin;
+        _tileGmax  = _gmax;
+        _tileNorth = _view.north;
+
+        // tile view - north up, view rotation in S52_GL_drawTiles()
+        _vp.x = 0;
+        _vp.y = 0;
+        _vp.w = TILE_PIX;
+        _vp.h = TILE_PIX;
+        _pmin.u = col       * TILE_PIX * _tileSX;
+        _pmin.v = row       * TILE_PIX * _tileSY;
+        _pmax.u = (col + 1) * TILE_PIX * _tileSX;
+        _pmax.v = (row + 1) * TILE_PIX * _tileSY;
+        _view.north = 0.0;
+
+        glViewport(_vp.x, _vp.y, _vp.w, _vp.h);
+        _glMatrixSet(VP_PRJ);
+
+        // cull extent: tile + margin
+        projUV gmin = {_pmin.u - TILE_MARGIN*_scalex, _pmin.v - TILE_MARGIN*_scaley};
+        projUV gmax = {_pmax.u + TILE_MARGIN*_scalex, _pmax.v + TILE_MARGIN*_scaley};
+        gmin = S57_prj2geo(gmin);
+        gmax = S57_prj2geo(gmax);
+        S52_GL_setGEOView(gmin.v, gmin.u, gmax.v, gmax.u);
+
+        *S = gmin.v;
+        *W = gmin.u;
+        *N = gmax.v;
+        *E = gmax.u;
+
+        // as S52_GL_begin(S52_GL_DRAW), but a tile is always cleared
+        _renderAC_NODATA_layer0();
+        if (1.0 == S52_MP_get(S52_MAR_DISP_NODATA_LAYER))
+            _renderAP_NODATA_layer0();
+
+        _checkError("S52_GL_beginTile()");
+
+        return TRUE;
+    }
+
+    return FALSE;
+#else
+    (void)S;
+    (void)W;
+    (void)N;
+    (void)E;
+
+    return FALSE;
+#endif
+}
+
+int        S52_GL_endTile(void)
+{
+#if defined(S52_USE_TILECACHE) && defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    return_if_null(_tileCrnt);
+
+    _glMatrixDel(VP_PRJ);
+
+    _fboCrntID = _fboWinID;
+    glBindFramebuffer(GL_FRAMEBUFFER, _fboWinID);
+
+    // restore view
+    _vp         = _tileVP;
+    _pmin       = _tilePmin;
+    _pmax       = _tilePmax;
+    _gmin       = _tileGmin;
+    _gmax       = _tileGmax;
+    _view.north = _tileNorth;
+
+    glViewport(_vp.x, _vp.y, _vp.w, _vp.h);
+
+    _tileCrnt->valid = TRUE;
+    _tileCrnt        = NULL;
+
+    _checkError("S52_GL_endTile()");
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_drawTiles(void)
+// compose the view from tile - view rotation is in the VP_PRJ matrix set by S52_GL_begin(S52_GL_DRAW)
+// Note: text (screen upright) is not in tile when the view is rotated (see S52_GL_isTileText())
+{
+#if defined(S52_USE_TILECACHE) && defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    _GPUtimer(-1, _GPU_OTHER);
+
+    // copy texel as is - tile alpha is not 1.0 everywhere
+    glDisable(GL_BLEND);
+
+    glUniform1i(_uBlitOn, 1);
+    glEnableVertexAttribArray(_aUV);
+    glEnableVertexAttribArray(_aPosition);
+    glFrontFace(GL_CW);
+
+    // north up: tile texel on pixel
+    GLint filter = (0.0 == _view.north) ? GL_NEAREST : GL_LINEAR;
+
+    for (gint64 row=_tileRow0; row<=_tileRow1; ++row) {
+        for (gint64 col=_tileCol0; col<=_tileCol1; ++col) {
+            _tile *t = _tileFind(col, row);
+            if (NULL == t)
+                continue;
+
+            GLfloat x0 = col       * TILE_PIX * _tileSX;
+            GLfloat y0 = row       * TILE_PIX * _tileSY;
+            GLfloat x1 = (col + 1) * TILE_PIX * _tileSX;
+            GLfloat y1 = (row + 1) * TILE_PIX * _tileSY;
+            GLfloat ppt[4*3 + 4*2] = {
+                x0, y0, 0.0,   0.0, 0.0,
+                x0, y1, 0.0,   0.0, 1.0,
+                x1, y1, 0.0,   1.0, 1.0,
+                x1, y0, 0.0,   1.0, 0.0
+            };
+
+            glBindTexture  (GL_TEXTURE_2D, t->texID);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+
+            glVertexAttribPointer(_aUV,       2, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), &ppt[3]);
+            glVertexAttribPointer(_aPosition, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), ppt);
+
+            glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+        }
+    }
+
+    glFrontFace(GL_CCW);
+    glDisableVertexAttribArray(_aUV);
+    glDisableVertexAttribArray(_aPosition);
+    glUniform1i(_uBlitOn, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glEnable(GL_BLEND);
+
+    _checkError("S52_GL_drawTiles()");
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_isTileText(void)
+// TRUE if text go in tile - tile are north up, text is screen upright
+// Note: SY turn with the chart (orient in MODELVIEW, view rotation in VP_PRJ) like the composite
+{
+    return (0.0 == _view.north) ? TRUE : FALSE;
+}
+
 int        S52_GL_drawStrWorld(double x, double y, char *str, unsigned int bsize)
 // draw string in world coords
 {
@@ -5897,6 +8094,8 @@ static int       _drawGarticule(double grat, gboolean meridian, char suffix)
 
 int        S52_GL_drawGraticule(void)
 {
+    _GPUtimer(-1, _GPU_OTHER);
+
     S52_Color *black = S52_PL_getColor("CHBLK");
     _setFragAttrib(black, FALSE);
 
@@ -6158,27 +8357,136 @@ static guchar   *_readFBPixels(vp_t vp)
 
     _checkError("S52_GL_readFBPixels().. -GL1-");
 
-    return _fb_pixels;
-#endif  // S52_USE_GL1
+    return _fb_pixels;
+#endif  // S52_USE_GL1
+
+}
+
+static int       _drawFBPixels(void)
+{
+    // debug
+    //PRINTF("VP: %i, %i, %i, %i\n", _vp[0], _vp[1], _vp[2], _vp[3]);
+
+    // set rotation temporatly to 0.0 (via _glMatrixSet())
+    double northtmp = _view.north;
+    _view.north = 0.0;
+
+    glBindTexture(GL_TEXTURE_2D, _fb_pixels_id);
+
+#ifdef S52_USE_GL2
+    //_glMatrixSet(VP_PRJ);
+
+    // turn ON 'sampler2d'
+    //glUniform1f(_uBlitOn, 1.0);
+    glUniform1i(_uBlitOn, 1);
+
+    GLfloat ppt[4*3 + 4*2] = {
+        _pmin.u, _pmin.v, 0.0,   0.0, 0.0,
+        _pmin.u, _pmax.v, 0.0,   0.0, 1.0,
+        _pmax.u, _pmax.v, 0.0,   1.0, 1.0,
+        _pmax.u, _pmin.v, 0.0,   1.0, 0.0
+    };
+
+    glEnableVertexAttribArray(_aUV);
+    glVertexAttribPointer    (_aUV,       2, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), &ppt[3]);
+
+    glEnableVertexAttribArray(_aPosition);
+    glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), ppt);
+
+    glFrontFace(GL_CW);
+
+    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+
+    glFrontFace(GL_CCW);
+
+    // turn OFF 'sampler2d'
+    //glUniform1f(_uBlitOn, 0.0);
+    glUniform1i(_uBlitOn, 0);
+
+    glDisableVertexAttribArray(_aUV);
+    glDisableVertexAttribArray(_aPosition);
+
+    //_glMatrixDel(VP_PRJ);
+
+#else   // S52_USE_GL2
+
+    _glMatrixSet(VP_WIN);
+    glRasterPos2i(0, 0);
+
+    // parameter must be in sync with glReadPixels()
+    // RGBA
+    glDrawPixels(_vp.w, _vp.h, GL_RGBA, GL_UNSIGNED_BYTE, _fb_pixels);
+    // RGB
+    //glDrawPixels(_vp[2], _vp[3], GL_RGB, GL_UNSIGNED_BYTE, _fb_pixels);
+
+    _glMatrixDel(VP_WIN);
+
+#endif  // S52_USE_GL2
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    _checkError("S52_GL_drawFBPixels() -fini-");
+
+    _view.north = northtmp;
+
+    return TRUE;
+}
+
+#ifdef S52_USE_LAST_FBO
+// layer 9 is drawn in an offscreen FB kept between S52_drawLast() call, as the back buffer
+// is undefined after a swap - so only the dirty rect need restore / redraw (S52_GL_restoreLast())
+#define LAST_MARGIN_PIX 96.0    // symbol and text around an obj
+
+static GLuint _fboLastID      = 0;
+static GLuint _last_pixels_id = 0;      // texture
+static guint  _lastW          = 0;
+static guint  _lastH          = 0;
+static int    _lastNew        = FALSE;  // TRUE - texture (re)alloc, content undefined
+
+static int       _bindLastFBO(void)
+{
+    if ((0==_last_pixels_id) || (_lastW!=_vp.w) || (_lastH!=_vp.h)) {
+        if (0 != _last_pixels_id)
+            glDeleteTextures(1, &_last_pixels_id);
+
+        _last_pixels_id = _initAPtexStore(_vp.w, _vp.h, NULL);
+        glBindTexture  (GL_TEXTURE_2D, _last_pixels_id);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,     GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glBindTexture  (GL_TEXTURE_2D, 0);
+
+        _lastW   = _vp.w;
+        _lastH   = _vp.h;
+        _lastNew = TRUE;
+    }
+
+    if (0 == _fboLastID)
+        glGenFramebuffers(1, &_fboLastID);
+    glBindFramebuffer     (GL_FRAMEBUFFER, _fboLastID);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _last_pixels_id, 0);
+    _fboCrntID = _fboLastID;
+
+    _checkError("_bindLastFBO()");
 
+    return TRUE;
 }
 
-static int       _drawFBPixels(void)
+static int       _drawLastPixels(void)
+// offscreen FB --> window, texel on pixel
 {
-    // debug
-    //PRINTF("VP: %i, %i, %i, %i\n", _vp[0], _vp[1], _vp[2], _vp[3]);
+    glDisable(GL_SCISSOR_TEST);
+
+    _fboCrntID = _fboWinID;
+    glBindFramebuffer(GL_FRAMEBUFFER, _fboWinID);
 
-    // set rotation temporatly to 0.0 (via _glMatrixSet())
     double northtmp = _view.north;
     _view.north = 0.0;
+    _glMatrixSet(VP_PRJ);
 
-    glBindTexture(GL_TEXTURE_2D, _fb_pixels_id);
-
-#ifdef S52_USE_GL2
-    //_glMatrixSet(VP_PRJ);
-
-    // turn ON 'sampler2d'
-    //glUniform1f(_uBlitOn, 1.0);
+    glDisable(GL_BLEND);
+    glBindTexture(GL_TEXTURE_2D, _last_pixels_id);
     glUniform1i(_uBlitOn, 1);
 
     GLfloat ppt[4*3 + 4*2] = {
@@ -6190,47 +8498,182 @@ static int       _drawFBPixels(void)
 
     glEnableVertexAttribArray(_aUV);
     glVertexAttribPointer    (_aUV,       2, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), &ppt[3]);
-
     glEnableVertexAttribArray(_aPosition);
     glVertexAttribPointer    (_aPosition, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), ppt);
 
     glFrontFace(GL_CW);
-
     glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
-
     glFrontFace(GL_CCW);
 
-    // turn OFF 'sampler2d'
-    //glUniform1f(_uBlitOn, 0.0);
     glUniform1i(_uBlitOn, 0);
-
     glDisableVertexAttribArray(_aUV);
     glDisableVertexAttribArray(_aPosition);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glEnable(GL_BLEND);
 
-    //_glMatrixDel(VP_PRJ);
+    _glMatrixDel(VP_PRJ);
+    _view.north = northtmp;
 
-#else   // S52_USE_GL2
+    _checkError("_drawLastPixels()");
 
-    _glMatrixSet(VP_WIN);
-    glRasterPos2i(0, 0);
+    return TRUE;
+}
+#endif  // S52_USE_LAST_FBO
 
-    // parameter must be in sync with glReadPixels()
-    // RGBA
-    glDrawPixels(_vp.w, _vp.h, GL_RGBA, GL_UNSIGNED_BYTE, _fb_pixels);
-    // RGB
-    //glDrawPixels(_vp[2], _vp[3], GL_RGB, GL_UNSIGNED_BYTE, _fb_pixels);
+int        S52_GL_hasLastFBO(void)
+{
+#ifdef S52_USE_LAST_FBO
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
 
-    _glMatrixDel(VP_WIN);
+int        S52_GL_restoreLast(double *rect)
+{
+#ifdef S52_USE_LAST_FBO
+    if (S52_GL_LAST != _crnt_GL_cycle) {
+        PRINTF("WARNING: not in S52_GL_LAST cycle\n");
+        return FALSE;
+    }
 
-#endif  // S52_USE_GL2
+    _GPUtimer(-1, _GPU_OTHER);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    int ret = TRUE;
 
-    _checkError("S52_GL_drawFBPixels() -fini-");
+    if ((NULL==rect) || (TRUE==_lastNew)) {
+        glDisable(GL_SCISSOR_TEST);
+        ret      = (NULL == rect) ? TRUE : FALSE;
+        _lastNew = FALSE;
+    } else {
+        // clip restore and the drawing that follow
+        GLint x0 = (GLint) floor(rect[0]);
+        GLint y0 = (GLint) floor(rect[1]);
+        GLint x1 = (GLint) ceil (rect[2]);
+        GLint y1 = (GLint) ceil (rect[3]);
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(x0, y0, x1-x0, y1-y0);
+    }
 
-    _view.north = northtmp;
+    // modelview left by obj drawn in a previous rect
+    _glMatrixSet(VP_PRJ);
+    _drawFBPixels();
+    _glMatrixDel(VP_PRJ);
+
+    return ret;
+#else
+    (void)rect;
+
+    return FALSE;
+#endif
+}
+
+int        S52_GL_getLastRect(S52_obj *obj, double *rect)
+{
+#ifdef S52_USE_LAST_FBO
+    return_if_null(obj);
+    return_if_null(rect);
+
+    S57_geo *geo  = S52_PL_getGeo(obj);
+    CCHAR   *name = S57_getName(geo);
+
+    // place in window coord. or to the edge of the view
+    if ((0==g_strcmp0(name, "$CSYMB")) || (0==g_strcmp0(name, "ebline")) || (0==g_strcmp0(name, "vrmark")))
+        return FALSE;
+    if ((0==g_strcmp0(name, "ownshp")) && (NULL!=S57_getAttVal(geo, "headng")) && (TRUE==(int) S52_MP_get(S52_MAR_HEADNG_LINE)))
+        return FALSE;
+
+    GLdouble *ppt = NULL;
+    guint     npt = 0;
+    if (FALSE == S57_getGeoData(geo, 0, &npt, &ppt))
+        return FALSE;
+
+    // get the current number of positon (this grow as GPS/AIS pos come in)
+    if ((0==g_strcmp0(name, "pastrk")) || (0==g_strcmp0(name, "afgves")))
+        npt = S57_getGeoSize(geo);
+
+    // nothing drawn
+    rect[0] = rect[1] =  INFINITY;
+    rect[2] = rect[3] = -INFINITY;
+    if (0 == npt)
+        return TRUE;
+
+    double xmin = ppt[0], ymin = ppt[1];
+    double xmax = ppt[0], ymax = ppt[1];
+    for (guint i=1; i<npt; ++i) {
+        xmin = MIN(xmin, ppt[i*3+0]);
+        ymin = MIN(ymin, ppt[i*3+1]);
+        xmax = MAX(xmax, ppt[i*3+0]);
+        ymax = MAX(ymax, ppt[i*3+1]);
+    }
+
+    // margin: symbol / text, vector, ship outline, heading / beam bearing line
+    double   marginPix = LAST_MARGIN_PIX;
+    double   marginM   = 0.0;
+    GString *sogspdstr = S57_getAttVal(geo, "sogspd");
+    GString *shplenstr = S57_getAttVal(geo, "shplen");
+    GString *shpbrdstr = S57_getAttVal(geo, "shpbrd");
+    if (NULL != sogspdstr)
+        marginM += S52_MP_get(S52_MAR_VECPER) * (S52_atof(sogspdstr->str) / 60.0) * NM_METER;
+    if (NULL != shplenstr)
+        marginM += S52_atof(shplenstr->str);
+    if (NULL != shpbrdstr)
+        marginM += S52_atof(shpbrdstr->str);
+    if (0 == g_strcmp0(name, "ownshp"))
+        marginM += S52_MP_get(S52_MAR_BEAM_BRG_NM) * NM_METER;
+    if ((0==g_strcmp0(name, "vessel")) && (TRUE==(int) S52_MP_get(S52_MAR_HEADNG_LINE)))
+        marginPix += 50.0 / S52_MP_get(S52_MAR_DOTPITCH_MM_X);  // see _renderLS_vessel()
+
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2) && defined(S52_USE_FREETYPE_GL)
+    // text extent - label can be wider than LAST_MARGIN_PIX (ex: vessel name)
+    if ((NULL!=_TXTrunHash) && (TRUE==S52_PL_hasText(obj))) {
+        S52_CmdWrd cmdWrd = S52_PL_iniCmd(obj);
+        while (S52_CMD_NONE != cmdWrd) {
+            if ((S52_CMD_TXT_TX==cmdWrd) || (S52_CMD_TXT_TE==cmdWrd)) {
+                S52_Color   *color  = NULL;
+                int          xoffs  = 0;
+                int          yoffs  = 0;
+                unsigned int bsize  = 0;
+                unsigned int weight = 0;
+                int          disIdx = 0;
+                const char  *str    = S52_PL_getText(obj, &color, &xoffs, &yoffs, &bsize, &weight, &disIdx);
+                if ((NULL!=str) && ('\0'!=str[0])) {
+                    // same glyph run as the TXT batch - pivot offset as _renderTXT()
+                    _TXTrun *run  = _getTXTrun(str, bsize);
+                    double   offs = (bsize * PICA * MAX(ABS(xoffs), ABS(yoffs))) / S52_MP_get(S52_MAR_DOTPITCH_MM_X);
+                    marginPix = MAX(marginPix, offs + MAX(run->strWpx, run->strHpx));
+                }
+            }
+            cmdWrd = S52_PL_getCmdNext(obj);
+        }
+    }
+#endif
+
+    xmin -= marginM + marginPix * _scalex;
+    xmax += marginM + marginPix * _scalex;
+    ymin -= marginM + marginPix * _scaley;
+    ymax += marginM + marginPix * _scaley;
+
+    // prj --> win - rotation
+    projXY corner[4] = {{xmin, ymin}, {xmin, ymax}, {xmax, ymax}, {xmax, ymin}};
+
+    _glMatrixSet(VP_PRJ);
+    for (guint i=0; i<4; ++i) {
+        projXY p = _prj2win(corner[i]);
+        rect[0] = MIN(rect[0], p.u);
+        rect[1] = MIN(rect[1], p.v);
+        rect[2] = MAX(rect[2], p.u);
+        rect[3] = MAX(rect[3], p.v);
+    }
+    _glMatrixDel(VP_PRJ);
 
     return TRUE;
+#else
+    (void)obj;
+    (void)rect;
+
+    return FALSE;
+#endif
 }
 
 static int       _pickFBPixels(S52_obj *obj)
@@ -6492,7 +8935,7 @@ int        S52_GL_begin(S52_GL_cycle cycle)
     glUniform1i(_uSampler2d, 0);
 
     // reset
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, _fboWinID);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 
     _checkError("S52_GL_begin() - GL2 EnableCap");
@@ -6612,8 +9055,13 @@ int        S52_GL_begin(S52_GL_cycle cycle)
             _fb_pixels_udp = FALSE;
         }
 
+#ifdef S52_USE_LAST_FBO
+        // draw in the offscreen FB - FB of the previous draw() call restored by S52_GL_restoreLast()
+        _bindLastFBO();
+#else
         // load FB that was filled with the previous draw() call
         _drawFBPixels();
+#endif
     }
     break;
 
@@ -6650,6 +9098,9 @@ int        S52_GL_end(S52_GL_cycle cycle)
         return FALSE;
     }
 
+    // FB copy of drawLast()
+    _GPUtimer(-1, _GPU_OTHER);
+
     switch(_crnt_GL_cycle) {
         // optimisation: pick case 1, read pixels once at the end of the pick cycle
         //case S52_GL_PICK: _pickFBPixels(NULL); _glMatrixDel(VP_PRJ); break;
@@ -6659,7 +9110,11 @@ int        S52_GL_end(S52_GL_cycle cycle)
                           break;
 
         case S52_GL_DRAW: _fb_pixels_udp=TRUE; _glMatrixDel(VP_PRJ); break;
+#ifdef S52_USE_LAST_FBO
+        case S52_GL_LAST: _drawLastPixels();   _glMatrixDel(VP_PRJ); break;
+#else
         case S52_GL_LAST:                      _glMatrixDel(VP_PRJ); break;
+#endif
 
         case S52_GL_BLIT: break;
 
@@ -6755,6 +9210,12 @@ int        S52_GL_delDL(S52_obj *obj)
     return TRUE;
 #endif
 
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    // LC expansion cached
+    if (NULL != _LCcacheHash)
+        g_hash_table_remove(_LCcacheHash, obj);
+#endif
+
     // S57 have Display List / VBO
     if (NULL != prim) {
         guint     primNbr = 0;
@@ -6768,7 +9229,10 @@ int        S52_GL_delDL(S52_obj *obj)
 #ifdef S52_USE_OPENGL_VBO
 #if !defined(S52_USE_GLSC2)
         // delete VBO when program terminated
-        if (GL_TRUE == glIsBuffer(vboID)) {
+        // Note: 0 - area tessellated only for its AC batch (see _buildACBatch())
+        if (0 == vboID) {
+            ;
+        } else if (GL_TRUE == glIsBuffer(vboID)) {
             glDeleteBuffers(1, &vboID);
             vboID = 0;
             S57_setPrimDList(prim, vboID);
@@ -6850,6 +9314,23 @@ int        S52_GL_delDL(S52_obj *obj)
     return TRUE;
 }
 
+int        S52_GL_newPLib(void)
+// drop GL data keyed by the rules of the previous PLib (S52_DListData)
+{
+#if defined(S52_USE_GL2)
+    // AP atlas slot are keyed by the DListData of the PATT rule - cleared at next use
+    _APatlasNewPLib = TRUE;
+#endif
+
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    // LC expansion of the old symbol
+    if (NULL != _LCcacheHash)
+        g_hash_table_remove_all(_LCcacheHash);
+#endif
+
+    return TRUE;
+}
+
 #ifdef S52_USE_RASTER
 S52_GL_ras *S52_GL_newRaster(char *fnameMerc)
 {
@@ -7092,6 +9573,29 @@ static int       _validateGLcontext(void)
             _GL_EXT_robustness = (NULL== str)? FALSE : TRUE;
         }
 
+        {   // SY instancing - EXT/ANGLE/ARB_instanced_arrays or GLES3 core
+            const GLubyte *version = glGetString(GL_VERSION);
+            const char    *str     = g_strrstr((const char *)extensions, "_instanced_arrays");
+            if ((NULL==str) && (NULL!=version) && (NULL!=g_strrstr((const char *)version, "OpenGL ES 3")))
+                str = (const char *)version;
+            PRINTF("DEBUG: GL_EXT_instanced_arrays %s\n", (NULL==str)? "FAILED": "OK");
+            _GL_EXT_instanced_arrays = (NULL== str)? FALSE : TRUE;
+        }
+
+        {   // GPU timer query - S52_GL_beginGPUTimer()
+            _GL_EXT_disjoint_timer_query = (NULL==g_strrstr((const char *)extensions, "GL_EXT_disjoint_timer_query"))? FALSE : TRUE;
+            _GL_ARB_timer_query          = (NULL==g_strrstr((const char *)extensions, "GL_ARB_timer_query"))?          FALSE : TRUE;
+            PRINTF("DEBUG: GL_EXT_disjoint_timer_query %s, GL_ARB_timer_query %s\n",
+                   (TRUE==_GL_EXT_disjoint_timer_query)? "OK": "FAILED", (TRUE==_GL_ARB_timer_query)? "OK": "FAILED");
+        }
+
+        {   // LS batch - line wider than this are expanded in triangles
+            GLfloat range[2] = {1.0, 1.0};
+            glGetFloatv(GL_ALIASED_LINE_WIDTH_RANGE, range);
+            PRINTF("DEBUG: GL_ALIASED_LINE_WIDTH_RANGE max: %f\n", range[1]);
+            _lineWidthMax = range[1];
+        }
+
         {   // GL_KHR_no_error - GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR    0x00000008
             const char *str = g_strrstr((const char *)extensions, "GL_KHR_no_error ");
             PRINTF("DEBUG: GL_KHR_no_error %s\n", (NULL==str)? "FAILED": "OK");
@@ -7229,6 +9733,99 @@ int        S52_GL_done(void)
         g_array_free(_tessWorkBuf_f, TRUE);
         _tessWorkBuf_f = NULL;
     }
+    if (NULL != _LSrunBuf) {
+        g_array_free(_LSrunBuf, TRUE);
+        _LSrunBuf = NULL;
+    }
+    if (NULL != _APrunBuf) {
+        g_array_free(_APrunBuf, TRUE);
+        g_hash_table_destroy(_APbatchObj);
+        _APrunBuf   = NULL;
+        _APbatchObj = NULL;
+    }
+    if (0 != _APatlasTexID) {
+        glDeleteTextures(1, &_APatlasTexID);
+        g_hash_table_destroy(_APatlasSlot);
+        _APatlasTexID = 0;
+        _APatlasSlot  = NULL;
+    }
+#endif
+
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    S52_GL_endGPUTimer();
+    for (guint i=0; i<GPU_NRING; ++i) {
+        if (NULL != _GPUring[i].query) {
+            _GPUrecycle(&_GPUring[i]);
+            g_array_free(_GPUring[i].query, TRUE);
+            _GPUring[i].query = NULL;
+        }
+    }
+    if (NULL != _GPUfree) {
+        if ((0<_GPUfree->len) && (NULL!=_glDeleteQueries))
+            _glDeleteQueries(_GPUfree->len, (GLuint*)_GPUfree->data);
+        g_array_free(_GPUfree, TRUE);
+        _GPUfree = NULL;
+    }
+    _GPUhead = _GPUtail = 0;
+
+    if (NULL != _SYinstHash) {
+        g_hash_table_destroy(_SYinstHash);
+        g_ptr_array_free(_SYinstList, TRUE);
+        g_array_free(_SYinstVert, TRUE);
+        _SYinstHash  = NULL;
+        _SYinstList  = NULL;
+        _SYinstVert  = NULL;
+    }
+#ifdef S52_USE_FREETYPE_GL
+    if (NULL != _TXTrunHash) {
+        g_hash_table_destroy(_TXTrunHash);
+        g_array_free(_TXTbatchVert, TRUE);
+        _TXTrunHash   = NULL;
+        _TXTbatchVert = NULL;
+    }
+    if (0 != _vboTXTbatchID) {
+        glDeleteBuffers(1, &_vboTXTbatchID);
+        _vboTXTbatchID = 0;
+    }
+#endif
+    if (NULL != _LCcacheHash) {
+        g_hash_table_destroy(_LCcacheHash);
+        g_array_free(_LCtmp.vert,   TRUE);
+        g_array_free(_LCtmp.ending, TRUE);
+        _LCcacheHash  = NULL;
+        _LCtmp.vert   = NULL;
+        _LCtmp.ending = NULL;
+    }
+    for (guint i=0; i<MAX_SUBLIST; ++i) {
+        for (guint k=0; k<3; ++k) {
+            if (NULL != _LCwork[i][k]) {
+                g_array_free(_LCwork[i][k], TRUE);
+                _LCwork[i][k] = NULL;
+            }
+        }
+    }
+    if (0 != _vboSYinstID) {
+        glDeleteBuffers(1, &_vboSYinstID);
+        _vboSYinstID = 0;
+    }
+#endif
+
+#ifdef S52_USE_LAST_FBO
+    glDeleteTextures(1, &_last_pixels_id);
+    glDeleteFramebuffers(1, &_fboLastID);
+    _last_pixels_id = 0;
+    _fboLastID      = 0;
+#endif
+
+#if defined(S52_USE_TILECACHE) && defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    for (guint i=0; i<TILE_MAX; ++i) {
+        if (0 != _tileCache[i].texID)
+            glDeleteTextures(1, &_tileCache[i].texID);
+        _tileCache[i].texID = 0;
+        _tileCache[i].valid = FALSE;
+    }
+    glDeleteFramebuffers(1, &_fboTileID);
+    _fboTileID = 0;
 #endif
 
     // done texture object
@@ -7434,6 +10031,163 @@ int        S52_GL_getViewPort(int *x, int *y, int *width, int *height)
     return TRUE;
 }
 
+int        S52_GL_getStat(S52_GL_stat *stat)
+// counter since init - GL call counter are GL2 only (0 on GL1)
+{
+    stat->nObj       = _nobj;
+    stat->nCmd       = _ncmd;
+#ifdef S52_USE_GL2
+    stat->nDrawCall  = _nDrawCall;
+    stat->nVertex    = _nDrawVert;
+    stat->nVBO       = _nVBO;
+    stat->nTexUpload = _nTexUpload;
+#else
+    stat->nDrawCall  = 0;
+    stat->nVertex    = 0;
+    stat->nVBO       = 0;
+    stat->nTexUpload = 0;
+#endif
+
+    return TRUE;
+}
+
+int        S52_GL_beginGPUTimer(guint frame)
+// start GPU time of draw() / drawLast() - FALSE: no timer query
+{
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    if ((FALSE==_GL_EXT_disjoint_timer_query) && (FALSE==_GL_ARB_timer_query))
+        return FALSE;
+    if ((NULL==_glGenQueries) || (NULL==_glBeginQuery) || (NULL==_glEndQuery) ||
+        (NULL==_glGetQueryObjectuiv) || (NULL==_glGetQueryObjectui64v))
+        return FALSE;
+    if (TRUE == _GPUon)
+        S52_GL_endGPUTimer();
+
+    if (NULL == _GPUfree)
+        _GPUfree = g_array_new(FALSE, FALSE, sizeof(GLuint));
+
+    // ring full - drop the oldest rather than wait on the GPU
+    if (GPU_NRING == _GPUhead - _GPUtail)
+        _GPUrecycle(&_GPUring[_GPUtail++ % GPU_NRING]);
+
+    _GPUframe *f = &_GPUring[_GPUhead % GPU_NRING];
+    if (NULL == f->query)
+        f->query = g_array_new(FALSE, FALSE, sizeof(_GPUquery));
+    f->frame = frame;
+    f->ok    = TRUE;
+
+    // clear a stale disjoint flag (read clear it) - only when no frame in flight,
+    // else a disjoint during those would be lost (see S52_GL_getGPUTimer())
+    if ((TRUE==_GL_EXT_disjoint_timer_query) && (_GPUtail==_GPUhead)) {
+        GLint disjoint = 0;
+        glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+    }
+
+    _GPUon   = TRUE;
+    _GPUslot = -1;
+    _GPUprio = -1;
+    _GPUtimer(-1, _GPU_OTHER);
+
+    return TRUE;
+#else
+    (void)frame;
+    return FALSE;
+#endif
+}
+
+int        S52_GL_endGPUTimer(void)
+{
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    if (FALSE == _GPUon)
+        return FALSE;
+
+    if (-1 != _GPUslot)
+        _glEndQuery(GL_TIME_ELAPSED_EXT);
+
+    _GPUon   = FALSE;
+    _GPUslot = -1;
+    ++_GPUhead;
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+int        S52_GL_getGPUTimer(S52_GL_gpuTimer *timer)
+// GPU time of the oldest frame done - FALSE: none ready (never wait on the GPU)
+// Note: timer query result come in order, if the last is available all are
+{
+#if defined(S52_USE_GL2) && !defined(S52_USE_GLSC2)
+    while (_GPUtail != _GPUhead) {
+        _GPUframe *f = &_GPUring[_GPUtail % GPU_NRING];
+
+        if ((TRUE==f->ok) && (0<f->query->len)) {
+            GLuint avail = GL_FALSE;
+            _glGetQueryObjectuiv(g_array_index(f->query, _GPUquery, f->query->len-1).id, GL_QUERY_RESULT_AVAILABLE_EXT, &avail);
+            if (GL_FALSE == avail)
+                return FALSE;
+
+            // GPU time unreliable (ex: frequency change) - conservative, discard all in flight
+            if (TRUE == _GL_EXT_disjoint_timer_query) {
+                GLint disjoint = 0;
+                glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+                if (0 != disjoint) {
+                    for (guint i=_GPUtail; i!=_GPUhead; ++i)
+                        _GPUring[i % GPU_NRING].ok = FALSE;
+                }
+            }
+        }
+
+        int ok = (TRUE==f->ok) && (0<f->query->len);
+        if (TRUE == ok) {
+            memset(timer, 0, sizeof(S52_GL_gpuTimer));
+            timer->frame = f->frame;
+            for (guint i=0; i<f->query->len; ++i) {
+                _GPUquery *q  = &g_array_index(f->query, _GPUquery, i);
+                GLuint64   ns = 0;
+                _glGetQueryObjectui64v(q->id, GL_QUERY_RESULT_EXT, &ns);
+
+                double ms   = (double)ns / 1000000.0;
+                int    prio = q->slot / S52_STATS_NCMD - 1;
+                timer->total_ms                          += ms;
+                timer->cmd_ms[q->slot % S52_STATS_NCMD]  += ms;
+                if (0 <= prio)
+                    timer->prio_ms[prio] += ms;
+            }
+        }
+
+        _GPUrecycle(f);
+        ++_GPUtail;
+
+        if (TRUE == ok)
+            return TRUE;
+    }
+
+    return FALSE;
+#else
+    (void)timer;
+    return FALSE;
+#endif
+}
+
+int        S52_GL_setFBO(unsigned int fboID)
+// render to FBO 'fboID' instead of the window (0) - ie headless, no surface
+{
+#if defined(S52_USE_GL2)
+    _fboWinID  = fboID;
+    _fboCrntID = fboID;
+
+    return TRUE;
+#else
+    (void)fboID;
+
+    PRINTF("WARNING: FBO need GL2\n");
+
+    return FALSE;
+#endif
+}
+
 int        S52_GL_setScissor(int x, int y, int width, int height)
 // return TRUE;
 // when w & h < 0, GL_INVALID_VALUE is generated
@@ -7478,6 +10232,109 @@ int        S52_GL_setScissor(int x, int y, int width, int height)
     return TRUE;
 }
 
+static double     _pickX   = 0.0;  // CPU pick - cursor (projected)
+static double     _pickY   = 0.0;
+static double     _pickTol = 0.0;  // half size of the pick extent (projected)
+
+int        S52_GL_beginPick(double x, double y, double tolPix)
+// CPU pick - reset the stack of obj picked at (x,y) (projected) +/- tolPix (pixel)
+{
+    if (S52_GL_NONE != _crnt_GL_cycle) {
+        PRINTF("ERROR: inside a GL cycle\n");
+        g_assert(0);
+        return FALSE;
+    }
+
+    g_ptr_array_set_size(_objPick, 0);
+
+    _pickX   = x;
+    _pickY   = y;
+    _pickTol = tolPix * _scalex;
+
+    return TRUE;
+}
+
+static double    _getSYradius(S52_obj *obj)
+// radius (projected) of the current SY of obj - farthest bbox corner from the pivot, any rotation
+{
+    int w = 0;
+    int h = 0;
+    int x = 0;
+    int y = 0;
+    if ((FALSE==S52_PL_getSYbbox(obj, &w, &h)) || (FALSE==S52_PL_getSYpos(obj, &x, &y)))
+        return 0.0;
+
+    // bbox in 0.01 mm - the pivot can be anywhere (ex: off the bbox)
+    double dx = MAX(ABS(x), ABS(x + w)) / (_dotpitch_mm_x * 100.0);
+    double dy = MAX(ABS(y), ABS(y + h)) / (_dotpitch_mm_y * 100.0);
+
+    return sqrt(dx*dx + dy*dy) * _scalex;
+}
+
+int        S52_GL_pickObj(S52_obj *obj)
+// CPU pick - push obj on the pick stack if its SY, LS/LC or AC/AP cover the cursor
+// Note: call in draw order, top obj is last (as in _pickFBPixels())
+{
+    return_if_null(obj);
+
+    // same as S52_GL_draw() in S52_GL_PICK cycle
+    if (0 == g_strcmp0("$CSYMB", S52_PL_getOBCL(obj)))
+        return FALSE;
+
+    S57_geo *geo    = S52_PL_getGeo(obj);
+    double   radius = 0.0;     // largest SY
+    gboolean isLine = FALSE;   // LS / LC
+    gboolean isFill = FALSE;   // AC / AP
+
+    S52_CmdWrd cmdWrd = S52_PL_iniCmd(obj);
+    while (S52_CMD_NONE != cmdWrd) {
+        switch (cmdWrd) {
+            case S52_CMD_SYM_PT: radius = MAX(radius, _getSYradius(obj)); break;   // SY
+            case S52_CMD_SIM_LN:                                                    // LS
+            case S52_CMD_COM_LN: isLine = TRUE;                              break;   // LC
+            case S52_CMD_ARE_CO:                                                    // AC
+            case S52_CMD_ARE_PA: isFill = TRUE;                              break;   // AP
+            default: break;
+        }
+        cmdWrd = S52_PL_getCmdNext(obj);
+    }
+
+    gboolean hit = FALSE;
+    switch (S57_getObjtype(geo)) {
+        case S57_POINT_T: {
+            guint   npt = 0;
+            double *ppt = NULL;
+            if ((0.0<radius) && (TRUE==S57_getGeoData(geo, 0, &npt, &ppt)) && (NULL!=ppt)) {
+                double dx = ppt[0] - _pickX;
+                double dy = ppt[1] - _pickY;
+                double r  = radius + _pickTol;
+                hit = (dx*dx + dy*dy <= r*r);
+            }
+            break;
+        }
+        case S57_LINES_T:
+            if (TRUE == isLine)
+                hit = S57_isPtOnLineTol(geo, _pickX, _pickY, _pickTol);
+            break;
+        case S57_AREAS_T:
+            if (TRUE == isFill)
+                hit = S57_isPtInArea(geo, _pickX, _pickY);
+            if ((FALSE==hit) && (TRUE==isLine))
+                hit = S57_isPtOnLineTol(geo, _pickX, _pickY, _pickTol);
+            break;
+        default: break;
+    }
+
+    if (FALSE == hit)
+        return FALSE;
+
+    g_ptr_array_add(_objPick, obj);
+
+    PRINTF("DEBUG: pick: %s:%c:%i\n", S52_PL_getOBCL(obj), S57_getObjtype(geo), S57_getS57ID(geo));
+
+    return TRUE;
+}
+
 CCHAR     *S52_GL_getNameObjPick(void)
 {
     if (S52_GL_NONE != _crnt_GL_cycle) {
@@ -7730,10 +10587,17 @@ int        S52_GL_dumpS57IDPixels(const char *toFilename, S52_obj *obj, unsigned
 
     // get framebuffer pixels
 #ifdef S52_USE_GL2
-    // FIXME: arm adreno will break here
-    // FIXME: must be in sync with _fb_pixels_format
-    glReadPixels(x, y, width, height, GL_RGB,  GL_UNSIGNED_BYTE, pixels);
-    //glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    // Note: GLES2 only garanty GL_RGBA read (ie Mesa FBO, adreno) - strip alpha
+    {
+        guint8 *rgba = g_new0(guint8, width * height * 4);
+        glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+        for (guint i=0; i<width*height; ++i) {
+            pixels[i*3+0] = rgba[i*4+0];
+            pixels[i*3+1] = rgba[i*4+1];
+            pixels[i*3+2] = rgba[i*4+2];
+        }
+        g_free(rgba);
+    }
 #ifdef S52_USE_GLSC2
     int bufSize =  _vp.w * _vp.h * 4;
     _glReadnPixels(_vp.x, _vp.y, _vp.w, _vp.h, GL_RGBA, GL_UNSIGNED_BYTE, bufSize, _fb_pixels);
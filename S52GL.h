@@ -104,6 +104,63 @@ int   S52_GL_isOFFview(S52_obj *obj);
 
 // delete GL data of object (DL of geo)
 int   S52_GL_delDL(S52_obj *obj);
+// new PLib loaded - flush GL cache of the old rules
+int   S52_GL_newPLib(void);
+
+// AC batch: AC of an AREAS render bin merged in one VBO, colour looked up in the palette by the shader
+typedef struct _S52_GL_ACbatch S52_GL_ACbatch;
+S52_GL_ACbatch *S52_GL_newACBatch(GPtrArray *rbin);
+S52_GL_ACbatch *S52_GL_doneACBatch(S52_GL_ACbatch *batch);
+// rbin changed (obj moved) - rebuild at next draw
+int   S52_GL_dirtyACBatch(S52_GL_ACbatch *batch);
+// draw the AC of the first obj of objList that are in batch, then the other command of these obj
+// return the number of obj drawn - 0 if none (ex: pick, not GL2)
+guint S52_GL_drawACBatch(S52_GL_ACbatch *batch, S52_obj **objList, guint n);
+
+// LS batch: LS of a LINES render bin merged in one VBO, grouped by style / pen_w / colour
+typedef struct _S52_GL_LSbatch S52_GL_LSbatch;
+S52_GL_LSbatch *S52_GL_newLSBatch(GPtrArray *rbin);
+S52_GL_LSbatch *S52_GL_doneLSBatch(S52_GL_LSbatch *batch);
+// rbin changed (obj moved) - rebuild at next draw
+int   S52_GL_dirtyLSBatch(S52_GL_LSbatch *batch);
+// draw the LS of the first obj of objList that are in batch, then the other command of these obj
+// return the number of obj drawn - 0 if none (ex: pick, not GL2)
+guint S52_GL_drawLSBatch(S52_GL_LSbatch *batch, S52_obj **objList, guint n);
+
+// SY instancing: between begin/end, point symbol placement are collected then
+// drawn once per symbol (instanced arrays or pseudo-instancing) at end
+// return FALSE if not available (ex: pick, not GL2)
+int   S52_GL_beginSYInst(void);
+int   S52_GL_endSYInst(void);
+
+// TXT batch: between begin/end, glyph of the text of obj are collected in one
+// stream VBO then drawn with one call at end - obj NULL (legend, ..) drawn at once
+// return FALSE if not available (ex: pick, not GL2)
+int   S52_GL_beginTextBatch(void);
+int   S52_GL_endTextBatch(void);
+
+// tile cache: in the DRAW cycle, layer 0-8 of the view are drawn in tile (FBO texture) on a grid
+// per scale - S52_GL_beginTile() return the GEO extent to cull of the next tile not in cache
+// or FALSE when all tile of the view are cached, S52_GL_drawTiles() compose the view
+// return FALSE if not available (ex: not GL2, RADAR layer ON, view too large)
+int   S52_GL_beginTiles(void);
+int   S52_GL_beginTile(double *S, double *W, double *N, double *E);
+int   S52_GL_endTile(void);
+int   S52_GL_drawTiles(void);
+// FALSE if the view is rotated - text (screen upright) is then drawn over S52_GL_drawTiles()
+int   S52_GL_isTileText(void);
+// flag all tile stale (palette, MP, cell load, ..) - can be called outside a GL cycle
+int   S52_GL_delTiles(void);
+
+// partial redraw of layer 9: in the LAST cycle obj are drawn in an offscreen FB kept
+// between call (GL2) - TRUE if available
+int   S52_GL_hasLastFBO(void);
+// restore the FB of DRAW under rect (window x0,y0,x1,y1) and clip drawing to it - NULL: whole view
+// return FALSE if the whole view was restored instead of rect
+int   S52_GL_restoreLast(double *rect);
+// window extent (x0,y0,x1,y1) of a layer 9 obj with symbol, text, vector, .. margin
+// return FALSE if obj can draw anywhere in the view (ex: OWNSHP heading line, VRM/EBL)
+int   S52_GL_getLastRect(S52_obj *obj, double *rect);
 
 #ifdef S52_USE_RASTER
 S52_GL_ras *S52_GL_newRaster(char *fnameMerc);
@@ -127,9 +184,36 @@ int   S52_GL_prj2win(double *x, double *y);
 
 int   S52_GL_setViewPort(int  x, int  y, int  width, int  height);
 int   S52_GL_getViewPort(int *x, int *y, int *width, int *height);
+// headless - FB of the caller bound in place of the window
+int   S52_GL_setFBO(unsigned int fboID);
+// frame stats - counter since init (see S52_getFrameStats())
+typedef struct S52_GL_stat {
+    guint nObj;         // obj drawn (S52_GL_draw())
+    guint nCmd;         // command word rendered
+    guint nDrawCall;    // glDraw*() call (GL2)
+    guint nVertex;      // vertex submitted (GL2)
+    guint nVBO;         // VBO created (GL2)
+    guint nTexUpload;   // glTex[Sub]Image2D() (GL2)
+} S52_GL_stat;
+int   S52_GL_getStat(S52_GL_stat *stat);
+// GPU time (GL2 - EXT_disjoint_timer_query / ARB_timer_query) - result of an older frame, non-blocking
+typedef struct S52_GL_gpuTimer {
+    guint  frame;                           // frame of S52_GL_beginGPUTimer()
+    double total_ms;
+    double prio_ms[S52_STATS_NPRIO];        // by display priority of obj
+    double cmd_ms [S52_STATS_NCMD];         // by command word: AC, AP, LS, LC, SY, TX, other
+} S52_GL_gpuTimer;
+int   S52_GL_beginGPUTimer(guint frame);
+int   S52_GL_endGPUTimer(void);
+int   S52_GL_getGPUTimer(S52_GL_gpuTimer *timer);
 
 int   S52_GL_setScissor(int x, int y, int width, int height);
 
+// CPU pick: reset the pick stack - cursor (x,y) projected, tolerance in pixel
+int   S52_GL_beginPick(double x, double y, double tolPix);
+// CPU pick: push obj on the pick stack if it is under the cursor - call in draw order
+int   S52_GL_pickObj(S52_obj *obj);
+
 // return the name of the stack top object
 const
 char *S52_GL_getNameObjPick(void);
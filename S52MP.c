@@ -121,6 +121,26 @@ Or a higher-order macro:
     X(..)
 */
 
+// bit mask (S52_MP_BIT()) of param read since S52_MP_resetRead() - CS dependency
+// Note: per thread - CS are resolved concurrently (see S52.c:_app())
+#if (defined(S52_USE_ANDROID) || defined(S52_USE_MINGW))
+static guint64  _MPread = 0;
+#define MPREAD  _MPread
+#else
+static GPrivate _MPreadKey = G_PRIVATE_INIT(g_free);
+static guint64 *_getMPread(void)
+{
+    guint64 *MPread = (guint64 *) g_private_get(&_MPreadKey);
+    if (NULL == MPread) {
+        MPread = g_new0(guint64, 1);
+        g_private_set(&_MPreadKey, MPread);
+    }
+
+    return MPread;
+}
+#define MPREAD  (*_getMPread())
+#endif
+
 // WARNING: must be in sync with S52MarinerParameter (see X macro above)
 static double _MARparamVal[] = {
     0.0,      // 0 - ERROR: 0 - no error,
@@ -257,7 +277,9 @@ static double _MARparamVal[] = {
     0.0,      // 50 - S52_MAR_DISP_SCLBDY_UNION, 0 - union Scale Boundary (default), 1 - all Scale Boundary "sclbdy" (debug)
               //      Note: sclbdU:STD, sclbdy:STD
 
-    51.0      // number of parameter type
+    0.0,      // 51 - S52_MAR_DISP_CRSR_PICK_GPU, 0 - CPU pick (default), 1 - GPU pick (colour ID)
+
+    52.0      // number of parameter type
 };
 
 static double     _validate_bool(double val)
@@ -456,6 +478,8 @@ double S52_MP_get(S52MarinerParameter paramID)
 {
     //if (param<S52_MAR_ERROR || S52_MAR_NUM<=param) {
     if (S52_MAR_ERROR<=paramID && paramID<S52_MAR_NUM) {
+        MPREAD |= S52_MP_BIT(paramID);
+
         return _MARparamVal[paramID];
     } else {
         PRINTF("WARNING: param invalid(%f)\n", paramID);
@@ -544,6 +568,7 @@ int    S52_MP_set(S52MarinerParameter paramID, double val)
 
         case S52_MAR_DISP_HODATA_UNION   : val = _validate_bool(val);                   break;
         case S52_MAR_DISP_SCLBDY_UNION   : val = _validate_bool(val);                   break;
+        case S52_MAR_DISP_CRSR_PICK_GPU  : val = _validate_bool(val);                   break;
 
         // allready check
         default: break;
@@ -606,6 +631,20 @@ int    S52_MP_setTextDisp(unsigned int prioIdx, unsigned int count, unsigned int
     return TRUE;
 }
 
+guint64 S52_MP_resetRead(void)
+{
+    guint64 MPread = MPREAD;
+
+    MPREAD = 0;
+
+    return MPread;
+}
+
+guint64 S52_MP_getRead(void)
+{
+    return MPREAD;
+}
+
 int    S52_MP_getTextDisp(unsigned int prioIdx)
 {
     if (prioIdx < TEXT_IDX_MAX)
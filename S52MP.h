@@ -27,9 +27,19 @@
 
 #include "S52.h"  // S52MarinerParameter
 
+#include <glib.h> // guint64
+
+// bit of paramID in a mask of Mariners' Parameter (S52_MAR_NUM < 64)
+#define S52_MP_BIT(paramID) (G_GUINT64_CONSTANT(1) << (paramID))
+
 double S52_MP_get(S52MarinerParameter paramID);
 int    S52_MP_set(S52MarinerParameter paramID, double val);
 
+// mask of Mariners' Parameter read by S52_MP_get() since the last reset
+// (used to find which param a CS depend on)
+guint64 S52_MP_resetRead(void);
+guint64 S52_MP_getRead(void);
+
 int    S52_MP_setTextDisp(unsigned int prioIdx, unsigned int count, unsigned int state);
 int    S52_MP_getTextDisp(unsigned int prioIdx);
 
@@ -378,6 +378,9 @@ typedef struct _S52_obj {
     gboolean     prioOverride;   // TRUE if CS overide PLib display priority / same meaning as hasCS()!!
     _prios       oPrios;
 
+    // CS dependency - S52_MP_BIT() of Mariners' Param read by CS (union of all resolve)
+    guint64      MPdep;
+
     _AUX_Info    auxInfo;
 } _S52_obj;
 
@@ -1142,7 +1145,9 @@ static int        _resolveSMB(_S52_obj *obj, int alt)
     // expand CS
     S52_CS_cb CScb = cmd->cmd.CS->CScb;
     if (NULL != CScb) {
+        S52_MP_resetRead();
         obj->CSinst[alt] = CScb(obj->geo);
+        obj->MPdep      |= S52_MP_getRead();
         if (NULL!=obj->CSinst[alt] && 0!=obj->CSinst[alt]->len) {
             obj->CScmdL[alt] = _parseINST(obj->CSinst[alt], &obj->hasText[alt]);
             _cmdWL *CScmdL   = obj->CScmdL[alt];
@@ -3240,6 +3245,15 @@ int         S52_PL_isPrioO(_S52_obj *obj)
     return obj->prioOverride;
 }
 
+guint64     S52_PL_getMPdep(_S52_obj *obj)
+// Mariners' Param read by the CS of this obj, 0 if none (or not resolved yet)
+{
+    // useless - rbin
+    //return_if_null(obj);
+
+    return obj->MPdep;
+}
+
 S52_disPrio S52_PL_getDPRI(_S52_obj *obj)
 {
     return_if_null(obj);
@@ -3633,6 +3647,26 @@ int         S52_PL_getSYbbox(_S52_obj *obj, int *width, int *height)
     return TRUE;
 }
 
+int         S52_PL_getSYpos(_S52_obj *obj, int *bbox_x, int *bbox_y)
+{
+    return_if_null(obj);
+
+    _cmdWL *cmd = _getCrntCmd(obj);
+    if (NULL == cmd)
+        return FALSE;
+
+    if (NULL == cmd->cmd.def) {
+        PRINTF("DEBUG: cmd.def NULL\n");
+        g_assert(0);
+        return FALSE;
+    }
+
+    *bbox_x = cmd->cmd.def->pos.symb.bbox_x.SBXC - cmd->cmd.def->pos.symb.pivot_x.SYCL;
+    *bbox_y = cmd->cmd.def->pos.symb.bbox_y.SBXR - cmd->cmd.def->pos.symb.pivot_y.SYRW;
+
+    return TRUE;
+}
+
 #if 0
 //#ifdef S52_DEPRECATE
 /*
@@ -4951,13 +4985,14 @@ long        S52_PL_getTimeSec(_S52_obj *obj)
 }
 
 GArray     *S52_PL_getPalRGBA(void)
-// optimisation test: get RGBA from current active palette
+// get RGBA from current active palette - NULL if palette unchanged since last call
 {
     typedef struct {float r,g,b,a;} rgba_t;
     rgba_t rgba;
 
     if (NULL == _RGBA) {
         _RGBA = g_array_sized_new(FALSE, FALSE, sizeof(rgba_t), S52_COL_NUM);
+        g_array_set_size(_RGBA, S52_COL_NUM);
     }
 
     if (_crntPalNo == (int)S52_MP_get(S52_MAR_COLOR_PALETTE)) {
@@ -208,6 +208,8 @@ S52ObjectType  S52_PL_getFTYP(S52_obj *obj);
 // -- obj priority -----------------------------
 // get override prio state
 int            S52_PL_isPrioO(S52_obj *obj);
+// get mask (S52_MP_BIT()) of Mariners' Param that CS of obj depend on
+guint64        S52_PL_getMPdep(S52_obj *obj);
 // get Display PRIority
 S52_disPrio    S52_PL_getDPRI(S52_obj *obj);
 // get RADAR Priority
@@ -261,6 +263,8 @@ const char *S52_PL_getVOname(S52_vec *vecObj);
 int            S52_PL_setSYorient(S52_obj *obj, double orient);
 double         S52_PL_getSYorient(S52_obj *obj);
 int            S52_PL_getSYbbox  (S52_obj *obj, int *width, int *height);
+// bbox UL corner relative to the pivot (0.01 mm)
+int            S52_PL_getSYpos   (S52_obj *obj, int *bbox_x, int *bbox_y);
 
 // not used
 //int            S52_PL_setSYspeed (S52_obj *obj, double  speed);
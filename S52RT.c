@@ -0,0 +1,203 @@
+// S52RT.c: spatial index (packed R-tree) on object extent
+//
+// Project:  OpENCview
+
+/*
+    This file is part of the OpENCview project, a viewer of ENC.
+    Copyright (C) 2000-2018 Sylvain Duclos sduclos@users.sourceforge.net
+
+    OpENCview is free software: you can redistribute it and/or modify
+    it under the terms of the Lesser GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpENCview is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Lesser GNU General Public License for more details.
+
+    You should have received a copy of the Lesser GNU General Public License
+    along with OpENCview.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+// Note: Sort-Tile-Recursive bulk load (Leutenegger, Lopez, Edgington 1997).
+// Object in a cell are static once loaded, so the tree is packed (100% node fill)
+// and never updated - a new tree is built when the indexed array change.
+
+#include "S52RT.h"
+#include "S52utils.h"   // return_if_null()
+
+#include <math.h>       // ceil(), sqrt(), isnan()
+#include <stdlib.h>     // qsort()
+
+#define NODE_CAP 16     // max nbr of child per node
+
+typedef struct _RTnode {
+    ObjExt_t ext;       // leaf: item extent, node: union of child extent
+    guint    first;     // leaf: index in items, node: index of first child in the level bellow
+    guint    count;     // leaf: 0,              node: nbr of child
+} _RTnode;
+
+typedef struct _S52_RT {
+    guint      nItem;
+    GPtrArray *levels;  // GArray of _RTnode - levels[0]: leaf, levels[len-1]: root
+} _S52_RT;
+
+
+static double     _center(double a, double b)
+// center of extent on one axe - no extent ($CSYMB, ..) give +/-INFINITY
+{
+    double c = (a + b) / 2.0;
+
+    return isnan(c) ? 0.0 : c;
+}
+
+static int        _cmpX(const void *a, const void *b)
+{
+    const _RTnode *A = (const _RTnode *) a;
+    const _RTnode *B = (const _RTnode *) b;
+    double cA = _center(A->ext.W, A->ext.E);
+    double cB = _center(B->ext.W, B->ext.E);
+
+    return (cA < cB) ? -1 : (cA > cB) ? 1 : 0;
+}
+
+static int        _cmpY(const void *a, const void *b)
+{
+    const _RTnode *A = (const _RTnode *) a;
+    const _RTnode *B = (const _RTnode *) b;
+    double cA = _center(A->ext.S, A->ext.N);
+    double cB = _center(B->ext.S, B->ext.N);
+
+    return (cA < cB) ? -1 : (cA > cB) ? 1 : 0;
+}
+
+static int        _cmpIdx(const void *a, const void *b)
+{
+    guint A = *(const guint *) a;
+    guint B = *(const guint *) b;
+
+    return (A < B) ? -1 : (A > B) ? 1 : 0;
+}
+
+static void       _freeLevel(gpointer level)
+{
+    g_array_free((GArray *) level, TRUE);
+}
+
+static GArray    *_newLevel(GArray *bellow)
+// STR: sort 'bellow' in vertical slice of S*NODE_CAP node (on X), each slice sorted on Y,
+// then pack NODE_CAP consecutive node under one parent
+// Note: node of 'bellow' can be reordered as they keep their own child range
+{
+    guint    n      = bellow->len;
+    guint    nNode  = (n + NODE_CAP - 1) / NODE_CAP;
+    guint    nSlice = (guint) ceil(sqrt((double) nNode));
+    guint    sliceN = nSlice * NODE_CAP;
+    _RTnode *node   = (_RTnode *) bellow->data;
+
+    qsort(node, n, sizeof(_RTnode), _cmpX);
+    for (guint i=0; i<n; i+=sliceN) {
+        qsort(node + i, MIN(sliceN, n-i), sizeof(_RTnode), _cmpY);
+    }
+
+    GArray *level = g_array_sized_new(FALSE, FALSE, sizeof(_RTnode), nNode);
+    for (guint i=0; i<n; i+=NODE_CAP) {
+        _RTnode parent = {node[i].ext, i, MIN(NODE_CAP, n-i)};
+
+        for (guint j=i+1; j<i+parent.count; ++j) {
+            if (parent.ext.W > node[j].ext.W) parent.ext.W = node[j].ext.W;
+            if (parent.ext.S > node[j].ext.S) parent.ext.S = node[j].ext.S;
+            if (parent.ext.E < node[j].ext.E) parent.ext.E = node[j].ext.E;
+            if (parent.ext.N < node[j].ext.N) parent.ext.N = node[j].ext.N;
+        }
+
+        g_array_append_val(level, parent);
+    }
+
+    return level;
+}
+
+S52_RT    *S52_RT_new(GPtrArray *items, S52_RT_ext_cb ext_cb)
+// return NULL if nothing to index
+{
+    return_if_null(items);
+    return_if_null(ext_cb);
+
+    if (0 == items->len)
+        return NULL;
+
+    _S52_RT *rt = g_new0(_S52_RT, 1);
+    rt->nItem   = items->len;
+    rt->levels  = g_ptr_array_new_with_free_func(_freeLevel);
+
+    GArray *leaf = g_array_sized_new(FALSE, FALSE, sizeof(_RTnode), items->len);
+    for (guint i=0; i<items->len; ++i) {
+        _RTnode node = {ext_cb(g_ptr_array_index(items, i)), i, 0};
+        g_array_append_val(leaf, node);
+    }
+    g_ptr_array_add(rt->levels, leaf);
+
+    GArray *level = leaf;
+    while (1 < level->len) {
+        level = _newLevel(level);
+        g_ptr_array_add(rt->levels, level);
+    }
+
+    return rt;
+}
+
+S52_RT    *S52_RT_done(_S52_RT *rt)
+{
+    if (NULL == rt)
+        return NULL;
+
+    g_ptr_array_free(rt->levels, TRUE);
+    g_free(rt);
+
+    return NULL;
+}
+
+guint      S52_RT_len(_S52_RT *rt)
+{
+    return (NULL == rt) ? 0 : rt->nItem;
+}
+
+static void       _search(_S52_RT *rt, guint lvl, guint first, guint count, ObjExt_t ext, GArray *idxList)
+{
+    GArray *level = (GArray *) g_ptr_array_index(rt->levels, lvl);
+
+    for (guint i=first; i<first+count; ++i) {
+        _RTnode *node = &g_array_index(level, _RTnode, i);
+
+        if (FALSE == S57_cmpExt(node->ext, ext))
+            continue;
+
+        if (0 == lvl)
+            g_array_append_val(idxList, node->first);
+        else
+            _search(rt, lvl-1, node->first, node->count, ext, idxList);
+    }
+
+    return;
+}
+
+guint      S52_RT_search(_S52_RT *rt, ObjExt_t ext, GArray *idxList)
+{
+    if (NULL==rt || NULL==idxList)
+        return 0;
+
+    guint   start = idxList->len;
+    guint   top   = rt->levels->len - 1;
+    GArray *root  = (GArray *) g_ptr_array_index(rt->levels, top);
+
+    _search(rt, top, 0, root->len, ext, idxList);
+
+    // leaf are in STR order - put back in item order (draw order)
+    guint n = idxList->len - start;
+    if (1 < n)
+        qsort(&g_array_index(idxList, guint, start), n, sizeof(guint), _cmpIdx);
+
+    return n;
+}
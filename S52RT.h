@@ -0,0 +1,47 @@
+// S52RT.h: spatial index (packed R-tree) on object extent
+//
+// Project:  OpENCview
+
+/*
+    This file is part of the OpENCview project, a viewer of ENC.
+    Copyright (C) 2000-2018 Sylvain Duclos sduclos@users.sourceforge.net
+
+    OpENCview is free software: you can redistribute it and/or modify
+    it under the terms of the Lesser GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpENCview is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Lesser GNU General Public License for more details.
+
+    You should have received a copy of the Lesser GNU General Public License
+    along with OpENCview.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+
+#ifndef _S52RT_H_
+#define _S52RT_H_
+
+#include "S57data.h"    // ObjExt_t
+
+#include <glib.h>       // GPtrArray, GArray
+
+// return the extent of an item of the array indexed
+typedef ObjExt_t (*S52_RT_ext_cb)(gpointer item);
+
+typedef struct _S52_RT S52_RT;
+
+// bulk load (Sort-Tile-Recursive) an index on 'items' - the tree is static,
+// a change in 'items' (add, del, reorder) need a new tree
+S52_RT *S52_RT_new   (GPtrArray *items, S52_RT_ext_cb ext_cb);
+S52_RT *S52_RT_done  (S52_RT *rt);
+guint   S52_RT_len   (S52_RT *rt);
+// append to 'idxList' (guint) the index in 'items' of item that intersect 'ext'
+// Note: index are sorted (ie same order as 'items')
+// return the number of index appended
+guint   S52_RT_search(S52_RT *rt, ObjExt_t ext, GArray *idxList);
+
+#endif //_S52RT_H_
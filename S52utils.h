@@ -72,6 +72,7 @@ if (NULL==ptr) {                             \
 #define CFG_CHART    "CHART"
 #define CFG_WORLD    "WORLD"
 #define CFG_TTF      "TTF"
+#define CFG_SENC     "SENC"
 
 #define MAXL 1024    // MAX lenght of buffer _including_ '\0'
 typedef char valueBuf[MAXL];
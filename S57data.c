@@ -24,7 +24,7 @@
 #include "S57data.h"    // S57_geo
 //#include "S52utils.h"   // PRINTF()
 
-#include <math.h>       // INFINITY, nearbyint()
+#include <math.h>       // INFINITY, nearbyint(), floor()
 
 #ifdef S52_USE_PROJ
 static projPJ      _pjsrc   = NULL;   // projection source
@@ -47,7 +47,72 @@ static const char *_argssrc = "+proj=latlong +ellps=WGS84 +datum=WGS84";
 //#define EMPTY_NUMBER_MARKER "2147483641"  /* MAXINT-6 */
 
 // object's internal ID
-static unsigned int _S57ID = 1;  // start at 1, the number of object loaded
+// Note: atomic - geo are also created by loader thread (S52_loadCellAsync())
+// Note: a loader thread defer S57ID until its cell is swapped in, so that
+// S57ID follow the cell load order (same as serial loading)
+#if (defined(S52_USE_ANDROID) || defined(S52_USE_MINGW))
+static unsigned int  _S57ID = 1;  // start at 1, the number of object loaded
+#else
+static volatile gint _S57ID = 1;  // start at 1, the number of object loaded
+static GPrivate      _deferS57ID = G_PRIVATE_INIT(NULL);  // !NULL: this thread defer S57ID
+#endif
+
+static guint  _newS57ID(void)
+// 0 if defered (set later by S57_setS57ID())
+{
+#if (defined(S52_USE_ANDROID) || defined(S52_USE_MINGW))
+    return _S57ID++;
+#else
+    if (NULL != g_private_get(&_deferS57ID))
+        return 0;
+
+    return (guint) g_atomic_int_add(&_S57ID, 1);
+#endif
+}
+
+// bump allocator for the geo of a cell (coord + S57_geo) - see S57_newArena()
+// Note: geo of a cell are static once loaded, so nothing is freed before the cell
+#define ARENA_CHUNK  (1024*1024)       // 1MB
+#define ARENA_ALIGN  sizeof(double)
+
+typedef struct _S57_arena {
+    GPtrArray *chunks;   // all block alloc'ed - freed by S57_doneArena()
+    guchar    *crnt;     // block being filled
+    gsize      used;     // byte used in crnt
+} _S57_arena;
+
+// current arena of the calling thread (NULL: heap)
+#if (defined(S52_USE_ANDROID) || defined(S52_USE_MINGW))
+static _S57_arena   *_arena    = NULL;
+#define ARENA         _arena
+#else
+static GPrivate      _arenaKey = G_PRIVATE_INIT(NULL);
+#define ARENA         ((_S57_arena *) g_private_get(&_arenaKey))
+#endif
+
+static gpointer      _newArenaMem(_S57_arena *arena, gsize size)
+// zeroed mem (chunk are g_malloc0)
+{
+    size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+
+    // big alloc get a block of its own - keep filling crnt
+    if (ARENA_CHUNK/4 < size) {
+        guchar *mem = (guchar *) g_malloc0(size);
+        g_ptr_array_add(arena->chunks, mem);
+        return mem;
+    }
+
+    if ((NULL==arena->crnt) || (ARENA_CHUNK < arena->used+size)) {
+        arena->crnt = (guchar *) g_malloc0(ARENA_CHUNK);
+        arena->used = 0;
+        g_ptr_array_add(arena->chunks, arena->crnt);
+    }
+
+    gpointer mem = arena->crnt + arena->used;
+    arena->used += size;
+
+    return mem;
+}
 
 // data for glDrawArrays()
 typedef struct _prim {
@@ -68,6 +133,24 @@ typedef struct _S57_prim {
 // S57 object geo data
 #define S57_ATT_NM_LN    6   // S57 Class Attribute Name lenght
 #define S57_GEO_NM_LN   13   // GDAL/OGR primitive max name length: "ConnectedNode"
+// attribute value type - parsed once by S57_setAtt()
+typedef enum _S57_attType {
+    _ATT_STR  = 0,      // not a number (text, list, ..) - typed getter parse str
+    _ATT_INT,           // val.i
+    _ATT_REAL,          // val.f
+    _ATT_OMIT           // mandatory attribute with value omitted (EMPTY_NUMBER_MARKER)
+} _S57_attType;
+
+typedef struct _S57_att {
+    S57_AttID     id;   // interned attribute name
+    _S57_attType  type;
+    union {
+        int       i;
+        double    f;
+    } val;
+    GString      *str;  // original value - S57_getAttVal()
+} _S57_att;
+
 typedef struct _S57_geo {
     guint        S57ID;          // record ID / S52ObjectHandle use as index in S52_obj GPtrArray
                                  // Note: must be the first member for S57_getS57ID(geo)
@@ -119,7 +202,7 @@ typedef struct _S57_geo {
 //2350410 valName:LNAM
 
     //gooblean     isUTF8;  // text in attribs
-    GData       *attribs;
+    GArray      *attribs;     // _S57_att in insertion order
 
 #ifdef S52_USE_C_AGGR_C_ASSO
     // point to the S57 relationship object C_AGGR / C_ASSO this S57_geo belong
@@ -158,6 +241,12 @@ typedef struct _S57_geo {
 
     gboolean     highlight;  // highlight this geo object (cursor pick / hazard - experimental)
 
+    gboolean     inArena;    // TRUE: this geo and its coord are in a cell arena - freed by S57_doneArena()
+
+    // LOD 1..S57_LOD_NUM-1 (simplified LINES / AREAS in projected coord) - NULL: use the finer LOD
+    guint       *lodOff[S57_LOD_NUM];  // start of ring in lodxyz, [ringnbr]: end
+    geocoord    *lodxyz[S57_LOD_NUM];  // not in arena - freed by S57_doneData()
+
     //gboolean     hazard;     // TRUE if a Safety Contour / hazard - use by leglin and GUARDZONE
 
     // optimisation: set LOD
@@ -590,6 +679,363 @@ int        S57_geo2prj(_S57_geo *geo)
     return TRUE;
 }
 
+// LOD - RDP simplified line / ring of a cell in projected coord (S57_newLOD())
+// Note: a vertex where the set of geo owning the segment before and after differ is
+// kept (node), so an edge shared by adjacent geo simplify the same way from each side
+#define S57_LOD_TOL0  10.0        // meter - LOD 1: 10, LOD 2: 50, LOD 3: 250
+#define S57_LOD_FAC    5.0
+
+typedef struct _LODseg {
+    guint64 key;    // segment - same both way
+    guint64 sig;    // sum of the signature of the geo owning this segment
+} _LODseg;
+
+static guint64 _mix64(guint64 h)
+// splitmix64 finalizer
+{
+    h ^= h >> 30;
+    h *= G_GUINT64_CONSTANT(0xbf58476d1ce4e5b9);
+    h ^= h >> 27;
+    h *= G_GUINT64_CONSTANT(0x94d049bb133111eb);
+    h ^= h >> 31;
+
+    return h;
+}
+
+static guint64 _LODptKey(pt3 *p)
+{
+    guint64 x = 0;
+    guint64 y = 0;
+    memcpy(&x, &p->x, sizeof(x));
+    memcpy(&y, &p->y, sizeof(y));
+
+    return _mix64(x ^ _mix64(y));
+}
+
+static guint64 _LODsegKey(pt3 *a, pt3 *b)
+{
+    guint64 ka = _LODptKey(a);
+    guint64 kb = _LODptKey(b);
+
+    return _mix64(MIN(ka, kb) * 31 + MAX(ka, kb));
+}
+
+static int     _cmpLODseg(gconstpointer a, gconstpointer b)
+{
+    const _LODseg *A = (const _LODseg *) a;
+    const _LODseg *B = (const _LODseg *) b;
+
+    return (A->key < B->key) ? -1 : (A->key > B->key) ? 1 : 0;
+}
+
+static guint64 _getLODsig(GArray *segs, pt3 *a, pt3 *b)
+{
+    _LODseg  key = {_LODsegKey(a, b), 0};
+    _LODseg *seg = (_LODseg *) bsearch(&key, segs->data, segs->len, sizeof(_LODseg), _cmpLODseg);
+
+    return (NULL == seg) ? 0 : seg->sig;
+}
+
+static gboolean _isPtLess(pt3 *a, pt3 *b)
+// tie-break - same result whatever the direction of the line
+{
+    return (a->x < b->x) || ((a->x == b->x) && (a->y < b->y));
+}
+
+static double  _distPtSeg2(pt3 *p, pt3 *a, pt3 *b)
+// square of the distance from p to segment ab
+{
+    double dx = b->x - a->x;
+    double dy = b->y - a->y;
+    double l2 = dx*dx + dy*dy;
+    double t  = (0.0 == l2) ? 0.0 : ((p->x - a->x)*dx + (p->y - a->y)*dy) / l2;
+    t = (t < 0.0) ? 0.0 : (t > 1.0) ? 1.0 : t;
+
+    double ex = a->x + t*dx - p->x;
+    double ey = a->y + t*dy - p->y;
+
+    return ex*ex + ey*ey;
+}
+
+static void    _RDP(pt3 *p, guint m, guint a, guint len, double tol2, guchar *keep, GArray *stack)
+// Ramer-Douglas-Peucker on the chain a .. a+len (vertex index modulo m)
+{
+    g_array_set_size(stack, 0);
+    guint o[2] = {0, len};
+    g_array_append_vals(stack, o, 2);
+
+    while (0 < stack->len) {
+        guint o1 = g_array_index(stack, guint, stack->len-1);
+        guint o0 = g_array_index(stack, guint, stack->len-2);
+        g_array_set_size(stack, stack->len-2);
+
+        pt3   *A    = &p[(a + o0) % m];
+        pt3   *B    = &p[(a + o1) % m];
+        guint  best = 0;
+        double dmax = -1.0;
+        for (guint k=o0+1; k<o1; ++k) {
+            pt3   *P = &p[(a + k) % m];
+            double d = _distPtSeg2(P, A, B);
+            if ((d > dmax) || ((d == dmax) && _isPtLess(P, &p[(a + best) % m]))) {
+                dmax = d;
+                best = k;
+            }
+        }
+
+        if (dmax > tol2) {
+            keep[(a + best) % m] = TRUE;
+            guint s[4] = {o0, best, best, o1};
+            g_array_append_vals(stack, s, 4);
+        }
+    }
+
+    return;
+}
+
+static void    _LODchain(pt3 *p, guint npt, gboolean ring, GArray *segs, double tol, guchar *keep, GArray *stack)
+// flag vertex to keep at this tolerance
+{
+    // ring: last vertex is the first
+    guint m = (TRUE == ring) ? npt - 1 : npt;
+
+    memset(keep, 0, m);
+
+    // anchor: end of line, node, overlap (Z) change
+    for (guint i=0; i<m; ++i) {
+        if ((FALSE==ring) && ((0==i) || (m-1==i))) {
+            keep[i] = TRUE;
+            continue;
+        }
+
+        pt3 *p0 = &p[(i + m - 1) % m];
+        pt3 *p1 = &p[i];
+        pt3 *p2 = &p[(i + 1) % m];
+        if ((p0->z != p1->z) || (p1->z != p2->z) ||
+            (_getLODsig(segs, p0, p1) != _getLODsig(segs, p1, p2)))
+            keep[i] = TRUE;
+    }
+
+    if (TRUE == ring) {
+        // ring without node - anchor on the min vertex and the vertex the farthest from it
+        guint nAnchor = 0;
+        guint first   = 0;
+        for (guint i=0; i<m; ++i) {
+            if (TRUE == keep[i]) {
+                if (0 == nAnchor++)
+                    first = i;
+            }
+        }
+        if (0 == nAnchor) {
+            for (guint i=1; i<m; ++i)
+                if (_isPtLess(&p[i], &p[first]))
+                    first = i;
+            keep[first] = TRUE;
+            nAnchor     = 1;
+        }
+        if (1 == nAnchor) {
+            guint  far  = first;
+            double dmax = -1.0;
+            for (guint i=0; i<m; ++i) {
+                double d = _distPtSeg2(&p[i], &p[first], &p[first]);
+                if ((d > dmax) || ((d == dmax) && _isPtLess(&p[i], &p[far]))) {
+                    dmax = d;
+                    far  = i;
+                }
+            }
+            keep[far] = TRUE;
+        }
+
+        // chain between anchor - wrap
+        guint a = first;
+        do {
+            guint len = 1;
+            while (FALSE == keep[(a + len) % m])
+                ++len;
+            _RDP(p, m, a, len, tol*tol, keep, stack);
+            a = (a + len) % m;
+        } while (a != first);
+    } else {
+        guint a = 0;
+        while (a < m-1) {
+            guint len = 1;
+            while (FALSE == keep[a + len])
+                ++len;
+            _RDP(p, m, a, len, tol*tol, keep, stack);
+            a += len;
+        }
+    }
+
+    return;
+}
+
+static int     _setGeoLOD(_S57_geo *geo, GArray *segs, GArray *stack)
+// simplify all ring from LOD 0 - keep a LOD only if it has less vertex than the previous one
+{
+    guint nr    = S57_getRingNbr(geo);
+    guint nPrev = 0;    // nbr of vertex in the previous LOD
+
+    for (guint r=0; r<nr; ++r) {
+        guint   npt = 0;
+        double *ppt = NULL;
+        S57_getGeoData(geo, r, &npt, &ppt);
+        nPrev += (NULL == ppt) ? 0 : npt;
+    }
+
+    for (guint lod=1; lod<S57_LOD_NUM; ++lod) {
+        GArray *xyz = g_array_new(FALSE, FALSE, sizeof(pt3));
+        guint  *off = g_new0(guint, nr+1);
+
+        for (guint r=0; r<nr; ++r) {
+            guint   npt = 0;
+            double *ppt = NULL;
+            S57_getGeoData(geo, r, &npt, &ppt);
+
+            off[r] = xyz->len;
+
+            pt3 *p = (pt3 *) ppt;
+            if (NULL == p)
+                continue;
+            if (npt < 3) {
+                g_array_append_vals(xyz, p, npt);
+                continue;
+            }
+
+            gboolean ring = (4<=npt) && (p[0].x==p[npt-1].x) && (p[0].y==p[npt-1].y);
+            guint    m    = (TRUE == ring) ? npt-1 : npt;
+            guchar  *keep = g_new(guchar, m);
+
+            _LODchain(p, npt, ring, segs, S57_getLODtol(lod), keep, stack);
+
+            if (TRUE == ring) {
+                // start on a kept vertex and close
+                guint first = 0;
+                while (FALSE == keep[first])
+                    ++first;
+                for (guint i=0; i<m; ++i)
+                    if (TRUE == keep[(first + i) % m])
+                        g_array_append_val(xyz, p[(first + i) % m]);
+                g_array_append_val(xyz, p[first]);
+            } else {
+                for (guint i=0; i<m; ++i)
+                    if (TRUE == keep[i])
+                        g_array_append_val(xyz, p[i]);
+            }
+
+            g_free(keep);
+        }
+        off[nr] = xyz->len;
+
+        // no gain - S57_getGeoDataLOD() fall back to the finer LOD
+        if (xyz->len >= nPrev) {
+            g_array_free(xyz, TRUE);
+            g_free(off);
+            continue;
+        }
+
+        nPrev            = xyz->len;
+        geo->lodOff[lod] = off;
+        geo->lodxyz[lod] = (geocoord *) g_array_free(xyz, FALSE);
+    }
+
+    return TRUE;
+}
+
+static int     _doneLOD(_S57_geo *geo)
+{
+    for (guint lod=1; lod<S57_LOD_NUM; ++lod) {
+        g_free(geo->lodOff[lod]);
+        g_free(geo->lodxyz[lod]);
+        geo->lodOff[lod] = NULL;
+        geo->lodxyz[lod] = NULL;
+    }
+
+    return TRUE;
+}
+
+double     S57_getLODtol(guint lod)
+{
+    return (0 == lod) ? 0.0 : S57_LOD_TOL0 * pow(S57_LOD_FAC, lod - 1);
+}
+
+int        S57_newLOD(GPtrArray *geoList)
+{
+    return_if_null(geoList);
+
+    // segment of all line / ring of the cell with the geo owning them
+    GArray *segs = g_array_new(FALSE, FALSE, sizeof(_LODseg));
+    for (guint i=0; i<geoList->len; ++i) {
+        _S57_geo *geo = (_S57_geo *) g_ptr_array_index(geoList, i);
+        if ((S57_LINES_T!=geo->objType) && (S57_AREAS_T!=geo->objType))
+            continue;
+
+        guint64 sig = _mix64(geo->S57ID + 1);
+        guint   nr  = S57_getRingNbr(geo);
+        for (guint r=0; r<nr; ++r) {
+            guint   npt = 0;
+            double *ppt = NULL;
+            if ((FALSE==S57_getGeoData(geo, r, &npt, &ppt)) || (NULL==ppt))
+                continue;
+
+            pt3 *p = (pt3 *) ppt;
+            for (guint k=1; k<npt; ++k) {
+                _LODseg seg = {_LODsegKey(&p[k-1], &p[k]), sig};
+                g_array_append_val(segs, seg);
+            }
+        }
+    }
+
+    // merge owner of the same segment
+    g_array_sort(segs, _cmpLODseg);
+    guint n = 0;
+    for (guint i=0; i<segs->len; ++i) {
+        _LODseg *s = &g_array_index(segs, _LODseg, i);
+        if ((0 < n) && (s->key == g_array_index(segs, _LODseg, n-1).key)) {
+            g_array_index(segs, _LODseg, n-1).sig += s->sig;
+        } else {
+            g_array_index(segs, _LODseg, n++) = *s;
+        }
+    }
+    g_array_set_size(segs, n);
+
+    GArray *stack = g_array_new(FALSE, FALSE, sizeof(guint));
+    for (guint i=0; i<geoList->len; ++i) {
+        _S57_geo *geo = (_S57_geo *) g_ptr_array_index(geoList, i);
+        if ((S57_LINES_T!=geo->objType) && (S57_AREAS_T!=geo->objType))
+            continue;
+
+        _doneLOD(geo);
+        _setGeoLOD(geo, segs, stack);
+    }
+
+    g_array_free(stack, TRUE);
+    g_array_free(segs,  TRUE);
+
+    return TRUE;
+}
+
+int        S57_getGeoDataLOD(_S57_geo *geo, guint ringNo, guint lod, guint *npt, double **ppt)
+{
+    return_if_null(geo);
+
+    lod = MIN(lod, S57_LOD_NUM-1);
+    while ((0 < lod) && (NULL == geo->lodxyz[lod]))
+        --lod;
+
+    if (0 == lod)
+        return S57_getGeoData(geo, ringNo, npt, ppt);
+
+    if (ringNo >= S57_getRingNbr(geo)) {
+        *npt = 0;
+        *ppt = NULL;
+        return FALSE;
+    }
+
+    *npt = geo->lodOff[lod][ringNo+1] - geo->lodOff[lod][ringNo];
+    *ppt = geo->lodxyz[lod] + geo->lodOff[lod][ringNo]*3;
+
+    return TRUE;
+}
+
 static int    _doneGeoData(_S57_geo *geo)
 // delete the geo data it self - data from OGR is a copy
 {
@@ -598,6 +1044,18 @@ static int    _doneGeoData(_S57_geo *geo)
     return TRUE;
 #endif
 
+    // coord freed with the arena
+    if (TRUE == geo->inArena) {
+        geo->pointxyz   = NULL;
+        geo->linexyz    = NULL;
+        geo->ringxyz    = NULL;
+        geo->ringxyznbr = NULL;
+        geo->linexyznbr = 0;
+        geo->ringnbr    = 0;
+
+        return TRUE;
+    }
+
     // POINT
     if (NULL != geo->pointxyz) {
         g_free((geocoord*)geo->pointxyz);
@@ -651,30 +1109,51 @@ int        S57_doneData   (_S57_geo *geo, gpointer user_data)
 
     _doneGeoData(geo);
 
+    _doneLOD(geo);
+
     S57_donePrimGeo(geo);
 
-    if (NULL != geo->attribs)
-        g_datalist_clear(&geo->attribs);
+    if (NULL != geo->attribs) {
+        for (guint i=0; i<geo->attribs->len; ++i)
+            g_string_free(g_array_index(geo->attribs, _S57_att, i).str, TRUE);
+        g_array_free(geo->attribs, TRUE);
+        geo->attribs = NULL;
+    }
 
     if (NULL != geo->centroid)
         g_array_free(geo->centroid, TRUE);
 
-    g_free(geo);
+    if (FALSE == geo->inArena)
+        g_free(geo);
 
     return TRUE;
 }
 
-S57_geo   *S57_setPOINT(geocoord *xyz)
+static _S57_geo *_newGeo(void)
+// from the current arena if any
 {
-    return_if_null(xyz);
+    _S57_arena *arena = ARENA;
+    if (NULL != arena) {
+        _S57_geo *geo = (_S57_geo *) _newArenaMem(arena, sizeof(_S57_geo));
+        geo->inArena  = TRUE;
+        return geo;
+    }
 
-    // FIXME: use g_slice()
     _S57_geo *geo = g_new0(_S57_geo, 1);
     //_S57_geo *geo = g_try_new0(_S57_geo, 1);
     if (NULL == geo)
         g_assert(0);
 
-    geo->S57ID    = _S57ID++;
+    return geo;
+}
+
+S57_geo   *S57_setPOINT(geocoord *xyz)
+{
+    return_if_null(xyz);
+
+    _S57_geo *geo = _newGeo();
+
+    geo->S57ID    = _newS57ID();
     geo->objType  = S57_POINT_T;
     geo->pointxyz = xyz;
 
@@ -711,13 +1190,9 @@ S57_geo   *S57_setLINES(guint xyznbr, geocoord *xyz)
     // Edge might have 0 node
     //return_if_null(xyz);
 
-    // FIXME: use g_slice()
-    _S57_geo *geo = g_new0(_S57_geo, 1);
-    //_S57_geo *geo = g_try_new0(_S57_geo, 1);
-    if (NULL == geo)
-        g_assert(0);
+    _S57_geo *geo = _newGeo();
 
-    geo->S57ID      = _S57ID++;
+    geo->S57ID      = _newS57ID();
     geo->objType    = S57_LINES_T;
     geo->linexyznbr = xyznbr;
     geo->linexyz    = xyz;
@@ -768,13 +1243,9 @@ S57_geo   *S57_setAREAS(guint ringnbr, guint *ringxyznbr, geocoord **ringxyz)
     return_if_null(ringxyznbr);
     return_if_null(ringxyz);
 
-    // FIXME: use g_slice()
-    _S57_geo *geo = g_new0(_S57_geo, 1);
-    //_S57_geo *geo = g_try_new0(_S57_geo, 1);
-    if (NULL == geo)
-        g_assert(0);
+    _S57_geo *geo = _newGeo();
 
-    geo->S57ID      = _S57ID++;
+    geo->S57ID      = _newS57ID();
     geo->objType    = S57_AREAS_T;
     geo->ringnbr    = ringnbr;
     geo->ringxyznbr = ringxyznbr;
@@ -802,13 +1273,9 @@ S57_geo   *S57_setAREAS(guint ringnbr, guint *ringxyznbr, geocoord **ringxyz)
 
 S57_geo   *S57_set_META(void)
 {
-    // FIXME: use g_slice()
-    _S57_geo *geo = g_new0(_S57_geo, 1);
-    //_S57_geo *geo = g_try_new0(_S57_geo, 1);
-    if (NULL == geo)
-        g_assert(0);
+    _S57_geo *geo = _newGeo();
 
-    geo->S57ID  = _S57ID++;
+    geo->S57ID  = _newS57ID();
     geo->objType= S57__META_T;
 
     geo->ext.W  =  INFINITY;
@@ -1174,6 +1641,12 @@ ObjExt_t   S57_getGeoExt(_S57_geo *geo)
     return geo->ext;
 }
 
+ObjExt_t   S57_getGeoExtRaw(_S57_geo *geo)
+// extent as compared by S57_cmpGeoExt()
+{
+    return geo->ext;
+}
+
 gboolean   S57_cmpGeoExt(_S57_geo *geoA, _S57_geo *geoB)
 // TRUE if intersect else FALSE
 
@@ -1382,7 +1855,31 @@ void       S57_getGeoWindowBoundary(double lat, double lng, double scale, int wi
 
 static guint   _qMax = 0;
 //static GArray *_qList    = NULL;
-static guint _qcnt[500] = {0};
+// Note: atomic - attribute are also read by loader thread (S52_CS_touch())
+static gint  _qcnt[500] = {0};
+
+static _S57_att *_findAtt(_S57_geo *geo, S57_AttID attID)
+// Note: few attribute per object - scan of packed id
+{
+    if (NULL==geo->attribs || 0==attID)
+        return NULL;
+
+    _S57_att *att = (_S57_att *) geo->attribs->data;
+    for (guint i=0; i<geo->attribs->len; ++i) {
+        if (attID == att[i].id)
+            return &att[i];
+    }
+
+    return NULL;
+}
+
+S57_AttID  S57_getAttID(const char *attName)
+{
+    return_if_null(attName);
+
+    return g_quark_from_string(attName);
+}
+
 GString   *S57_getAttVal(_S57_geo *geo, const char *attName)
 // return attribute string value or NULL if:
 //      1 - attribute name abscent
@@ -1391,79 +1888,21 @@ GString   *S57_getAttVal(_S57_geo *geo, const char *attName)
     return_if_null(geo);
     return_if_null(attName);
 
-    // FIXME: check and time for direct value in geo (heading / course)
-/*
-110 1 valName:DSID_INTU
-112 1 valName:DSID_EDTN
-113 1 valName:DSID_UPDN
-114 1 valName:DSID_UADT
-115 1 valName:DSID_ISDT
-134 1 valName:DSPM_HDAT
-135 1 valName:DSPM_VDAT
-136 1 valName:DSPM_SDAT
-137 1 valName:DSPM_CSCL
-138 1 valName:DSPM_DUNI
-139 1 valName:DSPM_HUNI
-145 15262 valName:SCAMIN
-146 1 valName:DSID_SDAT
-147 1 valName:DSID_VDAT
-148 2350410 valName:LNAM
-150 7538 valName:RCID
-154 2754 valName:NAME_RCID_0
-160 2754 valName:NAME_RCID_1
-167 4975 valName:OBJL
-171 4106 valName:NAME_RCNM
-172 4106 valName:NAME_RCID
-176 522 valName:CATBRG
-177 26 valName:VERCLR
-180 7376 valName:LNAM_REFS
-182 153 valName:BOYSHP
-183 236 valName:COLOUR
-185 61 valName:OBJNAM
-186 63 valName:CATSPM
-187 3 valName:CATCBL
-188 273 valName:CONRAD
-189 9 valName:VERCSA
-190 6 valName:INFORM
-192 2628 valName:CATCOA
-193 12377 valName:DRVAL1
-194 43629 valName:DRVAL2
-195 3204 valName:VALDCO
-197 17010 valName:CATLMK
-198 1800 valName:CONVIS
-199 1905 valName:FUNCTN
-200 118 valName:HEIGHT
-201 118 valName:LITCHR
-202 118 valName:SIGGRP
-203 118 valName:SIGPER
-204 118 valName:VALNMR
-205 295 valName:SECTR1
-206 295 valName:SECTR2
-207 236 valName:CATLIT
-208 348 valName:CATOBS
-209 384 valName:VALSOU
-210 3981 valName:WATLEV
-212 304 valName:ORIENT
-213 216 valName:TRAFIC
-216 6 valName:CATSLC
-217 7 valName:CONDTN
-218 3 valName:BURDEP
-219 20 valName:CATWRK
-220 1 valName:POSACC
-221 1 valName:CSCALE
-222 2 valName:CATCOV
-223 12 valName:MARSYS
-224 37 valName:CATZOC
-226 1236 valName:$SCODE
-*/
+    // Note: no new quark - never set then abscent
+    return S57_getAttValID(geo, g_quark_try_string(attName));
+}
 
-    GQuark   q      = g_quark_from_string(attName);
-    GString *attVal = (GString*) g_datalist_id_get_data(&geo->attribs, q);
+GString   *S57_getAttValID(_S57_geo *geo, S57_AttID attID)
+// same as S57_getAttVal()
+{
+    return_if_null(geo);
 
-    { // stat
-        if (500 < q)
-            g_assert(0);
-        _qcnt[q]++;
+    _S57_att *att    = _findAtt(geo, attID);
+    GString  *attVal = (NULL == att) ? NULL : att->str;
+
+    { // stat - quark past the table are not counted
+        if (attID < G_N_ELEMENTS(_qcnt))
+            g_atomic_int_inc(&_qcnt[attID]);
 
         // CATLMK = 197
         //if (197 == q) {
@@ -1472,9 +1911,8 @@ GString   *S57_getAttVal(_S57_geo *geo, const char *attName)
         //}
     }
 
-    // FIXME: optimisation: check for EMPTY_NUMBER_MARKER in S57_setAtt() but then valName will
-    // be removed from attribs and dumpData() will fail to show a mandatory att with no value!!
-    if (NULL!=attVal && (0==g_strcmp0(attVal->str, EMPTY_NUMBER_MARKER))) {
+    // Note: EMPTY_NUMBER_MARKER is flagged by S57_setAtt() - kept in attribs for dumpData()
+    if (NULL!=att && _ATT_OMIT==att->type) {
         // clutter
         //PRINTF("DEBUG: mandatory attribute (%s) with ommited value\n", att_name);
 
@@ -1488,7 +1926,7 @@ GString   *S57_getAttVal(_S57_geo *geo, const char *attName)
     static int silent = FALSE;
     if (!silent && NULL!=attVal && 0==attVal->len) {
         //PRINTF("NOTE: attribute (%s) has no value [obj:%s]\n", att_name, geo->name->str);
-        PRINTF("NOTE: attribute (%s) has no value [obj:%s]\n", attName, geo->name);
+        PRINTF("NOTE: attribute (%s) has no value [obj:%s]\n", g_quark_to_string(attID), geo->name);
         PRINTF("NOTE: (this msg will not repeat)\n");
         silent = TRUE;
         return NULL;
@@ -1497,26 +1935,86 @@ GString   *S57_getAttVal(_S57_geo *geo, const char *attName)
     return attVal;
 }
 
+gboolean   S57_getAttReal(_S57_geo *geo, S57_AttID attID, double *val)
+{
+    return_if_null(geo);
+    return_if_null(val);
+
+    _S57_att *att = _findAtt(geo, attID);
+    if (NULL==att || _ATT_OMIT==att->type || 0==att->str->len)
+        return FALSE;
+
+    switch (att->type) {
+        case _ATT_INT : *val = (double) att->val.i;    break;
+        case _ATT_REAL: *val = att->val.f;             break;
+        default       : *val = S52_atof(att->str->str); break;
+    }
+
+    return TRUE;
+}
+
+gboolean   S57_getAttInt (_S57_geo *geo, S57_AttID attID, int *val)
+{
+    return_if_null(geo);
+    return_if_null(val);
+
+    _S57_att *att = _findAtt(geo, attID);
+    if (NULL==att || _ATT_OMIT==att->type || 0==att->str->len)
+        return FALSE;
+
+    switch (att->type) {
+        case _ATT_INT : *val = att->val.i;              break;
+        case _ATT_REAL: *val = (int) att->val.f;        break;
+        default       : *val = S52_atoi(att->str->str); break;
+    }
+
+    return TRUE;
+}
+
 GString   *S57_getAttValALL(_S57_geo *geo, const char *attName)
 // return attribute string value or NULL if attribute value abscent
 {
     return_if_null(geo);
     return_if_null(attName);
 
+    _S57_att *att = _findAtt(geo, g_quark_try_string(attName));
 
-    GQuark   q      = g_quark_from_string(attName);
-    GString *attVal = (GString*) g_datalist_id_get_data(&geo->attribs, q);
-
-    return attVal;
+    return (NULL == att) ? NULL : att->str;
 }
 
-static void   _string_free(gpointer data)
+static int     _parseAtt(_S57_att *att)
+// set type / val from str - same value as S52_atof() / S52_atoi() on str
 {
-    g_string_free((GString*)data, TRUE);
+    const char *str = att->str->str;
+    char       *end = NULL;
+
+    att->type  = _ATT_STR;
+    att->val.f = 0.0;
+
+    if (0 == g_strcmp0(str, EMPTY_NUMBER_MARKER)) {
+        att->type = _ATT_OMIT;
+        return TRUE;
+    }
+
+    if (0 == att->str->len)
+        return TRUE;
+
+    double f = g_ascii_strtod(str, &end);
+    if ('\0' != *end)
+        return TRUE;
+
+    if ((f == floor(f)) && (G_MININT <= f) && (f <= G_MAXINT)) {
+        att->type  = _ATT_INT;
+        att->val.i = (int) f;
+    } else {
+        att->type  = _ATT_REAL;
+        att->val.f = f;
+    }
+
+    return TRUE;
 }
 
-GData     *S57_setAtt(_S57_geo *geo, const char *name, const char *val)
-// FIXME: returning GData is useless
+int        S57_setAtt(_S57_geo *geo, const char *name, const char *val)
 {
     return_if_null(geo);
     return_if_null(name);
@@ -1533,7 +2031,7 @@ GData     *S57_setAtt(_S57_geo *geo, const char *name, const char *val)
     }
 
     if (NULL == geo->attribs)
-        g_datalist_init(&geo->attribs);
+        geo->attribs = g_array_new(FALSE, FALSE, sizeof(_S57_att));
 
 #ifdef S52_USE_SUPP_LINE_OVERLAP
     if ((0==g_strcmp0(geo->name, "Edge")) && (0==g_strcmp0(name, "RCID"))) {
@@ -1544,10 +2042,20 @@ GData     *S57_setAtt(_S57_geo *geo, const char *name, const char *val)
      }
 #endif
 
-    // Note: if value NULL then _string_free must be NULL and qname is remove from attribs
-    g_datalist_id_set_data_full(&geo->attribs, qname, value, _string_free);
+    // replace value in place - keep insertion order
+    _S57_att *att = _findAtt(geo, qname);
+    if (NULL == att) {
+        _S57_att newAtt = {qname, _ATT_STR, {0}, NULL};
+        g_array_append_val(geo->attribs, newAtt);
+        att = &g_array_index(geo->attribs, _S57_att, geo->attribs->len - 1);
+    } else {
+        g_string_free(att->str, TRUE);
+    }
+    att->str = value;
+
+    _parseAtt(att);
 
-    return geo->attribs;
+    return TRUE;
 }
 
 int        S57_setTouchTOPMAR(_S57_geo *geo, S57_geo *touch)
@@ -1728,8 +2236,13 @@ double     S57_getScamin(_S57_geo *geo)
     //return_if_null(geo);
 
     if (S57_RESET_SCAMIN == geo->scamin) {
-        GString *valstr = S57_getAttVal(geo, "SCAMIN");
-        geo->scamin = (NULL == valstr) ? INFINITY : S52_atof(valstr->str);
+        static gsize _SCAMIN = 0;
+        if (g_once_init_enter(&_SCAMIN))
+            g_once_init_leave(&_SCAMIN, S57_getAttID("SCAMIN"));
+
+        double scamin = INFINITY;
+        S57_getAttReal(geo, (S57_AttID)_SCAMIN, &scamin);
+        geo->scamin = scamin;
     }
 
     // debug - parano, attribs scamin can't be 0
@@ -1767,17 +2280,14 @@ S57_geo  * S57_getRelationship(_S57_geo *geo)
 }
 #endif  // S52_USE_C_AGGR_C_ASSO
 
-static void   _printAttVal(GQuark key_id, gpointer data, gpointer user_data)
+static void   _printAttVal(const char *attName, const char *attValue, gpointer user_data)
 {
     // 'user_data' not used
     (void) user_data;
 
-    const gchar *attName  = g_quark_to_string(key_id);
-
     // print only S57 attrib - assuming that OGR att are not 6 char in lenght!!
     //if (S57_ATT_NM_LN == strlen(attName)) {
-        GString *attValue = (GString*) data;
-        PRINTF("%s: %s\n", attName, attValue->str);
+        PRINTF("%s: %s\n", attName, attValue);
     //}
 }
 
@@ -1790,7 +2300,7 @@ int        S57_dumpData(_S57_geo *geo, int dumpCoords)
     if (NULL == geo) {
         PRINTF("STAT START:\n");
         // FIXME: _qMin
-        for (guint i=0; i<_qMax; ++i) {
+        for (guint i=0; i<MIN(_qMax, G_N_ELEMENTS(_qcnt)); ++i) {
             // FIXME: show att with 0 call
             if (0 != _qcnt[i])
                 PRINTF("STAT: i:%i nCall:%i valName:%s\n", i, _qcnt[i], g_quark_to_string(i));
@@ -1814,7 +2324,7 @@ int        S57_dumpData(_S57_geo *geo, int dumpCoords)
     }
 
     // dump Att/Val
-    g_datalist_foreach(&geo->attribs, _printAttVal, NULL);
+    S57_forEachAtt(geo, _printAttVal, NULL);
 
     // dump extent
     PRINTF("EXT   : %f, %f  --  %f, %f\n", geo->ext.S, geo->ext.W, geo->ext.N, geo->ext.E);
@@ -1834,6 +2344,78 @@ int        S57_dumpData(_S57_geo *geo, int dumpCoords)
     return TRUE;
 }
 
+int        S57_deferS57ID(int defer)
+{
+#if (defined(S52_USE_ANDROID) || defined(S52_USE_MINGW))
+    (void)defer;
+    return FALSE;
+#else
+    g_private_set(&_deferS57ID, (TRUE==defer) ? GINT_TO_POINTER(1) : NULL);
+
+    return TRUE;
+#endif
+}
+
+int        S57_setS57ID(_S57_geo *geo)
+{
+    return_if_null(geo);
+
+    if (0 == geo->S57ID)
+        geo->S57ID = _newS57ID();
+
+    return TRUE;
+}
+
+S57_arena *S57_newArena(void)
+{
+    _S57_arena *arena = g_new0(_S57_arena, 1);
+    arena->chunks     = g_ptr_array_new_with_free_func(g_free);
+
+    return arena;
+}
+
+S57_arena *S57_doneArena(_S57_arena *arena)
+// Note: S57_doneData() of all geo in this arena must be done before
+{
+    if (NULL == arena)
+        return NULL;
+
+    g_ptr_array_free(arena->chunks, TRUE);
+    g_free(arena);
+
+    return NULL;
+}
+
+int        S57_setArena(_S57_arena *arena)
+{
+#if (defined(S52_USE_ANDROID) || defined(S52_USE_MINGW))
+    _arena = arena;
+#else
+    g_private_set(&_arenaKey, arena);
+#endif
+
+    return TRUE;
+}
+
+gpointer   S57_newGeoMem(gsize size)
+{
+    _S57_arena *arena = ARENA;
+    if (NULL != arena)
+        return _newArenaMem(arena, size);
+
+    return g_malloc0(size);
+}
+
+int        S57_freeGeoMem(gpointer mem)
+{
+    if (NULL != ARENA)
+        return FALSE;
+
+    g_free(mem);
+
+    return TRUE;
+}
+
 #ifdef S52_DEBUG
 guint      S57_getS57ID(_S57_geo *geo)
 // get the first field of S57_geo
@@ -1845,12 +2427,9 @@ guint      S57_getS57ID(_S57_geo *geo)
 }
 #endif  // S52_DEBUG
 
-static void   _getAtt(GQuark key_id, gpointer data, gpointer user_data)
+static void   _getAtt(const char *attName, const char *attValue, gpointer user_data)
 {
-
-    const gchar *attName  = g_quark_to_string(key_id);
-    GString     *attValue = (GString*) data;
-    GString     *attList  = (GString*) user_data;
+    GString *attList = (GString*) user_data;
 
     /*
     // filter out OGR internal S57 info
@@ -1868,9 +2447,9 @@ static void   _getAtt(GQuark key_id, gpointer data, gpointer user_data)
 
     g_string_append(attList, attName);
     g_string_append_c(attList, ':');
-    g_string_append(attList, attValue->str);
+    g_string_append(attList, attValue);
 
-    //PRINTF("\t%s : %s\n", attName, (char*)attValue->str);
+    //PRINTF("\t%s : %s\n", attName, attValue);
 
     return;
 }
@@ -1885,11 +2464,28 @@ CCHAR     *S57_getAtt(_S57_geo *geo)
     g_string_set_size(_attList, 0);
     g_string_printf(_attList, "%s:%i", geo->name, geo->S57ID);
 
-    g_datalist_foreach(&geo->attribs, _getAtt, _attList);
+    S57_forEachAtt(geo, _getAtt, _attList);
 
     return _attList->str;
 }
 
+int        S57_forEachAtt(_S57_geo *geo, S57_att_cb cb, gpointer user_data)
+// call cb() on all attributes (S57 and OGR) in insertion order
+{
+    return_if_null(geo);
+    return_if_null(cb);
+
+    if (NULL == geo->attribs)
+        return TRUE;
+
+    for (guint i=0; i<geo->attribs->len; ++i) {
+        _S57_att *att = &g_array_index(geo->attribs, _S57_att, i);
+        cb(g_quark_to_string(att->id), att->str->str, user_data);
+    }
+
+    return TRUE;
+}
+
 #ifdef S52_USE_WORLD
 S57_geo   *S57_setNextPoly(_S57_geo *geo, _S57_geo *nextPoly)
 {
@@ -1926,8 +2522,53 @@ S57_geo   *S57_delNextPoly(_S57_geo *geo)
 }
 #endif
 
+GArray    *S57_newRingExt(_S57_geo *geo)
+// extent of each ring of geo in current coord (geographic before S57_geo2prj())
+{
+    return_if_null(geo);
+
+    guint   nr      = S57_getRingNbr(geo);
+    GArray *ringExt = g_array_sized_new(FALSE, FALSE, sizeof(ObjExt_t), nr);
+
+    for (guint i=0; i<nr; ++i) {
+        ObjExt_t ext = {INFINITY, INFINITY, -INFINITY, -INFINITY};
+        guint    npt;
+        double  *ppt;
+
+        if (TRUE == S57_getGeoData(geo, i, &npt, &ppt)) {
+            for (guint j=0; j<npt; ++j, ppt+=3) {
+                if (ext.W > ppt[0]) ext.W = ppt[0];
+                if (ext.S > ppt[1]) ext.S = ppt[1];
+                if (ext.E < ppt[0]) ext.E = ppt[0];
+                if (ext.N < ppt[1]) ext.N = ppt[1];
+            }
+        }
+        g_array_append_val(ringExt, ext);
+    }
+
+    return ringExt;
+}
+
+static gboolean   _isPtOutRingExt(GArray *ringExt, guint ringNo, double margin, double x, double y)
+// TRUE if (x,y) is farther than margin from the extent of ring
+{
+    if (NULL==ringExt || ringExt->len<=ringNo)
+        return FALSE;
+
+    ObjExt_t ext = g_array_index(ringExt, ObjExt_t, ringNo);
+
+    return (x < ext.W-margin || ext.E+margin < x || y < ext.S-margin || ext.N+margin < y) ? TRUE : FALSE;
+}
+
 gboolean   S57_isPtInArea(_S57_geo *geo, double x, double y)
 // return TRUE if (x,y) inside geo area (close/open) else FALSE
+{
+    return S57_isPtInAreaExt(geo, NULL, x, y);
+}
+
+gboolean   S57_isPtInAreaExt(_S57_geo *geo, GArray *ringExt, double x, double y)
+// return TRUE if (x,y) inside geo area (close/open) else FALSE
+// Note: ring whose extent (+ tolerance) exclude (x,y) are skipped, ringExt can be NULL
 {
     return_if_null(geo);
 
@@ -1937,6 +2578,10 @@ gboolean   S57_isPtInArea(_S57_geo *geo, double x, double y)
     for (guint i=0; i<nr; ++i) {
         guint   npt;
         double *ppt;
+
+        if (TRUE == _isPtOutRingExt(ringExt, i, S57_GEO_TOLERANCE, x, y))
+            continue;
+
         if (TRUE == S57_getGeoData(geo, i, &npt, &ppt)) {
             if (TRUE == S57_isPtInRing(npt, (pt3*)ppt, TRUE, x, y)) {
                 // exterior ring
@@ -1995,6 +2640,13 @@ gboolean   S57_isPtInRing(guint npt, pt3 *ppt, gboolean close, double x, double
 
 gboolean   S57_isPtInSet(_S57_geo *geo, double x, double y)
 // TRUE if XY is the same as one in geo
+{
+    return S57_isPtInSetExt(geo, NULL, x, y);
+}
+
+gboolean   S57_isPtInSetExt(_S57_geo *geo, GArray *ringExt, double x, double y)
+// TRUE if XY is the same as one in geo
+// Note: ring whose extent (+ tolerance) exclude (x,y) are skipped, ringExt can be NULL
 {
     //return_if_null(geo);
 
@@ -2003,6 +2655,10 @@ gboolean   S57_isPtInSet(_S57_geo *geo, double x, double y)
         guint   npt;
         double *ppt;
 
+        // 2 x tolerance - rounding of ext-tolerance
+        if (TRUE == _isPtOutRingExt(ringExt, i, 2.0*S57_GEO_TOLERANCE, x, y))
+            continue;
+
         if (TRUE == S57_getGeoData(geo, i, &npt, &ppt)) {
             for (guint j=0; j<npt; ++j, ppt+=3) {
                 if (ABS(ppt[0]-x)<S57_GEO_TOLERANCE && ABS(ppt[1]-y)<S57_GEO_TOLERANCE)
@@ -2061,6 +2717,130 @@ gboolean   S57_isPtOnLine(_S57_geo *geoLine, double x, double y)
     return FALSE;
 }
 
+static double     _orient(pt3 *a, pt3 *b, pt3 *c)
+// > 0: c left of ab, < 0: right, 0: on the line
+{
+    return (b->x - a->x) * (c->y - a->y) - (b->y - a->y) * (c->x - a->x);
+}
+
+static gboolean   _onSeg(pt3 *a, pt3 *b, pt3 *c)
+// c colinear with ab - TRUE if c inside ab extent
+{
+    return (MIN(a->x, b->x) <= c->x) && (c->x <= MAX(a->x, b->x)) &&
+           (MIN(a->y, b->y) <= c->y) && (c->y <= MAX(a->y, b->y));
+}
+
+static gboolean   _isSegCross(pt3 *a, pt3 *b, pt3 *c, pt3 *d)
+// TRUE if segment ab intersect segment cd (touch included)
+{
+    double d1 = _orient(c, d, a);
+    double d2 = _orient(c, d, b);
+    double d3 = _orient(a, b, c);
+    double d4 = _orient(a, b, d);
+
+    if ((((d1>0.0) && (d2<0.0)) || ((d1<0.0) && (d2>0.0))) &&
+        (((d3>0.0) && (d4<0.0)) || ((d3<0.0) && (d4>0.0))))
+        return TRUE;
+
+    if ((0.0==d1) && (TRUE==_onSeg(c, d, a))) return TRUE;
+    if ((0.0==d2) && (TRUE==_onSeg(c, d, b))) return TRUE;
+    if ((0.0==d3) && (TRUE==_onSeg(a, b, c))) return TRUE;
+    if ((0.0==d4) && (TRUE==_onSeg(a, b, d))) return TRUE;
+
+    return FALSE;
+}
+
+gboolean   S57_touchRing(_S57_geo *geo, guint npt, pt3 *ring)
+// TRUE if geo (P/L/A) is inside or cross the closed ring (first == last)
+// Note: geo and ring in the same coord (projected)
+{
+    return_if_null(geo);
+    return_if_null(ring);
+
+    if (npt < 4)
+        return FALSE;
+
+    // ring extent - skip vertex / segment outside
+    ObjExt_t rext = {ring[0].x, ring[0].y, ring[0].x, ring[0].y};
+    for (guint k=1; k<npt; ++k) {
+        rext.W = MIN(rext.W, ring[k].x);
+        rext.S = MIN(rext.S, ring[k].y);
+        rext.E = MAX(rext.E, ring[k].x);
+        rext.N = MAX(rext.N, ring[k].y);
+    }
+
+    guint nr = S57_getRingNbr(geo);
+    for (guint i=0; i<nr; ++i) {
+        guint   n;
+        double *ppt;
+        if ((FALSE==S57_getGeoData(geo, i, &n, &ppt)) || (NULL==ppt))
+            continue;
+
+        pt3 *v = (pt3*)ppt;
+
+        // vertex inside
+        for (guint j=0; j<n; ++j) {
+            if ((v[j].x<rext.W) || (v[j].x>rext.E) || (v[j].y<rext.S) || (v[j].y>rext.N))
+                continue;
+            if (TRUE == S57_isPtInRing(npt, ring, TRUE, v[j].x, v[j].y))
+                return TRUE;
+        }
+
+        // segment cross the ring
+        for (guint j=1; j<n; ++j) {
+            ObjExt_t sext = {MIN(v[j-1].x, v[j].x), MIN(v[j-1].y, v[j].y),
+                             MAX(v[j-1].x, v[j].x), MAX(v[j-1].y, v[j].y)};
+            if (FALSE == S57_cmpExt(rext, sext))
+                continue;
+
+            for (guint k=1; k<npt; ++k) {
+                if (TRUE == _isSegCross(&v[j-1], &v[j], &ring[k-1], &ring[k]))
+                    return TRUE;
+            }
+        }
+    }
+
+    // ring inside the area
+    if ((S57_AREAS_T==geo->objType) && (TRUE==S57_isPtInArea(geo, ring[0].x, ring[0].y)))
+        return TRUE;
+
+    return FALSE;
+}
+
+gboolean   S57_isPtOnLineTol(_S57_geo *geo, double x, double y, double tol)
+// TRUE if XY is at less than tol of a segment of the line or of a ring of the area
+{
+    return_if_null(geo);
+
+    pt3   p  = {x, y, 0.0};
+    guint nr = S57_getRingNbr(geo);
+    for (guint i=0; i<nr; ++i) {
+        guint   npt;
+        double *ppt;
+
+        if ((FALSE==S57_getGeoData(geo, i, &npt, &ppt)) || (NULL==ppt))
+            continue;
+
+        // get the current number of positon (this grow as GPS/AIS pos come in)
+        if (0 == g_strcmp0("pastrk", S57_getName(geo)))
+            npt = S57_getGeoSize(geo);
+
+        if (1 == npt) {
+            if (_distPtSeg2(&p, (pt3*)ppt, (pt3*)ppt) <= tol*tol)
+                return TRUE;
+            continue;
+        }
+
+        pt3 *v = (pt3*)ppt;
+        for (guint j=1; j<npt; ++j) {
+            if (_distPtSeg2(&p, &v[j-1], &v[j]) <= tol*tol)
+                return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
 #if 0
 gboolean   S57_touchArea(_S57_geo *geoArea, _S57_geo *geo)
 // TRUE if A touch B else FALSE
@@ -26,7 +26,7 @@
 #define _S57DATA_H_
 
 #include "S52utils.h"   // CCHAR
-#include <glib.h>       // guint, GArray, GData, GString, gconstpointer, gboolean
+#include <glib.h>       // guint, GArray, GQuark, GString, gconstpointer, gboolean
 
 // MAXINT-6 is how OGR tag an UNKNOWN value
 // see gdal/ogr/ogrsf_frmts/s57/s57.h:126
@@ -88,6 +88,7 @@ typedef struct ObjExt_t {
 
 typedef struct _S57_geo  S57_geo;
 typedef struct _S57_prim S57_prim;
+typedef struct _S57_arena S57_arena;
 
 typedef double geocoord;
 
@@ -135,6 +136,15 @@ guint     S57_getRingNbr(S57_geo *geo);
 // get data
 int       S57_getGeoData(S57_geo *geo, guint ringNo, guint *npt, double **ppt);
 
+// level of detail: 0 - geo data as is, 1..S57_LOD_NUM-1 - RDP simplified LINES / AREAS
+#define S57_LOD_NUM 4
+// max distance (projected coord - meter) of a vertex dropped at this LOD
+double    S57_getLODtol(guint lod);
+// set LOD of all geo of a cell (projected) - edge shared by geo are simplified the same way
+int       S57_newLOD(GPtrArray *geoList);
+// as S57_getGeoData() - fall back to the finer LOD if this one is not set
+int       S57_getGeoDataLOD(S57_geo *geo, guint ringNo, guint lod, guint *npt, double **ppt);
+
 // handling of S52/S57 object rendering primitive
 S57_prim *S57_initPrim   (S57_prim *prim);
 S57_prim *S57_donePrim   (S57_prim *prim);
@@ -155,6 +165,7 @@ int       S57_setPrimDList (S57_prim *prim, guint DList);
 // get/set extend
 int       S57_setGeoExt(S57_geo *geo, double  W, double  S, double  E, double  N);
 ObjExt_t  S57_getGeoExt(S57_geo *geo);
+ObjExt_t  S57_getGeoExtRaw(S57_geo *geo);  // as set - 'no extent' left as is (see S57_getGeoExt())
 gboolean  S57_cmpGeoExt(S57_geo *geoA, S57_geo *geoB);
 gboolean  S57_cmpExt(ObjExt_t A, ObjExt_t B);
 
@@ -164,14 +175,26 @@ gboolean  S57_cmpExt(ObjExt_t A, ObjExt_t B);
 //S52_Obj_t S57_getObjtype(S57_geo *geo);
 S57_Obj_t S57_getObjtype(S57_geo *geo);
 
+// interned attribute name - caller can keep it to skip the string lookup
+typedef GQuark S57_AttID;
+S57_AttID S57_getAttID(const char *attName);
+
 // return S57 attribute value of the attribute name
 GString  *S57_getAttVal(S57_geo *geo, const char *attName);
+GString  *S57_getAttValID(S57_geo *geo, S57_AttID attID);
 GString  *S57_getAttValALL(S57_geo *geo, const char *attName);
+// value parsed by S57_setAtt() - same as S52_atof() / S52_atoi() of S57_getAttVal()
+// return FALSE (and 'val' untouched) if attribute abscent, value omitted or empty
+gboolean  S57_getAttReal(S57_geo *geo, S57_AttID attID, double *val);
+gboolean  S57_getAttInt (S57_geo *geo, S57_AttID attID, int    *val);
 
 // set attribute name and value
-GData    *S57_setAtt(S57_geo *geo, const char *name, const char *val);
+int       S57_setAtt(S57_geo *geo, const char *name, const char *val);
 // get str of the form ",KEY1:VAL1,KEY2:VAL2, ..." of S57 attribute only (not OGR)
 CCHAR    *S57_getAtt(S57_geo *geo);
+// call cb() on each attribute name/value (S57 and OGR)
+typedef void (*S57_att_cb)(const char *name, const char *val, gpointer user_data);
+int       S57_forEachAtt(S57_geo *geo, S57_att_cb cb, gpointer user_data);
 
 int       S57_setTouchTOPMAR(S57_geo *geo, S57_geo *touch);
 S57_geo  *S57_getTouchTOPMAR(S57_geo *geo);
@@ -200,6 +223,21 @@ S57_geo  *S57_getRelationship(S57_geo *geo);
 // debug
 int       S57_dumpData(S57_geo *geo, int dumpCoords);
 
+// calling thread (loader) create geo with S57ID 0 until S57_setS57ID()
+int       S57_deferS57ID(int defer);
+// give a new S57ID to 'geo' if defered
+int       S57_setS57ID(S57_geo *geo);
+
+// per-cell memory for geo coord and S57_geo - freed in one shot by S57_doneArena()
+S57_arena *S57_newArena(void);
+S57_arena *S57_doneArena(S57_arena *arena);
+// calling thread (loader) allocate geo in 'arena' (NULL: heap) until S57_setArena(NULL)
+int       S57_setArena(S57_arena *arena);
+// zeroed mem for geo coord passed to S57_setPOINT/LINES/AREAS() - from the current arena if any
+gpointer  S57_newGeoMem(gsize size);
+// free mem from S57_newGeoMem() - noop in an arena (freed by S57_doneArena())
+int       S57_freeGeoMem(gpointer mem);
+
 // get the first field of S57_geo
 #ifdef S52_DEBUG
 guint     S57_getS57ID(S57_geo *geo);
@@ -220,8 +258,16 @@ int       S57_geo2prj(S57_geo *geo);
 gboolean  S57_isPtInArea(S57_geo *geo, double x, double y);
 gboolean  S57_isPtInRing(guint npt, pt3 *pt, gboolean close, double x, double y);
 gboolean  S57_isPtInSet(S57_geo *geo, double x, double y);
+// same as above with the extent of each ring of geo (from S57_newRingExt()) to skip ring
+GArray   *S57_newRingExt(S57_geo *geo);   // GArray of ObjExt_t, caller free
+gboolean  S57_isPtInAreaExt(S57_geo *geo, GArray *ringExt, double x, double y);
+gboolean  S57_isPtInSetExt (S57_geo *geo, GArray *ringExt, double x, double y);
 gboolean  S57_isPtOnLine(S57_geo *geoLine, double x, double y);
+// same as above with a distance tolerance (projected), also on ring of AREAS
+gboolean  S57_isPtOnLineTol(S57_geo *geo, double x, double y, double tol);
 //gboolean  S57_touchArea(S57_geo *geoArea, S57_geo *geo);
+// TRUE if geo (P/L/A) is inside or cross the closed ring (same coord)
+gboolean  S57_touchRing(S57_geo *geo, guint npt, pt3 *ring);
 
 guint     S57_getGeoSize(S57_geo *geo);
 guint     S57_setGeoSize(S57_geo *geo, guint size);
@@ -81,7 +81,8 @@ static int        _setAtt(S57_geo *geo, OGRFeatureH hFeature)
 }
 
 DLL int   STD  S52_loadLayer(const char *layername, void *layer, S52_loadObject_cb loadObject_cb);
-static int        _ogrLoadCell(const char *filename, S52_loadLayer_cb loadLayer_cb, S52_loadObject_cb loadObject_cb)
+static int        _ogrLoadCell(const char *filename, S52_loadLayer_cb loadLayer_cb, S52_loadObject_cb loadObject_cb,
+                               S57_ogrProgress_cb progress_cb, void *user_data)
 {
     OGRDataSourceH hDS     = NULL;
     OGRSFDriverH   hDriver = NULL;
@@ -128,6 +129,11 @@ static int        _ogrLoadCell(const char *filename, S52_loadLayer_cb loadLayer_
         loadLayer_cb(layername, ogrlayer, loadObject_cb);
 #endif
 
+        if ((NULL!=progress_cb) && (FALSE==progress_cb(iLayer, nLayer, user_data))) {
+            PRINTF("NOTE: load aborted at layer %i/%i (%s)\n", iLayer+1, nLayer, filename);
+            OGRReleaseDataSource(hDS);
+            return FALSE;
+        }
     }
 
     //OGR_DS_Destroy(hDS);
@@ -136,6 +142,19 @@ static int        _ogrLoadCell(const char *filename, S52_loadLayer_cb loadLayer_
     return TRUE;
 }
 
+int            S57_ogrInit(void)
+{
+    static int init = FALSE;
+
+    if (FALSE == init) {
+        // FIXME: call GDALRegister_XXXX() / OGRRegisterXXXX()
+        OGRRegisterAll();
+        init = TRUE;
+    }
+
+    return TRUE;
+}
+
 int            S57_ogrLoadCell(const char *filename, S52_loadLayer_cb loadLayer_cb, S52_loadObject_cb loadObject_cb)
 {
     /* check that geometric data type are in sync with OpenGL
@@ -146,14 +165,19 @@ int            S57_ogrLoadCell(const char *filename, S52_loadLayer_cb loadLayer_
     }
     */
 
-    // FIXME: call GDALRegister_XXXX() / OGRRegisterXXXX()
-    OGRRegisterAll();
+    S57_ogrInit();
 
-    _ogrLoadCell(filename, loadLayer_cb, loadObject_cb);
+    _ogrLoadCell(filename, loadLayer_cb, loadObject_cb, NULL, NULL);
 
     return TRUE;
 }
 
+int            S57_ogrLoadCellProgress(const char *filename, S52_loadLayer_cb loadLayer_cb, S52_loadObject_cb loadObject_cb,
+                                       S57_ogrProgress_cb progress_cb, void *user_data)
+{
+    return _ogrLoadCell(filename, loadLayer_cb, loadObject_cb, progress_cb, user_data);
+}
+
 int            S57_ogrLoadLayer(const char *layername, void *ogrlayer, S52_loadObject_cb loadObject_cb)
 {
     if (NULL==layername || NULL==ogrlayer) {
@@ -211,7 +235,7 @@ static S57_geo   *_ogrLoadObject(const char *objname, void *feature, OGRGeometry
         // POINT
         case wkbPoint25D:
         case wkbPoint: {
-            geocoord *pointxyz = g_new(geocoord, 3);
+            geocoord *pointxyz = (geocoord *) S57_newGeoMem(3*sizeof(geocoord));
 
             pointxyz[0] = OGR_G_GetX(hGeom, 0);
             pointxyz[1] = OGR_G_GetY(hGeom, 0);
@@ -239,7 +263,7 @@ static S57_geo   *_ogrLoadObject(const char *objname, void *feature, OGRGeometry
 
             geocoord *linexyz = NULL;
             if (0 != count)
-                linexyz = g_new(geocoord, 3*count);
+                linexyz = (geocoord *) S57_newGeoMem(3*count*sizeof(geocoord));
 
             for (int node=0; node<count; ++node) {
                 linexyz[node*3+0] = OGR_G_GetX(hGeom, node);
@@ -263,8 +287,8 @@ static S57_geo   *_ogrLoadObject(const char *objname, void *feature, OGRGeometry
             geocoord   **ringxyz;
             double       area = 0;
 
-            ringxyznbr = g_new(guint,      nRingCount);
-            ringxyz    = g_new(geocoord *, nRingCount);
+            ringxyznbr = (guint     *) S57_newGeoMem(nRingCount*sizeof(guint));
+            ringxyz    = (geocoord **) S57_newGeoMem(nRingCount*sizeof(geocoord *));
 
             // Note: to check winding on an open poly area
             //for (i = n-1, j = 0; j < n; i = j, j++) {
@@ -288,7 +312,7 @@ static S57_geo   *_ogrLoadObject(const char *objname, void *feature, OGRGeometry
                     continue;
                 }
 
-                ringxyz[iRing] = g_new(geocoord, vert_count*3*sizeof(geocoord));
+                ringxyz[iRing] = (geocoord *) S57_newGeoMem(vert_count*3*sizeof(geocoord));
 
                 // check if last vertex is NOT the first vertex (ie ring not close)
                 if ((OGR_G_GetX(hRing, 0) != OGR_G_GetX(hRing, vert_count-1)) ||
@@ -30,7 +30,16 @@
 
 typedef int   (*S52_loadLayer_cb)(const char *layername, void *layer, S52_loadObject_cb loadObject_cb);
 
+// called after each layer, return FALSE to abort the load
+typedef int   (*S57_ogrProgress_cb)(int iLayer, int nLayer, void *user_data);
+
+// register OGR drivers - not thread safe, call from the main thread before any loader thread start
+int      S57_ogrInit      (void);
 int      S57_ogrLoadCell  (const char *filename,                  S52_loadLayer_cb  loadLayer_cb, S52_loadObject_cb loadObject_cb);
+// return FALSE if the cell can't be open or progress_cb() abort
+// Note: S57_ogrInit() must have been called (any thread)
+int      S57_ogrLoadCellProgress(const char *filename, S52_loadLayer_cb loadLayer_cb, S52_loadObject_cb loadObject_cb,
+                                 S57_ogrProgress_cb progress_cb, void *user_data);
 int      S57_ogrLoadLayer (const char *layername, void *ogrlayer, S52_loadObject_cb loadObject_cb);
 S57_geo *S57_ogrLoadObject(const char *objname,   void *shape);
 
@@ -0,0 +1,559 @@
+// S57senc.c: System ENC - binary cache of S57 object loaded from a base cell + updates
+//
+// Project:  OpENCview
+
+/*
+    This file is part of the OpENCview project, a viewer of ENC.
+    Copyright (C) 2000-2018 Sylvain Duclos sduclos@users.sourceforge.net
+
+    OpENCview is free software: you can redistribute it and/or modify
+    it under the terms of the Lesser GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpENCview is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Lesser GNU General Public License for more details.
+
+    You should have received a copy of the Lesser GNU General Public License
+    along with OpENCview.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+// Note: a SENC is a dump of S57_geo as they come out of OGR (geographic coord,
+// all attributes, updates applied) so that the next S52_loadCell() skip OGR.
+// The file is native byte order and is only meant to be read back by the same build.
+// Also saved: the CS touch (as index of geo in the SENC) and, with S52_USE_SUPP_LINE_OVERLAP,
+// the overlap mark (in coord Z) - so the caller skip S52_CS_touch() and the Edge/ConnectedNode.
+// LUP, projection and tessellation are rebuilt as usual - they depend on the PLib,
+// the Mariners' Param or the projection.
+
+#include "S57senc.h"
+#include "S52utils.h"   // PRINTF(), return_if_null()
+
+#include <glib/gstdio.h> // g_stat(), g_fopen(), g_rename(), g_unlink()
+#include <sys/stat.h>    // struct stat
+#include <string.h>      // strlen(), memcpy(), memcmp()
+
+#define SENC_MAGIC    "S57SENC"
+#define SENC_VERSION  2
+#define SENC_EXT      ".senc"
+#define SENC_MAXUPDN  999     // update file .001 to .999
+
+#ifdef S52_USE_SUPP_LINE_OVERLAP
+#define SENC_OVERLAP  1       // coord Z hold the overlap mark
+#else
+#define SENC_OVERLAP  0
+#endif
+
+// geo touched by a geo (S52_CS_touch()) - saved as index in the SENC + 1 (0: none)
+typedef S57_geo *(*_getTouch_f)(S57_geo *geo);
+typedef int      (*_setTouch_f)(S57_geo *geo, S57_geo *touch);
+static const struct {
+    _getTouch_f get;
+    _setTouch_f set;
+} _touch[] = {
+    {S57_getTouchTOPMAR, S57_setTouchTOPMAR},
+    {S57_getTouchLIGHTS, S57_setTouchLIGHTS},
+    {S57_getTouchDEPCNT, S57_setTouchDEPCNT},
+    {S57_getTouchUDWHAZ, S57_setTouchUDWHAZ},
+    {S57_getTouchDEPVAL, S57_setTouchDEPVAL},
+};
+#define SENC_NTOUCH   G_N_ELEMENTS(_touch)
+
+// smallest geo in SENC: name len, type, ext, nRing, nAtt, touch
+#define SENC_GEO_MINSZ  (4*sizeof(guint) + sizeof(ObjExt_t) + SENC_NTOUCH*sizeof(guint))
+
+typedef struct _sencKey {
+    gint64 mtime;      // base cell (.000)
+    gint64 size;
+    guint  updn;       // last update file found next to the base cell (0: none)
+    gint64 updMtime;   // mtime of last update file
+} _sencKey;
+
+typedef struct _sencHdr {
+    char     magic[8];
+    guint    version;
+    guint    sizeofGeocoord;
+    guint    overlap;        // SENC_OVERLAP of the build that saved it
+    _sencKey key;
+    guint    nObj;
+    char     dsid_edtn[8];   // DSID_EDTN - info
+    char     dsid_updn[8];   // DSID_UPDN - info
+} _sencHdr;
+
+
+static int        _getKey(const char *filename, _sencKey *key)
+// key of 'filename': mtime/size of the base cell, number and mtime of the last update
+// Note: a new edition (DSID_EDTN) is a new base cell and a new update (DSID_UPDN) a new update file
+{
+    struct stat st;
+
+    memset(key, 0, sizeof(_sencKey));
+
+    if (0 != g_stat(filename, &st)) {
+        PRINTF("WARNING: stat() failed (%s)\n", filename);
+        return FALSE;
+    }
+    key->mtime = (gint64) st.st_mtime;
+    key->size  = (gint64) st.st_size;
+
+    // strip '000'
+    gchar *base = g_strndup(filename, strlen(filename) - 3);
+    for (guint updn=1; updn<=SENC_MAXUPDN; ++updn) {
+        gchar *updName = g_strdup_printf("%s%03u", base, updn);
+        int    ret     = g_stat(updName, &st);
+        g_free(updName);
+
+        if (0 != ret)
+            break;
+
+        key->updn     = updn;
+        key->updMtime = (gint64) st.st_mtime;
+    }
+    g_free(base);
+
+    return TRUE;
+}
+
+static gchar     *_getSENCName(const char *sencPath, const char *filename)
+{
+    gchar *baseName = g_path_get_basename(filename);
+    gchar *sencBase = g_strconcat(baseName, SENC_EXT, NULL);
+    gchar *sencName = g_build_filename(sencPath, sencBase, NULL);
+
+    g_free(sencBase);
+    g_free(baseName);
+
+    return sencName;
+}
+
+//-----------------------------------
+//
+// write
+//
+//-----------------------------------
+
+static void       _writeStr(FILE *fd, const char *str)
+{
+    guint len = strlen(str);
+
+    fwrite(&len, sizeof(guint), 1,   fd);
+    fwrite(str,  sizeof(char),  len, fd);
+
+    return;
+}
+
+static void       __countAtt(const char *name, const char *val, gpointer user_data)
+{
+    (void)name;
+    (void)val;
+
+    ++*(guint*)user_data;
+
+    return;
+}
+
+static void       __writeAtt(const char *name, const char *val, gpointer user_data)
+{
+    FILE *fd = (FILE*) user_data;
+
+    _writeStr(fd, name);
+    _writeStr(fd, val);
+
+    return;
+}
+
+static void       _writeGeo(FILE *fd, S57_geo *geo, GHashTable *geoIdx)
+{
+    guint    objType = S57_getObjtype(geo);
+    ObjExt_t ext     = S57_getGeoExt(geo);
+    guint    nRing   = S57_getRingNbr(geo);
+    guint    nAtt    = 0;
+
+    _writeStr(fd, S57_getName(geo));
+    fwrite(&objType, sizeof(guint),    1, fd);
+    fwrite(&ext,     sizeof(ObjExt_t), 1, fd);
+
+    fwrite(&nRing, sizeof(guint), 1, fd);
+    for (guint i=0; i<nRing; ++i) {
+        guint   npt = 0;
+        double *ppt = NULL;
+        if (FALSE == S57_getGeoData(geo, i, &npt, &ppt))
+            npt = 0;
+
+        fwrite(&npt, sizeof(guint),    1,     fd);
+        fwrite(ppt,  sizeof(geocoord), npt*3, fd);
+    }
+
+    S57_forEachAtt(geo, __countAtt, &nAtt);
+    fwrite(&nAtt, sizeof(guint), 1, fd);
+    S57_forEachAtt(geo, __writeAtt, fd);
+
+    for (guint i=0; i<SENC_NTOUCH; ++i) {
+        S57_geo *touch = _touch[i].get(geo);
+        guint    idx   = (NULL == touch) ? 0 : GPOINTER_TO_UINT(g_hash_table_lookup(geoIdx, touch));
+        fwrite(&idx, sizeof(guint), 1, fd);
+    }
+
+    return;
+}
+
+int        S57_sencSaveCell(const char *sencPath, const char *filename, GPtrArray *geoList)
+{
+    return_if_null(sencPath);
+    return_if_null(filename);
+    return_if_null(geoList);
+
+    _sencHdr hdr;
+    memset(&hdr, 0, sizeof(_sencHdr));
+
+    if (FALSE == _getKey(filename, &hdr.key))
+        return FALSE;
+
+    if (0 != g_mkdir_with_parents(sencPath, 0755)) {
+        PRINTF("WARNING: SENC dir creation failed (%s)\n", sencPath);
+        return FALSE;
+    }
+
+    memcpy(hdr.magic, SENC_MAGIC, sizeof(SENC_MAGIC));
+    hdr.version        = SENC_VERSION;
+    hdr.sizeofGeocoord = sizeof(geocoord);
+    hdr.overlap        = SENC_OVERLAP;
+    hdr.nObj           = geoList->len;
+
+    // info - DSID edition / update
+    for (guint i=0; i<geoList->len; ++i) {
+        S57_geo *geo = (S57_geo *) g_ptr_array_index(geoList, i);
+        if (0 == g_strcmp0(S57_getName(geo), "DSID")) {
+            GString *dsid_edtnstr = S57_getAttVal(geo, "DSID_EDTN");
+            GString *dsid_updnstr = S57_getAttVal(geo, "DSID_UPDN");
+            if (NULL != dsid_edtnstr)
+                g_strlcpy(hdr.dsid_edtn, dsid_edtnstr->str, sizeof(hdr.dsid_edtn));
+            if (NULL != dsid_updnstr)
+                g_strlcpy(hdr.dsid_updn, dsid_updnstr->str, sizeof(hdr.dsid_updn));
+            break;
+        }
+    }
+
+    gchar *sencName = _getSENCName(sencPath, filename);
+    gchar *tmpName  = g_strconcat(sencName, ".tmp", NULL);
+    FILE  *fd       = g_fopen(tmpName, "wb");
+    if (NULL == fd) {
+        PRINTF("WARNING: can't open SENC file (%s)\n", tmpName);
+        g_free(tmpName);
+        g_free(sencName);
+        return FALSE;
+    }
+
+    // index of geo in the SENC - touch
+    GHashTable *geoIdx = g_hash_table_new(g_direct_hash, g_direct_equal);
+    for (guint i=0; i<geoList->len; ++i) {
+        g_hash_table_insert(geoIdx, g_ptr_array_index(geoList, i), GUINT_TO_POINTER(i+1));
+    }
+
+    fwrite(&hdr, sizeof(_sencHdr), 1, fd);
+    for (guint i=0; i<geoList->len; ++i) {
+        _writeGeo(fd, (S57_geo *) g_ptr_array_index(geoList, i), geoIdx);
+    }
+
+    g_hash_table_destroy(geoIdx);
+
+    int ret = (0 == ferror(fd)) ? TRUE : FALSE;
+    if (0 != fclose(fd))
+        ret = FALSE;
+
+    // rename() - a reader never see a partial SENC
+    if ((TRUE==ret) && (0==g_rename(tmpName, sencName))) {
+        PRINTF("NOTE: SENC saved (%s) EDTN:%s UPDN:%s nObj:%u\n", sencName, hdr.dsid_edtn, hdr.dsid_updn, hdr.nObj);
+    } else {
+        PRINTF("WARNING: SENC write failed (%s)\n", sencName);
+        g_unlink(tmpName);
+        ret = FALSE;
+    }
+
+    g_free(tmpName);
+    g_free(sencName);
+
+    return ret;
+}
+
+//-----------------------------------
+//
+// read
+//
+//-----------------------------------
+
+typedef struct _sencBuf {
+    const gchar *ptr;
+    const gchar *end;
+} _sencBuf;
+
+static int        _read(_sencBuf *buf, gpointer dst, gsize n)
+// copy - data in mmap are not aligned
+{
+    if ((gsize)(buf->end - buf->ptr) < n)
+        return FALSE;
+
+    memcpy(dst, buf->ptr, n);
+    buf->ptr += n;
+
+    return TRUE;
+}
+
+static gchar     *_readStr(_sencBuf *buf)
+// return a new string - caller must g_free() it
+{
+    guint len = 0;
+    if (FALSE == _read(buf, &len, sizeof(guint)))
+        return NULL;
+
+    if ((gsize)(buf->end - buf->ptr) < len)
+        return NULL;
+
+    gchar *str = g_strndup(buf->ptr, len);
+    buf->ptr += len;
+
+    return str;
+}
+
+static geocoord  *_readXYZ(_sencBuf *buf, guint *npt)
+{
+    if (FALSE == _read(buf, npt, sizeof(guint)))
+        return NULL;
+
+    if (0 == *npt)
+        return NULL;
+
+    // corrupted - *npt left as is so the caller see the error
+    if ((gsize)(buf->end - buf->ptr) / (3 * sizeof(geocoord)) < *npt)
+        return NULL;
+
+    geocoord *xyz = (geocoord *) S57_newGeoMem(*npt * 3 * sizeof(geocoord));
+    if (FALSE == _read(buf, xyz, *npt * 3 * sizeof(geocoord))) {
+        S57_freeGeoMem(xyz);
+        return NULL;
+    }
+
+    return xyz;
+}
+
+static S57_geo   *_readGeo(_sencBuf *buf, guint *touchIdx)
+// return a new S57_geo or NULL if SENC is corrupted
+// touchIdx: SENC_NTOUCH index of touched geo - resolved once all geo are read
+{
+    S57_geo *geo     = NULL;
+    guint    objType = 0;
+    ObjExt_t ext;
+    guint    nRing   = 0;
+
+    gchar *name = _readStr(buf);
+    if (NULL == name)
+        return NULL;
+
+    if ((FALSE == _read(buf, &objType, sizeof(guint)   )) ||
+        (FALSE == _read(buf, &ext,     sizeof(ObjExt_t))) ||
+        (FALSE == _read(buf, &nRing,   sizeof(guint)   )) ||
+        ((gsize)(buf->end - buf->ptr) / sizeof(guint) < nRing))  // npt of each ring
+    {
+        g_free(name);
+        return NULL;
+    }
+
+    switch (objType) {
+        case S57_POINT_T: {
+            guint     npt = 0;
+            geocoord *xyz = _readXYZ(buf, &npt);
+            if (NULL != xyz)
+                geo = S57_setPOINT(xyz);
+            break;
+        }
+        case S57_LINES_T: {
+            // Note: Edge might have 0 node
+            guint     npt = 0;
+            geocoord *xyz = _readXYZ(buf, &npt);
+            if (0==npt || NULL!=xyz)
+                geo = S57_setLINES(npt, xyz);
+            break;
+        }
+        case S57_AREAS_T: {
+            guint     *ringxyznbr = (guint     *) S57_newGeoMem(nRing * sizeof(guint));
+            geocoord **ringxyz    = (geocoord **) S57_newGeoMem(nRing * sizeof(geocoord *));
+            guint      iRing      = 0;
+            for (iRing=0; iRing<nRing; ++iRing) {
+                ringxyz[iRing] = _readXYZ(buf, &ringxyznbr[iRing]);
+                if (0!=ringxyznbr[iRing] && NULL==ringxyz[iRing])
+                    break;
+            }
+
+            if (iRing == nRing) {
+                geo = S57_setAREAS(nRing, ringxyznbr, ringxyz);
+            } else {
+                for (guint i=0; i<iRing; ++i)
+                    S57_freeGeoMem(ringxyz[i]);
+                S57_freeGeoMem(ringxyz);
+                S57_freeGeoMem(ringxyznbr);
+            }
+            break;
+        }
+        case S57__META_T:
+            geo = S57_set_META();
+            break;
+
+        default:
+            PRINTF("WARNING: invalid object type in SENC (%u)\n", objType);
+    }
+
+    if (NULL == geo) {
+        g_free(name);
+        return NULL;
+    }
+
+    S57_setName(geo, name);
+    g_free(name);
+
+    S57_setGeoExt(geo, ext.W, ext.S, ext.E, ext.N);
+
+    guint nAtt = 0;
+    if (FALSE == _read(buf, &nAtt, sizeof(guint))) {
+        S57_doneData(geo, NULL);
+        return NULL;
+    }
+    for (guint i=0; i<nAtt; ++i) {
+        gchar *attName  = _readStr(buf);
+        gchar *attValue = _readStr(buf);
+
+        if (NULL==attName || NULL==attValue) {
+            g_free(attName);
+            g_free(attValue);
+            S57_doneData(geo, NULL);
+            return NULL;
+        }
+
+        S57_setAtt(geo, attName, attValue);
+
+        g_free(attName);
+        g_free(attValue);
+    }
+
+    if (FALSE == _read(buf, touchIdx, sizeof(guint) * SENC_NTOUCH)) {
+        S57_doneData(geo, NULL);
+        return NULL;
+    }
+
+    return geo;
+}
+
+int        S57_sencLoadCell(const char *sencPath, const char *filename, S57_sencLoadObject_cb loadObject_cb)
+{
+    return_if_null(sencPath);
+    return_if_null(filename);
+    return_if_null(loadObject_cb);
+
+    int       ret = FALSE;
+    _sencKey  key;
+    _sencHdr  hdr;
+    _sencBuf  buf;
+
+    if (FALSE == _getKey(filename, &key))
+        return FALSE;
+
+    gchar *sencName = _getSENCName(sencPath, filename);
+    if (FALSE == g_file_test(sencName, G_FILE_TEST_EXISTS)) {
+        g_free(sencName);
+        return FALSE;
+    }
+
+    GMappedFile *mf = g_mapped_file_new(sencName, FALSE, NULL);
+    if (NULL == mf) {
+        PRINTF("WARNING: SENC mmap failed (%s)\n", sencName);
+        g_free(sencName);
+        return FALSE;
+    }
+
+    buf.ptr = g_mapped_file_get_contents(mf);
+    buf.end = buf.ptr + g_mapped_file_get_length(mf);
+
+    if (FALSE == _read(&buf, &hdr, sizeof(_sencHdr))) {
+        PRINTF("WARNING: SENC header truncated (%s)\n", sencName);
+        goto exit;
+    }
+
+    if ((0 != memcmp(hdr.magic, SENC_MAGIC, sizeof(SENC_MAGIC))) ||
+        (SENC_VERSION     != hdr.version       ) ||
+        (sizeof(geocoord) != hdr.sizeofGeocoord) ||
+        (SENC_OVERLAP     != hdr.overlap       )  )
+    {
+        PRINTF("NOTE: SENC format mismatch - rebuild (%s)\n", sencName);
+        goto exit;
+    }
+
+    // out of date
+    if ((key.mtime    != hdr.key.mtime   ) ||
+        (key.size     != hdr.key.size    ) ||
+        (key.updn     != hdr.key.updn    ) ||
+        (key.updMtime != hdr.key.updMtime)  )
+    {
+        PRINTF("NOTE: SENC out of date (cell or update changed) - rebuild (%s)\n", sencName);
+        goto exit;
+    }
+
+    // corrupted count - bound by the data left before allocating
+    if (((gsize)(buf.end - buf.ptr) / SENC_GEO_MINSZ < hdr.nObj) || (G_MAXUINT / SENC_NTOUCH < hdr.nObj)) {
+        PRINTF("WARNING: SENC corrupted (nObj:%u) - rebuild (%s)\n", hdr.nObj, sencName);
+        goto exit;
+    }
+
+    {   // read all first - a corrupted SENC must not leave a partial cell
+        GPtrArray *geoList  = g_ptr_array_sized_new(hdr.nObj);
+        guint     *touchIdx = g_new0(guint, hdr.nObj * SENC_NTOUCH);
+        for (guint i=0; i<hdr.nObj; ++i) {
+            S57_geo *geo = _readGeo(&buf, touchIdx + i*SENC_NTOUCH);
+            if (NULL == geo)
+                break;
+            g_ptr_array_add(geoList, geo);
+        }
+
+        // out of range index - corrupted
+        int touchOK = TRUE;
+        for (guint i=0; i<geoList->len*SENC_NTOUCH; ++i) {
+            if (hdr.nObj < touchIdx[i]) {
+                touchOK = FALSE;
+                break;
+            }
+        }
+
+        if ((TRUE==touchOK) && (geoList->len==hdr.nObj)) {
+            // link touch
+            for (guint i=0; i<geoList->len; ++i) {
+                S57_geo *geo = (S57_geo *) g_ptr_array_index(geoList, i);
+                for (guint j=0; j<SENC_NTOUCH; ++j) {
+                    guint idx = touchIdx[i*SENC_NTOUCH + j];
+                    if (0 != idx)
+                        _touch[j].set(geo, (S57_geo *) g_ptr_array_index(geoList, idx-1));
+                }
+            }
+
+            for (guint i=0; i<geoList->len; ++i) {
+                S57_geo *geo = (S57_geo *) g_ptr_array_index(geoList, i);
+                loadObject_cb(S57_getName(geo), geo);
+            }
+            PRINTF("NOTE: SENC loaded (%s) EDTN:%s UPDN:%s nObj:%u\n", sencName, hdr.dsid_edtn, hdr.dsid_updn, hdr.nObj);
+            ret = TRUE;
+        } else {
+            PRINTF("WARNING: SENC corrupted - rebuild (%s)\n", sencName);
+            for (guint i=0; i<geoList->len; ++i)
+                S57_doneData((S57_geo *) g_ptr_array_index(geoList, i), NULL);
+        }
+
+        g_ptr_array_free(geoList, TRUE);
+        g_free(touchIdx);
+    }
+
+exit:
+    g_mapped_file_unref(mf);
+    g_free(sencName);
+
+    return ret;
+}
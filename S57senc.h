@@ -0,0 +1,43 @@
+// S57senc.h: System ENC - binary cache of S57 object loaded from a base cell + updates
+//
+// Project:  OpENCview
+
+/*
+    This file is part of the OpENCview project, a viewer of ENC.
+    Copyright (C) 2000-2018 Sylvain Duclos sduclos@users.sourceforge.net
+
+    OpENCview is free software: you can redistribute it and/or modify
+    it under the terms of the Lesser GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpENCview is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Lesser GNU General Public License for more details.
+
+    You should have received a copy of the Lesser GNU General Public License
+    along with OpENCview.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+
+#ifndef _S57SENC_H_
+#define _S57SENC_H_
+
+#include "S57data.h"   // S57_geo
+
+#include <glib.h>      // GPtrArray
+
+// called on each S57_geo read from the SENC, in the order it was loaded by OGR
+typedef int (*S57_sencLoadObject_cb)(const char *objname, S57_geo *geo);
+
+// load the SENC of ENC 'filename' from dir 'sencPath'
+// return FALSE if no SENC or SENC out of date (base cell / update file changed)
+// Note: geo come with their CS touch and overlap mark - skip S52_CS_touch() and line overlap
+int      S57_sencLoadCell(const char *sencPath, const char *filename, S57_sencLoadObject_cb loadObject_cb);
+// save S57_geo of 'geoList' (geographic coord - ie before projection)
+// Note: save after S52_CS_touch() and line overlap
+int      S57_sencSaveCell(const char *sencPath, const char *filename, GPtrArray *geoList);
+
+#endif // _S57SENC_H_
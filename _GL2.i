@@ -43,6 +43,35 @@
 #endif  // S52_USE_GL2
 #endif  // S52_USE_GLSC2
 
+#if !defined(S52_USE_GLSC2)
+// SY instancing (see _drawSYinstanced()) - NULL: pseudo-instancing
+static PFNGLDRAWARRAYSINSTANCEDEXTPROC _glDrawArraysInstanced = NULL;
+static PFNGLVERTEXATTRIBDIVISOREXTPROC _glVertexAttribDivisor = NULL;
+
+// GPU timer query (see S52_GL_beginGPUTimer()) - NULL: no GPU time
+static PFNGLGENQUERIESEXTPROC          _glGenQueries          = NULL;
+static PFNGLDELETEQUERIESEXTPROC       _glDeleteQueries       = NULL;
+static PFNGLBEGINQUERYEXTPROC          _glBeginQuery          = NULL;
+static PFNGLENDQUERYEXTPROC            _glEndQuery            = NULL;
+static PFNGLGETQUERYOBJECTUIVEXTPROC   _glGetQueryObjectuiv   = NULL;
+static PFNGLGETQUERYOBJECTUI64VEXTPROC _glGetQueryObjectui64v = NULL;
+#endif
+
+// frame stats - since init (see S52_GL_getStat())
+// Note: freetype-gl atlas upload (texture_atlas_upload()) not counted
+static guint _nDrawCall  = 0;   // glDrawArrays() call
+static guint _nDrawVert  = 0;   // vertex submitted
+static guint _nVBO       = 0;   // VBO created
+static guint _nTexUpload = 0;   // texture upload - allocation only (NULL data) not counted
+#define glDrawArrays(mode, first, count) \
+    (++_nDrawCall, _nDrawVert += (guint)(count), glDrawArrays(mode, first, count))
+#define glGenBuffers(n, buffers) \
+    (_nVBO += (guint)(n), glGenBuffers(n, buffers))
+#define glTexImage2D(target, level, ifmt, w, h, border, fmt, type, data) \
+    ((NULL != (data)) ? ++_nTexUpload : 0, glTexImage2D(target, level, ifmt, w, h, border, fmt, type, data))
+#define glTexSubImage2D(target, level, x, y, w, h, fmt, type, data) \
+    (++_nTexUpload, glTexSubImage2D(target, level, x, y, w, h, fmt, type, data))
+
 typedef double GLdouble;
 
 #include "tesselator.h"  // will pull also: typedef void GLvoid;
@@ -72,6 +101,9 @@ static double      _getWorldGridRef(S52_obj *, double *, double *, double *, dou
 static int         _fillArea(S57_geo *);
 static void        _glMatrixMode(guint);
 static void        _glLoadIdentity(int);
+static void        _glPushMatrix(int);
+static void        _glPopMatrix(int);
+static void        _glOrtho(double, double, double, double, double, double);
 static void        _glUniformMatrix4fv_uModelview(void);
 static int         _glMatrixSet(VP);
 static int         _glMatrixDel(VP);
@@ -101,6 +133,9 @@ static int _GL_OES_texture_npot = FALSE;
 static int _GL_EXT_debug_marker = FALSE;
 static int _GL_OES_point_sprite = FALSE;
 static int _GL_EXT_robustness   = FALSE;
+static int _GL_EXT_instanced_arrays = FALSE;  // also ANGLE / ARB, GLES3 core
+static int _GL_EXT_disjoint_timer_query = FALSE;  // GLES2 - GL_GPU_DISJOINT_EXT valid
+static int _GL_ARB_timer_query  = FALSE;          // GL2 - same call without EXT, no disjoint
 static int _GL_KHR_no_error     = FALSE;
 
 // used to convert float to double for tesselator
@@ -124,20 +159,35 @@ static GLint _uGlowOn     = 0;
 static GLint _uStipOn     = 0;
 //static GLint _uScaleOn    = 0;
 
-// test - optimisation
-//static GLint _uPalOn      = 0;
-//static GLint _uPalArray   = 0;
+// AC batch - colour lookup in the vertex shader (see S52_GL_drawACBatch())
+static GLint _uPalOn      = -1;
+static GLint _uPalArray   = -1;
+
+// SY instancing - symbol placed by the vertex shader (see S52_GL_endSYInst())
+static GLint _uInstOn     = -1;
+static GLint _uInstScale  = -1;
+
+// LS batch - cumulative distance and wide line extrusion (see S52_GL_drawLSBatch())
+static GLint _uDistOn     = -1;
+static GLint _uLineHalfW  = -1;
 
 static GLint _uPattOn     = 0;
 static GLint _uPattGridX  = 0;
 static GLint _uPattGridY  = 0;
 static GLint _uPattW      = 0;
 static GLint _uPattH      = 0;
+static GLint _uPattAtlas  = -1;  // AP atlas sub-rect - w = 0.0: own texture
 
 // glsl varying
 static GLint _aPosition   = -2;
 static GLint _aUV         = -2;
 static GLint _aAlpha      = -2;
+static GLint _aInst       = -1;  // SY instance: x, y, rotation
+static GLint _aDist       = -1;  // LS batch: distance from the start of the line
+static GLint _aExt        = -1;  // LS batch: wide line extrusion (unit normal)
+
+// GL_ALIASED_LINE_WIDTH_RANGE max - above: LS batch expand line in triangles
+static GLfloat _lineWidthMax = 1.0;
 
 // alpha is 0.0 - 1.0
 #define TRNSP_FAC_GLES2   0.25
@@ -234,6 +284,29 @@ static const GLubyte _dashpa_mask_bits[4] = {     // 4 x 8 bits = 32 bits
 
 // other pattern are created using FBO
 static GLuint        _fboID = 0;
+// FB of the window - 0, or FBO of the caller when headless (S52_setFBO())
+static GLuint        _fboWinID  = 0;
+// FB bound back after a render to texture - window, tile FBO while a tile is rendered (S52_GL_beginTile())
+static GLuint        _fboCrntID = 0;
+
+// AP atlas - all pattern tile in one texture (see _getAPslot())
+#define AP_ATLAS_SZ 1024   // POT
+
+typedef struct _APslot {
+    GLfloat rect[4];        // sub-rect in atlas (UV): x, y, w, h
+    double  tileWpx;
+    double  tileHpx;
+    double  stagOffsetPix;
+} _APslot;
+
+static GLuint        _APatlasTexID     = 0;
+static GHashTable   *_APatlasSlot      = NULL;  // S52_DListData (pattern) --> _APslot
+static GLint         _APatlasX         = 0;     // shelf packing
+static GLint         _APatlasY         = 0;
+static GLint         _APatlasRowH      = 0;
+static double        _APatlasDotpitchX = 0.0;   // dot pitch of the tile in atlas
+static double        _APatlasDotpitchY = 0.0;
+static int           _APatlasNewPLib   = FALSE; // TRUE: slot keyed by old DListData (S52_GL_newPLib())
 //---- PATTERN GL2 / GLES2 -----------------------------------------------------------
 
 
@@ -968,7 +1041,50 @@ static int       _loadProcEXT()
     return TRUE;
 }
 #endif  // S52_USE_EGL
+#endif  // !S52_USE_ANDROID
+
+#if !defined(S52_USE_GLSC2) && (defined(S52_USE_EGL) || defined(S52_USE_ANDROID))
+static int       _loadProcGL2()
+// entry point of SY instancing and GPU timer query - also on Android
+{
+    typedef void (*proc)(void);
+    extern proc eglGetProcAddress(const char *procname);
+
+    // SY instancing - GLES3 core, then EXT, then ANGLE
+    _glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC) eglGetProcAddress("glDrawArraysInstanced");
+    _glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC) eglGetProcAddress("glVertexAttribDivisor");
+    if ((NULL==_glDrawArraysInstanced) || (NULL==_glVertexAttribDivisor)) {
+        _glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC) eglGetProcAddress("glDrawArraysInstancedEXT");
+        _glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC) eglGetProcAddress("glVertexAttribDivisorEXT");
+    }
+    if ((NULL==_glDrawArraysInstanced) || (NULL==_glVertexAttribDivisor)) {
+        _glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC) eglGetProcAddress("glDrawArraysInstancedANGLE");
+        _glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC) eglGetProcAddress("glVertexAttribDivisorANGLE");
+    }
+    PRINTF("DEBUG: eglGetProcAddress(glDrawArraysInstanced)  %s\n",     (NULL==_glDrawArraysInstanced)?"FAILED":"OK");
+
+    // GPU timer query - EXT_disjoint_timer_query, then core / ARB_timer_query
+    _glGenQueries          = (PFNGLGENQUERIESEXTPROC)          eglGetProcAddress("glGenQueriesEXT");
+    _glDeleteQueries       = (PFNGLDELETEQUERIESEXTPROC)       eglGetProcAddress("glDeleteQueriesEXT");
+    _glBeginQuery          = (PFNGLBEGINQUERYEXTPROC)          eglGetProcAddress("glBeginQueryEXT");
+    _glEndQuery            = (PFNGLENDQUERYEXTPROC)            eglGetProcAddress("glEndQueryEXT");
+    _glGetQueryObjectuiv   = (PFNGLGETQUERYOBJECTUIVEXTPROC)   eglGetProcAddress("glGetQueryObjectuivEXT");
+    _glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VEXTPROC) eglGetProcAddress("glGetQueryObjectui64vEXT");
+    if ((NULL==_glGenQueries) || (NULL==_glGetQueryObjectui64v)) {
+        _glGenQueries          = (PFNGLGENQUERIESEXTPROC)          eglGetProcAddress("glGenQueries");
+        _glDeleteQueries       = (PFNGLDELETEQUERIESEXTPROC)       eglGetProcAddress("glDeleteQueries");
+        _glBeginQuery          = (PFNGLBEGINQUERYEXTPROC)          eglGetProcAddress("glBeginQuery");
+        _glEndQuery            = (PFNGLENDQUERYEXTPROC)            eglGetProcAddress("glEndQuery");
+        _glGetQueryObjectuiv   = (PFNGLGETQUERYOBJECTUIVEXTPROC)   eglGetProcAddress("glGetQueryObjectuiv");
+        _glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VEXTPROC) eglGetProcAddress("glGetQueryObjectui64v");
+    }
+    PRINTF("DEBUG: eglGetProcAddress(glGetQueryObjectui64v)  %s\n",     (NULL==_glGetQueryObjectui64v)?"FAILED":"OK");
 
+    return TRUE;
+}
+#endif  // !S52_USE_GLSC2 && (S52_USE_EGL || S52_USE_ANDROID)
+
+#if !defined(S52_USE_ANDROID)
 #if !defined(S52_USE_GLSC2)
 static int       _saveShaderBin(GLuint programObject)
 // Save a GLSL shader bin into a file
@@ -1169,18 +1285,31 @@ static GLuint    _compShaderSrc(GLuint programObject)
         uniform float   uStipOn;
         //uniform float   uScaleOn;
 
-        // optimisation test - color LUP
+        // AC batch - color LUP, aPosition.z = cidx + 64 * trans
         uniform int     uPalOn;
-        //uniform vec4    uPalArray[63];  // 63 - S52_COL_NUM
+        uniform vec4    uPalArray[63];  // 63 - S52_COL_NUM
+
+        // SY instancing - same as _renderSY_POINT_T() with uModelview identity
+        uniform int     uInstOn;
+        uniform vec2    uInstScale;     // scale to pixel, Y flipped
+
+        // LS batch - stipple on aDist, wide line extruded by aExt
+        uniform int     uDistOn;
+        uniform float   uLineHalfW;     // half pen width in world
 
         attribute vec4  aPosition;
         attribute float aAlpha;
         attribute vec2  aUV;
+        attribute vec3  aInst;          // x, y, rotation (rad)
+        attribute highp vec2 aDist;     // distance from the start of the line to the segment, in the segment (world)
+        attribute vec2  aExt;           // unit normal - (0,0) on GL_LINES
 
         varying vec2    v_texCoord;
         varying float   v_alpha;
         varying vec4    v_color;
-        varying float   v_dist;
+        varying float   v_dist;         // stipple pattern (tex_n.x) - small, mediump in the fragment shader
+
+        const float pixelsPerPattern = 32.0;
 
         void main(void)
         {
@@ -1188,6 +1317,16 @@ static GLuint    _compShaderSrc(GLuint programObject)
             v_alpha      = aAlpha;
             gl_PointSize = uPointSize;
 
+            if (1 == uInstOn) {
+                float c = cos(aInst.z);
+                float s = sin(aInst.z);
+                pos.xy  = aInst.xy + vec2(c*pos.x - s*pos.y, s*pos.x + c*pos.y) * uInstScale;
+            }
+
+            if (1 == uDistOn) {
+                pos.xy += aExt * uLineHalfW;
+            }
+
             if (1 == uPattOn) {
                 //v_texCoord.x = (aPosition.x - uPattGridX) / uPattW;
                 //v_texCoord.y = (aPosition.y - uPattGridY) / uPattH;
@@ -1195,6 +1334,16 @@ static GLuint    _compShaderSrc(GLuint programObject)
                 v_texCoord.y = (uPattGridY - aPosition.y) / uPattH;
             }
 
+            else if (1 == uPalOn) {
+                // Note: lookup here - cidx passed as a varying would be interpolated
+                int idx   = int(pos.z);
+                int trans = idx / 64;
+                v_color   = uPalArray[idx - trans*64];
+                v_color.a = float(4 - trans) * 0.25;  // TRNSP_FAC_GLES2
+                pos.z     = 0.0;
+                v_texCoord = aUV;                    // TXT batch
+            }
+
             /*
             else if (0 <= uPalOn) {
                 // optimisation test -> uPalOn = aPosition.z;
@@ -1213,8 +1362,20 @@ static GLuint    _compShaderSrc(GLuint programObject)
             }
             */
 
+            else if (1 == uDistOn) {
+                // Z keep overlap suppression (Z_CLIP_PLANE)
+                // cumulative distance in pattern at highp, wrapped at the segment start so
+                // the varying stay small - the segment offset interpolate linearly
+                v_dist     = 0.0;
+                if (0.0 < uStipOn) {
+                    highp float patt = uStipOn * pixelsPerPattern;
+                    v_dist = fract(aDist.x / patt) + aDist.y / patt;
+                }
+                v_texCoord = vec2(1.0, 0.0);
+            }
+
             else if (0.0 < uStipOn) {
-                v_dist     = pos.z;
+                v_dist     = pos.z / uStipOn / pixelsPerPattern;
                 pos.z      = 0.0;
                 v_texCoord = aUV;
             } else {
@@ -1244,6 +1405,7 @@ static GLuint    _compShaderSrc(GLuint programObject)
         uniform int   uBlitOn;
         uniform int   uTextOn;
         uniform int   uPattOn;
+        uniform vec4  uPattAtlas;   // AP atlas sub-rect - z = 0.0: own texture (GL_REPEAT)
         uniform int   uGlowOn;
         uniform float uStipOn;
 
@@ -1251,13 +1413,12 @@ static GLuint    _compShaderSrc(GLuint programObject)
 
         //uniform float uScaleOn;
 
-        //uniform int   uPalOn;
+        uniform int   uPalOn;
 
         varying vec2  v_texCoord;
         varying float v_alpha;
         varying float v_dist;
-
-        const float pixelsPerPattern = 32.0;
+        varying vec4  v_color;
 
         void main(void) {
 
@@ -1276,8 +1437,16 @@ static GLuint    _compShaderSrc(GLuint programObject)
                 gl_FragColor.a   = texture2D(uSampler2d, v_texCoord).a;
 //#endif
                 gl_FragColor.rgb = uColor.rgb;
+                // TXT batch - colour per vertex
+                if (1 == uPalOn) {
+                    gl_FragColor.rgb = v_color.rgb;
+                }
             } else if (1 == uPattOn) {
-                gl_FragColor = texture2D(uSampler2d, v_texCoord);
+                vec2 tc = v_texCoord;
+                if (0.0 < uPattAtlas.z) {
+                    tc = uPattAtlas.xy + fract(v_texCoord) * uPattAtlas.zw;
+                }
+                gl_FragColor = texture2D(uSampler2d, tc);
                 gl_FragColor.rgb = uColor.rgb;
             })
 
@@ -1297,7 +1466,7 @@ static GLuint    _compShaderSrc(GLuint programObject)
             else if (0.0 < uStipOn) {
                 vec2 tex_n = v_texCoord;
                 //tex_n.x   *= v_dist / uScaleOn / 32.0;
-                tex_n.x   *= v_dist / uStipOn / pixelsPerPattern;
+                tex_n.x   *= v_dist;  // in pattern (see vertex shader)
                 //tex_n.x   *= v_dist;
                 //tex_n.y   *= v_dist / uScaleOn / 32.0;
                 gl_FragColor.a   = texture2D(uSampler2d, tex_n).a;
@@ -1322,6 +1491,8 @@ static GLuint    _compShaderSrc(GLuint programObject)
                         discard;
                 }
                  */
+            } else if (1 == uPalOn) {
+                gl_FragColor = v_color;
             } else {
 
                 //
@@ -1406,6 +1577,9 @@ static GLuint    _bindAttrib(GLuint programObject)
     //_aPosition2  = glGetAttribLocation(programObject, "aPosition2");
     _aUV         = glGetAttribLocation(programObject, "aUV");
     _aAlpha      = glGetAttribLocation(programObject, "aAlpha");
+    _aInst       = glGetAttribLocation(programObject, "aInst");
+    _aDist       = glGetAttribLocation(programObject, "aDist");
+    _aExt        = glGetAttribLocation(programObject, "aExt");
 
     return programObject;
 }
@@ -1424,9 +1598,17 @@ static GLuint    _bindUnifrom(GLuint programObject)
     _uStipOn     = glGetUniformLocation(programObject, "uStipOn");
     //_uScaleOn    = glGetUniformLocation(programObject, "uScaleOn");
 
-    // optimisation test
-    //_uPalOn      = glGetUniformLocation(programObject, "uPalOn");
-    //_uPalArray   = glGetUniformLocation(programObject, "uPalArray");
+    // AC batch
+    _uPalOn      = glGetUniformLocation(programObject, "uPalOn");
+    _uPalArray   = glGetUniformLocation(programObject, "uPalArray");
+
+    // SY instancing
+    _uInstOn     = glGetUniformLocation(programObject, "uInstOn");
+    _uInstScale  = glGetUniformLocation(programObject, "uInstScale");
+
+    // LS batch
+    _uDistOn     = glGetUniformLocation(programObject, "uDistOn");
+    _uLineHalfW  = glGetUniformLocation(programObject, "uLineHalfW");
 
     _uColor      = glGetUniformLocation(programObject, "uColor");
 
@@ -1435,6 +1617,7 @@ static GLuint    _bindUnifrom(GLuint programObject)
     _uPattGridY  = glGetUniformLocation(programObject, "uPattGridY");
     _uPattW      = glGetUniformLocation(programObject, "uPattW");
     _uPattH      = glGetUniformLocation(programObject, "uPattH");
+    _uPattAtlas  = glGetUniformLocation(programObject, "uPattAtlas");
 
     return programObject;
 }
@@ -1611,6 +1794,10 @@ static int       _init_gl2(void)
 #endif
 #endif  // !S52_USE_ANDROID
 
+#if !defined(S52_USE_GLSC2) && (defined(S52_USE_EGL) || defined(S52_USE_ANDROID))
+    _loadProcGL2();
+#endif
+
 #ifdef S52_USE_GLSC2
     _programObject = _loadShaderBin();
     if (0 == _programObject) {
@@ -1653,7 +1840,10 @@ static int       _init_gl2(void)
     _clearColor();
 
     // turn OFF rgb lookup
-    //glUniform1i(_uPalOn, -1);
+    glUniform1i(_uPalOn, 0);
+    glUniform1i(_uInstOn, 0);
+    glUniform1i(_uDistOn, 0);
+    glUniform4f(_uPattAtlas, 0.0, 0.0, 0.0, 0.0);
 
     return TRUE;
 }
@@ -1949,13 +2139,181 @@ static int       _renderTexure(S52_obj *obj, double tileWpx, double tileHpx, dou
     _glMatrixDel(VP_WIN);
 
     glBindTexture(GL_TEXTURE_2D, 0);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, _fboCrntID);
 
     _checkError("_renderTexure() -2-");
 
     return mask_texID;
 }
 
+// AP atlas - tile of all PLib pattern drawn in one texture (see _getAPslot())
+// Note: tile is an alpha mask (colour from uColor), so palette change cost nothing
+static int _APslotNew(S52_obj *obj, _APslot *slot, GLint x0, GLint y0, GLsizei w, GLsizei h)
+// render the tile of the current AP command of obj in the atlas at x0,y0 - same as _renderTexure()
+{
+    _bindFBO(_APatlasTexID);
+
+    glViewport(0, 0, AP_ATLAS_SZ, AP_ATLAS_SZ);
+
+    _glMatrixMode  (GL_PROJECTION);
+    _glPushMatrix  (GL_PROJECTION);
+    _glLoadIdentity(GL_PROJECTION);
+    _glOrtho(0.0, AP_ATLAS_SZ, 0.0, AP_ATLAS_SZ, Z_CLIP_PLANE, -Z_CLIP_PLANE);
+    _glMatrixMode  (GL_MODELVIEW);
+    _glPushMatrix  (GL_MODELVIEW);
+    _glLoadIdentity(GL_MODELVIEW);
+    glUniformMatrix4fv(_uProjection, 1, GL_FALSE, _pjm[_pjmTop]);
+
+    {   // set line/point width
+        double   dummy = 0.0;
+        char     pen_w = '1';
+        S52_PL_getLCdata(obj, &dummy, &pen_w);
+
+        _glLineWidth(pen_w - '0' + 1.0);  // must enlarge line glsl sampler
+        _glPointSize(pen_w - '0' + 1.0);  // sampler + AA soften pixel, so need enhencing a bit
+    }
+
+    S52_DListData *DListData = S52_PL_getDListData(obj);
+
+    _glTranslated(x0, y0, 0.0);
+    _fixDPI_glScaled();
+    _renderTile(DListData);
+
+    if (0.0 != slot->stagOffsetPix) {
+        _glLoadIdentity(GL_MODELVIEW);
+
+        if (TRUE == _GL_OES_texture_npot) {
+            _glTranslated(x0 + (slot->tileWpx/2.0) + slot->stagOffsetPix, y0 + slot->tileHpx, 0.0);
+        } else {
+            _glTranslated(x0 + (w/2.0) + slot->stagOffsetPix, y0 + (h/2.0), 0.0);
+        }
+
+        _fixDPI_glScaled();
+
+        _renderTile(DListData);
+    }
+
+    _glMatrixMode(GL_PROJECTION);
+    _glPopMatrix (GL_PROJECTION);
+    _glMatrixMode(GL_MODELVIEW);
+    _glPopMatrix (GL_MODELVIEW);
+    glUniformMatrix4fv(_uProjection, 1, GL_FALSE, _pjm[_pjmTop]);
+    glUniformMatrix4fv(_uModelview,  1, GL_FALSE, _mvm[_mvmTop]);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _fboCrntID);
+    glViewport(_vp.x, _vp.y, _vp.w, _vp.h);
+
+    slot->rect[0] = (GLfloat) x0 / AP_ATLAS_SZ;
+    slot->rect[1] = (GLfloat) y0 / AP_ATLAS_SZ;
+    slot->rect[2] = (GLfloat) w  / AP_ATLAS_SZ;
+    slot->rect[3] = (GLfloat) h  / AP_ATLAS_SZ;
+
+    _checkError("_APslotNew()");
+
+    return TRUE;
+}
+
+static int       _resetAPatlas(void)
+// new dot pitch / PLib - clear atlas, all tile will be drawn again
+{
+    if (0 == _APatlasTexID) {
+        _APatlasTexID = _initAPtexStore(AP_ATLAS_SZ, AP_ATLAS_SZ, NULL);
+        _APatlasSlot  = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    }
+
+    g_hash_table_remove_all(_APatlasSlot);
+    _APatlasX    = 0;
+    _APatlasY    = 0;
+    _APatlasRowH = 0;
+    _APatlasDotpitchX = S52_MP_get(S52_MAR_DOTPITCH_MM_X);
+    _APatlasDotpitchY = S52_MP_get(S52_MAR_DOTPITCH_MM_Y);
+    _APatlasNewPLib   = FALSE;
+
+    _bindFBO(_APatlasTexID);
+    glViewport(0, 0, AP_ATLAS_SZ, AP_ATLAS_SZ);
+    _clearColor();
+    glBindFramebuffer(GL_FRAMEBUFFER, _fboCrntID);
+    glViewport(_vp.x, _vp.y, _vp.w, _vp.h);
+
+    return TRUE;
+}
+
+static _APslot  *_getAPslot(S52_obj *obj)
+// atlas sub-rect of the pattern of the current AP command of obj, drawn on first use
+// return NULL if no room in the atlas - use a texture for this pattern (_renderTexure())
+{
+    // GLSC2 binary shader has no uPattAtlas
+    if (-1 == _uPattAtlas)
+        return NULL;
+
+    if ((0 == _APatlasTexID) || (TRUE == _APatlasNewPLib) ||
+        (_APatlasDotpitchX != S52_MP_get(S52_MAR_DOTPITCH_MM_X)) ||
+        (_APatlasDotpitchY != S52_MP_get(S52_MAR_DOTPITCH_MM_Y)))
+        _resetAPatlas();
+
+    S52_DListData *DListData = S52_PL_getDListData(obj);
+    if (NULL == DListData)
+        return NULL;
+
+    _APslot *slot = (_APslot *)g_hash_table_lookup(_APatlasSlot, DListData);
+    if (NULL != slot)
+        return slot;
+
+    // same tile dim as _getWorldGridRef()
+    double tw = 0.0;
+    double th = 0.0;
+    double dx = 0.0;
+    S52_PL_getAPTileDim(obj, &tw, &th, &dx);
+
+    double tileWpx       = tw / (S52_MP_get(S52_MAR_DOTPITCH_MM_X) * 100.0);
+    double tileHpx       = th / (S52_MP_get(S52_MAR_DOTPITCH_MM_Y) * 100.0);
+    double stagOffsetPix = dx / (S52_MP_get(S52_MAR_DOTPITCH_MM_X) * 100.0);
+
+    // same texture size as _renderTexure()
+    GLsizei w = ceil(tileWpx);
+    GLsizei h = ceil(tileHpx);
+    if (FALSE == _GL_OES_texture_npot) {
+        w = _minPOT(w);
+        h = _minPOT(h);
+    }
+    if (0.0 != stagOffsetPix) {
+        w *= 2;
+        h *= 2;
+    }
+
+    // shelf packing - 1 pixel gutter (GL_LINEAR)
+    if (AP_ATLAS_SZ < _APatlasX + w + 2) {
+        _APatlasX    = 0;
+        _APatlasY   += _APatlasRowH;
+        _APatlasRowH = 0;
+    }
+    if ((AP_ATLAS_SZ < _APatlasX + w + 2) || (AP_ATLAS_SZ < _APatlasY + h + 2)) {
+        PRINTF("WARNING: AP atlas full - pattern of %s use its own texture\n", S52_PL_getOBCL(obj));
+        return NULL;
+    }
+
+    slot = g_new0(_APslot, 1);
+    slot->tileWpx       = tileWpx;
+    slot->tileHpx       = tileHpx;
+    slot->stagOffsetPix = stagOffsetPix;
+
+    // scissor box interfere with texture creation
+    if (TRUE == glIsEnabled(GL_SCISSOR_TEST)) {
+        glDisable(GL_SCISSOR_TEST);
+        _APslotNew(obj, slot, _APatlasX + 1, _APatlasY + 1, w, h);
+        glEnable(GL_SCISSOR_TEST);
+    } else {
+        _APslotNew(obj, slot, _APatlasX + 1, _APatlasY + 1, w, h);
+    }
+
+    _APatlasX   += w + 2;
+    _APatlasRowH = MAX(_APatlasRowH, h + 2);
+
+    g_hash_table_insert(_APatlasSlot, DListData, slot);
+
+    return slot;
+}
+
 static int       _renderAP_gl2(S52_obj *obj)
 {
     // debug
@@ -1982,7 +2340,9 @@ static int       _renderAP_gl2(S52_obj *obj)
 
     //PRINTF("DEBUG: %s: grid x1:%f y1:%f Ww:%f Hw:%f sop:%f\n", S52_PL_getOBCL(obj), LLx, LLy, tileWw, tileHw, stagOffsetPix);
 
-    GLuint mask_texID = S52_PL_getAPtexID(obj);
+    // pattern tile in atlas, else in its own texture
+    _APslot *slot       = _getAPslot(obj);
+    GLuint   mask_texID = (NULL == slot) ? S52_PL_getAPtexID(obj) : _APatlasTexID;
     if (0 == mask_texID) {
         // FIXME: refactor into init/build/draw APtex
         // - initAPTex
@@ -2015,6 +2375,8 @@ static int       _renderAP_gl2(S52_obj *obj)
     glUniform1f(_uPattGridY, LLy);
     glUniform1f(_uPattW,     tileWw);        // tile width in world
     glUniform1f(_uPattH,     tileHw);        // tile height in world
+    if (NULL != slot)
+        glUniform4fv(_uPattAtlas, 1, slot->rect);
 
     glBindTexture(GL_TEXTURE_2D, mask_texID);
 
@@ -2022,6 +2384,9 @@ static int       _renderAP_gl2(S52_obj *obj)
 
     glBindTexture(GL_TEXTURE_2D, 0);
 
+    if (NULL != slot)
+        glUniform4f(_uPattAtlas, 0.0, 0.0, 0.0, 0.0);
+
     //glUniform1f(_uPattOn,    0.0);
     glUniform1i(_uPattOn,    0);
     glUniform1f(_uPattGridX, 0.0);
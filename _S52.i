@@ -691,6 +691,50 @@ static int                 _handleS52method(char *str, char *result, char *err)
         goto exit;
     }
 
+    //DLL int    STD S52_getFrameStats(unsigned int frame, S52_frameStats *stats);
+    if (0 == g_strcmp0(cmdName, "S52_getFrameStats")) {
+        if (1 != count) {
+            _setErr(err, "params 'frame' not found");
+            goto exit;
+        }
+
+        double frame = json_array_get_number(paramsArr, 0);
+
+        S52_frameStats stats;
+        int ret = S52_getFrameStats((unsigned int)frame, &stats);
+        if (FALSE == ret) {
+            _encode(result, "[0]");
+            goto exit;
+        }
+
+        GString *prio    = g_string_new("");
+        GString *gpuPrio = g_string_new("");
+        GString *gpuCmd  = g_string_new("");
+        for (int i=0; i<S52_STATS_NPRIO; ++i) {
+            g_string_append_printf(prio,    "%s%.3f", (0==i) ? "" : ",", stats.prio_ms[i]);
+            g_string_append_printf(gpuPrio, "%s%.3f", (0==i) ? "" : ",", stats.gpuPrio_ms[i]);
+        }
+        for (int i=0; i<S52_STATS_NCMD; ++i)
+            g_string_append_printf(gpuCmd,  "%s%.3f", (0==i) ? "" : ",", stats.gpuCmd_ms[i]);
+
+        _encode(result, "[{\"frame\":%u,\"draw_ms\":%.3f,\"app_ms\":%.3f,\"cull_ms\":%.3f,\"cullLights_ms\":%.3f,"
+                        "\"prio_ms\":[%s],\"text_ms\":%.3f,\"grat_ms\":%.3f,\"legend_ms\":%.3f,\"glend_ms\":%.3f,\"last_ms\":%.3f,"
+                        "\"nObjTotal\":%u,\"nCullSupp\":%u,\"nCullScamin\":%u,\"nCullView\":%u,\"nObjDraw\":%u,\"nCmd\":%u,"
+                        "\"nDrawCall\":%u,\"nVertex\":%u,\"nVBO\":%u,\"nTexUpload\":%u,"
+                        "\"gpu_ms\":%.3f,\"gpuPrio_ms\":[%s],\"gpuCmd_ms\":[%s]}]",
+                stats.frame, stats.draw_ms, stats.app_ms, stats.cull_ms, stats.cullLights_ms,
+                prio->str, stats.text_ms, stats.grat_ms, stats.legend_ms, stats.glend_ms, stats.last_ms,
+                stats.nObjTotal, stats.nCullSupp, stats.nCullScamin, stats.nCullView, stats.nObjDraw, stats.nCmd,
+                stats.nDrawCall, stats.nVertex, stats.nVBO, stats.nTexUpload,
+                stats.gpu_ms, gpuPrio->str, gpuCmd->str);
+
+        g_string_free(gpuCmd,  TRUE);
+        g_string_free(gpuPrio, TRUE);
+        g_string_free(prio,    TRUE);
+
+        goto exit;
+    }
+
     //DLL const char * STD S52_version(void);
     if (0 == g_strcmp0(cmdName, "S52_version")) {
         //const char *version = S52_version();
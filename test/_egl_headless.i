@@ -0,0 +1,204 @@
+// _egl_headless.i: EGL without window for s52headless.c, s52bench.c
+//
+// Project:  OpENCview
+
+/*
+    This file is part of the OpENCview project, a viewer of ENC.
+    Copyright (C) 2000-2018 Sylvain Duclos sduclos@users.sourceforge.net
+
+    OpENCview is free software: you can redistribute it and/or modify
+    it under the terms of the Lesser GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpENCview is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Lesser GNU General Public License for more details.
+
+    You should have received a copy of the Lesser GNU General Public License
+    along with OpENCview.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Mesa surfaceless platform (EGL_MESA_platform_surfaceless) and EGL_KHR_surfaceless_context:
+// render in an FBO given to libS52 (S52_setFBO()), else in a pbuffer (ie llvmpipe: LIBGL_ALWAYS_SOFTWARE=1)
+// Note: LOGI(), LOGE() defined by the includer
+
+#define EGL_EGLEXT_PROTOTYPES 1
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES2/gl2.h>
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+typedef struct hlState {
+    EGLDisplay eglDisplay;
+    EGLSurface eglSurface;  // EGL_NO_SURFACE when surfaceless
+    EGLContext eglContext;
+
+    GLuint     fboID;       // surfaceless - FB of libS52
+    GLuint     texID;
+} hlState;
+
+static int      _egl_beg (hlState *hl, const char *tag)
+{
+    (void)tag;
+
+    if (hl->eglContext != eglGetCurrentContext()) {
+        if (EGL_FALSE == eglMakeCurrent(hl->eglDisplay, hl->eglSurface, hl->eglSurface, hl->eglContext)) {
+            LOGE("_egl_beg(): eglMakeCurrent() failed. [0x%x]\n", eglGetError());
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+static int      _egl_end (hlState *hl, const char *tag)
+// no swap - frame read from the FB
+{
+    (void)hl;
+    (void)tag;
+
+    return TRUE;
+}
+
+static int      _egl_init(hlState *hl, int width, int height, int pbuffer)
+{
+    const char *clientExt = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    int         surfless  = (FALSE==pbuffer) && (NULL!=clientExt) &&
+                            (NULL!=g_strrstr(clientExt, "EGL_MESA_platform_surfaceless"));
+
+    hl->eglDisplay = EGL_NO_DISPLAY;
+    if (TRUE == surfless) {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (NULL != getPlatformDisplay)
+            hl->eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    }
+    if (EGL_NO_DISPLAY == hl->eglDisplay) {
+        surfless       = FALSE;
+        hl->eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+    if (EGL_NO_DISPLAY == hl->eglDisplay) {
+        LOGE("eglGetDisplay() failed. [0x%x]\n", eglGetError());
+        return FALSE;
+    }
+
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (EGL_FALSE == eglInitialize(hl->eglDisplay, &major, &minor)) {
+        LOGE("eglInitialize() failed. [0x%x]\n", eglGetError());
+        return FALSE;
+    }
+    LOGI("eglInitialize(): major:%i minor:%i\n", major, minor);
+    LOGI("EGL Vendor    :%s\n", eglQueryString(hl->eglDisplay, EGL_VENDOR));
+
+    const char *ext = eglQueryString(hl->eglDisplay, EGL_EXTENSIONS);
+    if ((TRUE==surfless) && (NULL==g_strrstr(ext, "EGL_KHR_surfaceless_context")))
+        surfless = FALSE;
+
+    if (EGL_TRUE != eglBindAPI(EGL_OPENGL_ES_API)) {
+        LOGE("eglBindAPI() failed. [0x%x]\n", eglGetError());
+        return FALSE;
+    }
+
+    const EGLint eglConfigList[] = {
+        EGL_SURFACE_TYPE,    (TRUE==surfless) ? EGL_DONT_CARE : EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+        EGL_RED_SIZE,        8,
+        EGL_GREEN_SIZE,      8,
+        EGL_BLUE_SIZE,       8,
+        EGL_NONE
+    };
+
+    EGLConfig eglConfig     = NULL;
+    EGLint    eglNumConfigs = 0;
+    if ((EGL_FALSE==eglChooseConfig(hl->eglDisplay, eglConfigList, &eglConfig, 1, &eglNumConfigs)) || (0==eglNumConfigs)) {
+        LOGE("eglChooseConfig() failed. [0x%x]\n", eglGetError());
+        return FALSE;
+    }
+
+    hl->eglSurface = EGL_NO_SURFACE;
+    if (FALSE == surfless) {
+        const EGLint eglPbufferAttr[] = {
+            EGL_WIDTH,  width,
+            EGL_HEIGHT, height,
+            EGL_NONE
+        };
+        hl->eglSurface = eglCreatePbufferSurface(hl->eglDisplay, eglConfig, eglPbufferAttr);
+        if (EGL_NO_SURFACE == hl->eglSurface) {
+            LOGE("eglCreatePbufferSurface() failed. [0x%x]\n", eglGetError());
+            return FALSE;
+        }
+    }
+
+    const EGLint eglContextList[] = {
+        EGL_CONTEXT_CLIENT_VERSION, 2,
+        EGL_NONE
+    };
+    hl->eglContext = eglCreateContext(hl->eglDisplay, eglConfig, EGL_NO_CONTEXT, eglContextList);
+    if (EGL_NO_CONTEXT == hl->eglContext) {
+        LOGE("eglCreateContext() failed. [0x%x]\n", eglGetError());
+        return FALSE;
+    }
+
+    if (EGL_FALSE == eglMakeCurrent(hl->eglDisplay, hl->eglSurface, hl->eglSurface, hl->eglContext)) {
+        LOGE("eglMakeCurrent() failed. [0x%x]\n", eglGetError());
+        return FALSE;
+    }
+
+    LOGI("GL_RENDERER   :%s\n", glGetString(GL_RENDERER));
+    LOGI("EGL target    :%s %ix%i\n", (TRUE==surfless) ? "surfaceless FBO" : "pbuffer", width, height);
+
+    // no window FB - render to texture
+    hl->fboID = 0;
+    hl->texID = 0;
+    if (TRUE == surfless) {
+        glGenTextures(1, &hl->texID);
+        glBindTexture(GL_TEXTURE_2D, hl->texID);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glGenFramebuffers(1, &hl->fboID);
+        glBindFramebuffer(GL_FRAMEBUFFER, hl->fboID);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, hl->texID, 0);
+        if (GL_FRAMEBUFFER_COMPLETE != glCheckFramebufferStatus(GL_FRAMEBUFFER)) {
+            LOGE("FBO incomplete\n");
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+static void     _egl_done(hlState *hl)
+{
+    if (EGL_NO_DISPLAY == hl->eglDisplay)
+        return;
+
+    if (0 != hl->fboID) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &hl->fboID);
+        glDeleteTextures(1, &hl->texID);
+        hl->fboID = 0;
+        hl->texID = 0;
+    }
+
+    eglMakeCurrent(hl->eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (EGL_NO_CONTEXT != hl->eglContext)
+        eglDestroyContext(hl->eglDisplay, hl->eglContext);
+    if (EGL_NO_SURFACE != hl->eglSurface)
+        eglDestroySurface(hl->eglDisplay, hl->eglSurface);
+    eglTerminate(hl->eglDisplay);
+
+    hl->eglDisplay = EGL_NO_DISPLAY;
+    hl->eglContext = EGL_NO_CONTEXT;
+    hl->eglSurface = EGL_NO_SURFACE;
+
+    return;
+}
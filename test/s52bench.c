@@ -0,0 +1,535 @@
+// s52bench.c: replay a script of libS52 call and report frame time in JSON - EGL without window
+//
+// Project:  OpENCview
+
+/*
+    This file is part of the OpENCview project, a viewer of ENC.
+    Copyright (C) 2000-2018 Sylvain Duclos sduclos@users.sourceforge.net
+
+    OpENCview is free software: you can redistribute it and/or modify
+    it under the terms of the Lesser GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpENCview is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Lesser GNU General Public License for more details.
+
+    You should have received a copy of the Lesser GNU General Public License
+    along with OpENCview.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Usage:
+//   $ ./s52bench -s s52bench.txt -o bench.json
+//
+// Script: one command per line ('#' comment), see s52bench.txt
+//   cell   FILE                     S52_loadCell()
+//   view   lat lon rNM north        S52_setView()
+//   pan    dlat dlon                move center of view
+//   zoom   f                        rNM *= f
+//   rot    deg                      north += deg
+//   mp     NAME|index value         S52_setMarinerParam() - NAME: S52_MAR_ stripped (ex SAFETY_CONTOUR)
+//   ownshp lat lon course speed     OWNSHP: S52_pushPosition(), S52_setVector()
+//   vessel id lat lon course speed  AIS 'id': S52_newVESSEL() on first use
+//   pick   x y                      S52_pickAt() - timed
+//   draw                            one frame: S52_draw() + S52_drawLast()
+//   last                            one frame: S52_drawLast() only
+//   loop   n ... end                repeat (no nesting)
+//
+// Frame time is wall clock up to glFinish(), phase time from S52_getFrameStats()
+// (CPU side - GL call submitted). The first -w frame are not counted.
+// GPU time (gpu*_ms) only if the driver has GL_EXT_disjoint_timer_query or
+// GL_ARB_timer_query - it land a few frame later, the last few frame have none.
+//
+// EGL: see _egl_headless.i
+
+#include "S52.h"
+
+#include <stdlib.h>        // atoi(), qsort()
+#include <string.h>        // memcpy()
+#include <stddef.h>        // offsetof()
+#include <math.h>          // ceil()
+
+#include <glib.h>
+
+#define  LOGI(...)  g_print(__VA_ARGS__)
+#define  LOGE(...)  g_printerr(__VA_ARGS__)
+
+#include "_egl_headless.i"     // _egl_init(), _egl_beg(), _egl_end(), _egl_done(), hlState
+
+#define INCH2MM  25.4
+#define NVESSEL  1024
+#define GPU_LAG  16      // look back that many frame for GPU time
+
+typedef struct benchFrame {
+    double         frame_ms;   // wall clock, S52_draw*() to glFinish()
+    S52_frameStats stats;
+} benchFrame;
+
+static hlState  _hl;
+
+static GArray  *_frames  = NULL;   // benchFrame
+static GArray  *_picks   = NULL;   // double - msec
+static guint    _nFrame  = 0;      // frame drawn, warmup included
+
+static S52ObjectHandle _ownshp = FALSE;
+static S52ObjectHandle _vessel[NVESSEL];
+
+// options
+static gchar   *_script  = NULL;   // -s
+static gchar   *_json    = NULL;   // -o
+static gint     _warmup  = 5;      // -w
+static gint     _width   = 1280;   // -W
+static gint     _height  = 1024;   // -H
+static gdouble  _dpi     = 96.0;   // -d
+static gboolean _pbuffer = FALSE;  // -b
+
+static const struct {
+    const char       *name;
+    S52MarinerParameter param;
+} _mpName[] = {
+    {"SHOW_TEXT",         S52_MAR_SHOW_TEXT         },
+    {"TWO_SHADES",        S52_MAR_TWO_SHADES        },
+    {"SAFETY_CONTOUR",    S52_MAR_SAFETY_CONTOUR    },
+    {"SAFETY_DEPTH",      S52_MAR_SAFETY_DEPTH      },
+    {"SHALLOW_CONTOUR",   S52_MAR_SHALLOW_CONTOUR   },
+    {"DEEP_CONTOUR",      S52_MAR_DEEP_CONTOUR      },
+    {"SHALLOW_PATTERN",   S52_MAR_SHALLOW_PATTERN   },
+    {"SHIPS_OUTLINE",     S52_MAR_SHIPS_OUTLINE     },
+    {"FULL_SECTORS",      S52_MAR_FULL_SECTORS      },
+    {"SYMBOLIZED_BND",    S52_MAR_SYMBOLIZED_BND    },
+    {"SYMPLIFIED_PNT",    S52_MAR_SYMPLIFIED_PNT    },
+    {"DISP_CATEGORY",     S52_MAR_DISP_CATEGORY     },
+    {"COLOR_PALETTE",     S52_MAR_COLOR_PALETTE     },
+    {"VECPER",            S52_MAR_VECPER            },
+    {"VECMRK",            S52_MAR_VECMRK            },
+    {"VECSTB",            S52_MAR_VECSTB            },
+    {"HEADNG_LINE",       S52_MAR_HEADNG_LINE       },
+    {"BEAM_BRG_NM",       S52_MAR_BEAM_BRG_NM       },
+    {"SCAMIN",            S52_MAR_SCAMIN            },
+    {"ANTIALIAS",         S52_MAR_ANTIALIAS         },
+    {"QUAPNT01",          S52_MAR_QUAPNT01          },
+    {"DISP_OVERLAP",      S52_MAR_DISP_OVERLAP      },
+    {"DISP_LAYER_LAST",   S52_MAR_DISP_LAYER_LAST   },
+    {"DISP_GRATICULE",    S52_MAR_DISP_GRATICULE    },
+    {"DISP_LEGEND",       S52_MAR_DISP_LEGEND       },
+    {"CMD_WRD_FILTER",    S52_CMD_WRD_FILTER        },
+    {"DISP_CENTROIDS",    S52_MAR_DISP_CENTROIDS    },
+    {"DISP_NODATA_LAYER", S52_MAR_DISP_NODATA_LAYER },
+    {NULL,                S52_MAR_ERROR             }
+};
+
+static int      _option(int *argc, char ***argv)
+{
+    GOptionEntry entries[] =
+    {
+        { "script",  's', 0, G_OPTION_ARG_FILENAME, &_script,  "script to replay (see s52bench.txt)",   "FILE"   },
+        { "output",  'o', 0, G_OPTION_ARG_FILENAME, &_json,    "JSON output (default stdout)",          "FILE"   },
+        { "warmup",  'w', 0, G_OPTION_ARG_INT,      &_warmup,  "frame not counted (default 5)",         "N"      },
+        { "width",   'W', 0, G_OPTION_ARG_INT,      &_width,   "image width  (default 1280)",           "PIXELS" },
+        { "height",  'H', 0, G_OPTION_ARG_INT,      &_height,  "image height (default 1024)",           "PIXELS" },
+        { "dpi",     'd', 0, G_OPTION_ARG_DOUBLE,   &_dpi,     "dot per inch (default 96)",             "DPI"    },
+        { "pbuffer", 'b', 0, G_OPTION_ARG_NONE,     &_pbuffer, "use a pbuffer, not surfaceless",        NULL     },
+        { NULL, 0, 0, 0, NULL, NULL, NULL }
+    };
+
+    GError         *error   = NULL;
+    GOptionContext *context = g_option_context_new("- replay a script of libS52 call, frame time in JSON");
+    g_option_context_add_main_entries(context, entries, NULL);
+    int ret = g_option_context_parse(context, argc, argv, &error);
+    if (FALSE == ret) {
+        LOGE("option parsing failed: %s\n", error->message);
+        g_error_free(error);
+    }
+    g_option_context_free(context);
+
+    if (NULL == _script) {
+        LOGE("need a script (-s) - see --help\n");
+        ret = FALSE;
+    }
+
+    return ret;
+}
+
+static S52MarinerParameter _getMP(const char *str)
+{
+    if (g_ascii_isdigit(*str))
+        return (S52MarinerParameter)atoi(str);
+
+    if (0 == g_ascii_strncasecmp(str, "S52_MAR_", 8))
+        str += 8;
+
+    for (int i=0; NULL!=_mpName[i].name; ++i) {
+        if (0 == g_ascii_strcasecmp(_mpName[i].name, str))
+            return _mpName[i].param;
+    }
+
+    return S52_MAR_ERROR;
+}
+
+static int      _frame(int draw)
+{
+    GTimer *timer = g_timer_new();
+
+    if (TRUE == draw)
+        S52_draw();
+    S52_drawLast();
+    glFinish();
+
+    double ms = g_timer_elapsed(timer, NULL) * 1000.0;
+    g_timer_destroy(timer);
+
+    if (++_nFrame <= (guint)_warmup)
+        return TRUE;
+
+    benchFrame f;
+    f.frame_ms = ms;
+    if (FALSE == S52_getFrameStats(0, &f.stats)) {
+        LOGE("WARNING: S52_getFrameStats() failed\n");
+        return FALSE;
+    }
+    g_array_append_val(_frames, f);
+
+    // GPU time of older frame
+    for (guint k=1; k<GPU_LAG && k<_frames->len; ++k) {
+        benchFrame    *old = &g_array_index(_frames, benchFrame, _frames->len-1-k);
+        S52_frameStats s;
+        if ((TRUE==S52_getFrameStats(k, &s)) && (s.frame==old->stats.frame) && (0.0<s.gpu_ms)) {
+            old->stats.gpu_ms = s.gpu_ms;
+            memcpy(old->stats.gpuPrio_ms, s.gpuPrio_ms, sizeof(s.gpuPrio_ms));
+            memcpy(old->stats.gpuCmd_ms,  s.gpuCmd_ms,  sizeof(s.gpuCmd_ms));
+        }
+    }
+
+    return TRUE;
+}
+
+static int      _pick(double x, double y)
+{
+    GTimer *timer = g_timer_new();
+    S52_pickAt(x, y);
+    double ms = g_timer_elapsed(timer, NULL) * 1000.0;
+    g_timer_destroy(timer);
+
+    if (_nFrame > (guint)_warmup)
+        g_array_append_val(_picks, ms);
+
+    return TRUE;
+}
+
+static int      _exec(gchar **tok, guint lineNo)
+// one command of the script
+{
+    guint  n   = g_strv_length(tok);
+    double a[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
+
+    for (guint i=1; i<n && i<=5; ++i)
+        a[i-1] = g_ascii_strtod(tok[i], NULL);
+
+    if (0 == g_strcmp0(tok[0], "cell") && 2==n) {
+        if (FALSE == S52_loadCell(tok[1], NULL))
+            LOGE("WARNING: S52_loadCell(%s) failed\n", tok[1]);
+        return TRUE;
+    }
+    if (0 == g_strcmp0(tok[0], "view") && 5==n)
+        return S52_setView(a[0], a[1], a[2], a[3]);
+    if ((0 == g_strcmp0(tok[0], "pan") && 3==n) ||
+        (0 == g_strcmp0(tok[0], "zoom") && 2==n) ||
+        (0 == g_strcmp0(tok[0], "rot") && 2==n)) {
+        double cLat, cLon, rNM, north;
+        if (FALSE == S52_getView(&cLat, &cLon, &rNM, &north))
+            return FALSE;
+        switch (*tok[0]) {
+            case 'p': cLat += a[0]; cLon += a[1];                 break;
+            case 'z': rNM  *= a[0];                               break;
+            case 'r': north = fmod(north + a[0] + 360.0, 360.0);  break;
+        }
+        return S52_setView(cLat, cLon, rNM, north);
+    }
+    if (0 == g_strcmp0(tok[0], "mp") && 3==n) {
+        S52MarinerParameter mp = _getMP(tok[1]);
+        if (S52_MAR_ERROR == mp) {
+            LOGE("WARNING: line %u: unknown Mariner param '%s'\n", lineNo, tok[1]);
+            return FALSE;
+        }
+        return S52_setMarinerParam(mp, g_ascii_strtod(tok[2], NULL));
+    }
+    if (0 == g_strcmp0(tok[0], "ownshp") && 5==n) {
+        if (FALSE == _ownshp)
+            _ownshp = S52_newOWNSHP("OWNSHP");
+        S52_pushPosition(_ownshp, a[0], a[1], a[2]);
+        S52_setVector(_ownshp, 0, a[2], a[3]);
+        return TRUE;
+    }
+    if (0 == g_strcmp0(tok[0], "vessel") && 6==n) {
+        guint id = (guint)atoi(tok[1]);
+        if (id >= NVESSEL) {
+            LOGE("WARNING: line %u: vessel id %u >= %i\n", lineNo, id, NVESSEL);
+            return FALSE;
+        }
+        if (FALSE == _vessel[id]) {
+            gchar *label = g_strdup_printf("AIS%04u", id);
+            _vessel[id]  = S52_newVESSEL(2, label);
+            g_free(label);
+        }
+        S52_pushPosition(_vessel[id], a[1], a[2], a[3]);
+        S52_setVector(_vessel[id], 1, a[3], a[4]);
+        return TRUE;
+    }
+    if (0 == g_strcmp0(tok[0], "pick") && 3==n)
+        return _pick(a[0], a[1]);
+    if (0 == g_strcmp0(tok[0], "draw") && 1==n)
+        return _frame(TRUE);
+    if (0 == g_strcmp0(tok[0], "last") && 1==n)
+        return _frame(FALSE);
+
+    LOGE("WARNING: line %u: bad command '%s' (%u arg)\n", lineNo, tok[0], n-1);
+
+    return FALSE;
+}
+
+static int      _replay(const char *fname)
+{
+    gchar *txt = NULL;
+    if (FALSE == g_file_get_contents(fname, &txt, NULL, NULL)) {
+        LOGE("can't read script %s\n", fname);
+        return FALSE;
+    }
+
+    gchar **lines  = g_strsplit(txt, "\n", 0);
+    guint   nErr   = 0;
+    guint   loopBeg = 0;   // first line in loop
+    gint    loopN   = 0;   // loop left
+
+    for (guint i=0; NULL!=lines[i]; ++i) {
+        gchar *l = g_strstrip(lines[i]);
+        if (('\0'==*l) || ('#'==*l))
+            continue;
+
+        gchar **tok = g_strsplit_set(l, " \t", 0);
+        // remove empty token (many blank between word)
+        guint j = 0;
+        for (guint k=0; NULL!=tok[k]; ++k) {
+            if ('\0' == *tok[k])
+                g_free(tok[k]);
+            else
+                tok[j++] = tok[k];
+        }
+        tok[j] = NULL;
+
+        if (0 == g_strcmp0(tok[0], "loop")) {
+            if (0 != loopN)
+                LOGE("WARNING: line %u: nested loop ignored\n", i+1);
+            else {
+                loopN   = (NULL==tok[1]) ? 1 : atoi(tok[1]);
+                loopBeg = i + 1;
+            }
+        } else
+            if (0 == g_strcmp0(tok[0], "end")) {
+                if (0 < --loopN)
+                    i = loopBeg - 1;   // ++i
+                else
+                    loopN = 0;
+            } else {
+                if (FALSE == _exec(tok, i+1))
+                    ++nErr;
+            }
+
+        g_strfreev(tok);
+    }
+
+    g_strfreev(lines);
+    g_free(txt);
+
+    return (0 == nErr);
+}
+
+static int      _cmpDouble(const void *a, const void *b)
+{
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+
+    return (da < db) ? -1 : (da > db) ? 1 : 0;
+}
+
+static double   _pc(GArray *v, double pc)
+// nearest-rank percentile of sorted 'v'
+{
+    guint r = (guint)ceil(pc / 100.0 * v->len);
+
+    return g_array_index(v, double, (0==r) ? 0 : r-1);
+}
+
+static void     _jsonVal(GString *json, const char *name, GArray *v, int last)
+// sort 'v' then output "name": {n, mean, p50, p95, p99, max}
+{
+    double sum = 0.0;
+
+    for (guint i=0; i<v->len; ++i)
+        sum += g_array_index(v, double, i);
+
+    g_string_append_printf(json, "    \"%s\": {\"n\": %u", name, v->len);
+    if (0 < v->len) {
+        qsort(v->data, v->len, sizeof(double), _cmpDouble);
+        g_string_append_printf(json, ", \"mean\": %.3f, \"p50\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f",
+                               sum/v->len, _pc(v, 50.0), _pc(v, 95.0), _pc(v, 99.0), g_array_index(v, double, v->len-1));
+    }
+    g_string_append_printf(json, "}%s\n", (TRUE==last) ? "" : ",");
+}
+
+// offset in S52_frameStats of each phase, -1: frame_ms
+#define STATS_OFF(m) ((int)offsetof(S52_frameStats, m))
+
+static GArray  *_getVal(int off, int isUInt, int inDraw, int inLast, int inGPU)
+// one value of all frame - only frame with S52_draw() if 'inDraw', with S52_drawLast() if 'inLast',
+// with GPU time if 'inGPU'
+{
+    GArray *v = g_array_new(FALSE, FALSE, sizeof(double));
+
+    for (guint i=0; i<_frames->len; ++i) {
+        benchFrame *f = &g_array_index(_frames, benchFrame, i);
+        if ((TRUE==inDraw) && (0.0==f->stats.draw_ms)) continue;
+        if ((TRUE==inLast) && (0.0==f->stats.last_ms)) continue;
+        if ((TRUE==inGPU)  && (0.0==f->stats.gpu_ms))  continue;
+
+        double d = f->frame_ms;
+        if (0 <= off) {
+            char *p = (char *)&f->stats + off;
+            d = (TRUE==isUInt) ? (double)*(unsigned int*)p : *(double*)p;
+        }
+        g_array_append_val(v, d);
+    }
+
+    return v;
+}
+
+static GString *_report(void)
+{
+    static const struct {
+        const char *name;
+        int         off;
+        int         isUInt;
+        int         inDraw;
+        int         inLast;
+    } val[] = {
+        {"frame_ms",      -1,                        FALSE, FALSE, FALSE},
+        {"draw_ms",       STATS_OFF(draw_ms),        FALSE, TRUE,  FALSE},
+        {"app_ms",        STATS_OFF(app_ms),         FALSE, TRUE,  FALSE},
+        {"cull_ms",       STATS_OFF(cull_ms),        FALSE, TRUE,  FALSE},
+        {"cullLights_ms", STATS_OFF(cullLights_ms),  FALSE, TRUE,  FALSE},
+        {"text_ms",       STATS_OFF(text_ms),        FALSE, TRUE,  FALSE},
+        {"grat_ms",       STATS_OFF(grat_ms),        FALSE, TRUE,  FALSE},
+        {"legend_ms",     STATS_OFF(legend_ms),      FALSE, TRUE,  FALSE},
+        {"glend_ms",      STATS_OFF(glend_ms),       FALSE, FALSE, FALSE},
+        {"last_ms",       STATS_OFF(last_ms),        FALSE, FALSE, TRUE },
+        {"nObjTotal",     STATS_OFF(nObjTotal),      TRUE,  FALSE, FALSE},
+        {"nCullSupp",     STATS_OFF(nCullSupp),      TRUE,  FALSE, FALSE},
+        {"nCullScamin",   STATS_OFF(nCullScamin),    TRUE,  FALSE, FALSE},
+        {"nCullView",     STATS_OFF(nCullView),      TRUE,  FALSE, FALSE},
+        {"nObjDraw",      STATS_OFF(nObjDraw),       TRUE,  FALSE, FALSE},
+        {"nCmd",          STATS_OFF(nCmd),           TRUE,  FALSE, FALSE},
+        {"nDrawCall",     STATS_OFF(nDrawCall),      TRUE,  FALSE, FALSE},
+        {"nVertex",       STATS_OFF(nVertex),        TRUE,  FALSE, FALSE},
+        {"nVBO",          STATS_OFF(nVBO),           TRUE,  FALSE, FALSE},
+        {"nTexUpload",    STATS_OFF(nTexUpload),     TRUE,  FALSE, FALSE},
+    };
+
+    GString *json = g_string_new("{\n");
+    g_string_append_printf(json, "    \"script\": \"%s\",\n", _script);
+    g_string_append_printf(json, "    \"width\": %i, \"height\": %i, \"warmup\": %i,\n", _width, _height, _warmup);
+    g_string_append_printf(json, "    \"renderer\": \"%s\",\n", (const char*)glGetString(GL_RENDERER));
+
+    for (guint i=0; i<G_N_ELEMENTS(val); ++i) {
+        GArray *v = _getVal(val[i].off, val[i].isUInt, val[i].inDraw, val[i].inLast, FALSE);
+        _jsonVal(json, val[i].name, v, FALSE);
+        g_array_free(v, TRUE);
+    }
+
+    // layer 0-8 in S52_draw(), 9 in S52_drawLast()
+    for (int prio=0; prio<S52_STATS_NPRIO; ++prio) {
+        gchar  *name = g_strdup_printf("prio%i_ms", prio);
+        int     off  = STATS_OFF(prio_ms) + prio*(int)sizeof(double);
+        GArray *v    = _getVal(off, FALSE, (S52_STATS_NPRIO-1)!=prio, (S52_STATS_NPRIO-1)==prio, FALSE);
+        _jsonVal(json, name, v, FALSE);
+        g_array_free(v, TRUE);
+        g_free(name);
+    }
+
+    // GPU time - by command word then by display priority
+    static const char *cmdName[S52_STATS_NCMD] = {"AC", "AP", "LS", "LC", "SY", "TX", "other"};
+    GArray *gpu = _getVal(STATS_OFF(gpu_ms), FALSE, FALSE, FALSE, TRUE);
+    _jsonVal(json, "gpu_ms", gpu, FALSE);
+    g_array_free(gpu, TRUE);
+    for (int cmd=0; cmd<S52_STATS_NCMD; ++cmd) {
+        gchar  *name = g_strdup_printf("gpu%s_ms", cmdName[cmd]);
+        GArray *v    = _getVal(STATS_OFF(gpuCmd_ms) + cmd*(int)sizeof(double), FALSE, FALSE, FALSE, TRUE);
+        _jsonVal(json, name, v, FALSE);
+        g_array_free(v, TRUE);
+        g_free(name);
+    }
+    for (int prio=0; prio<S52_STATS_NPRIO; ++prio) {
+        gchar  *name = g_strdup_printf("gpuPrio%i_ms", prio);
+        GArray *v    = _getVal(STATS_OFF(gpuPrio_ms) + prio*(int)sizeof(double), FALSE, FALSE, FALSE, TRUE);
+        _jsonVal(json, name, v, FALSE);
+        g_array_free(v, TRUE);
+        g_free(name);
+    }
+
+    _jsonVal(json, "pick_ms", _picks, TRUE);
+    g_string_append(json, "}\n");
+
+    return json;
+}
+
+int main(int argc, char *argv[])
+{
+    if (FALSE == _option(&argc, &argv))
+        return 1;
+
+    if (FALSE == _egl_init(&_hl, _width, _height, _pbuffer)) {
+        _egl_done(&_hl);
+        return 1;
+    }
+
+    int wmm = (int)(_width  / _dpi * INCH2MM);
+    int hmm = (int)(_height / _dpi * INCH2MM);
+    if (FALSE == S52_init(_width, _height, wmm, hmm, NULL)) {
+        LOGE("S52_init(%i,%i,%i,%i) failed\n", _width, _height, wmm, hmm);
+        _egl_done(&_hl);
+        return 1;
+    }
+    S52_setViewPort(0, 0, _width, _height);
+
+    S52_setEGLCallBack((S52_EGL_cb)_egl_beg, (S52_EGL_cb)_egl_end, &_hl);
+    if (0 != _hl.fboID)
+        S52_setFBO(_hl.fboID);
+
+    _frames = g_array_new(FALSE, FALSE, sizeof(benchFrame));
+    _picks  = g_array_new(FALSE, FALSE, sizeof(double));
+
+    int ret = _replay(_script);
+    if (FALSE == ret)
+        LOGE("WARNING: error in script %s\n", _script);
+
+    GString *json = _report();
+    if (NULL == _json) {
+        LOGI("%s", json->str);
+    } else {
+        if (FALSE == g_file_set_contents(_json, json->str, json->len, NULL)) {
+            LOGE("can't write %s\n", _json);
+            ret = FALSE;
+        }
+    }
+    LOGI("%u frame (%i warmup), %u pick\n", _nFrame, _warmup, _picks->len);
+
+    g_string_free(json, TRUE);
+    g_array_free(_picks,  TRUE);
+    g_array_free(_frames, TRUE);
+
+    S52_done();
+
+    _egl_done(&_hl);
+
+    return (TRUE == ret) ? 0 : 1;
+}
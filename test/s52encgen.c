@@ -0,0 +1,942 @@
+// s52encgen.c: synthetic S-57 ENC generator (ISO 8211) for scale testing - no dependency (C99, libm)
+//
+// Project:  OpENCview
+
+/*
+    This file is part of the OpENCview project, a viewer of ENC.
+    Copyright (C) 2000-2018 Sylvain Duclos sduclos@users.sourceforge.net
+
+    OpENCview is free software: you can redistribute it and/or modify
+    it under the terms of the Lesser GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpENCview is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Lesser GNU General Public License for more details.
+
+    You should have received a copy of the Lesser GNU General Public License
+    along with OpENCview.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Usage:
+//   $ ./s52encgen -n 100000 -o /tmp/enc
+//   $ ./s52encgen -n 10000000 -c 64 -o /tmp/enc
+//   $ ./s52headless -C /tmp/enc/cells.txt -v 45.25,-64.25,2.0,0.0
+//
+// Write S-57 ed 3.1 base cell (chain-node topology) read by GDAL/OGR like any ENC,
+// so S52_loadCell() time the real path (OGR, S52_loadObject(), CS, cull, render).
+// Object count is OGR feature count (SOUNDG split by SPLIT_MULTIPOINT).
+//
+// Each cell is a grid of block, each block is:
+//  - grid edges shared by the DEPARE of the 4 neighbour block (and M_COVR at the cell edge)
+//  - K nested ring (closed edge): DEPARE annulus between ring, DEPCNT on ring,
+//    the inner ring is COALNE and the exterior of LNDARE (with a sector light)
+//  - SOUNDG (S per annulus), OBSTRN, and BOYLAT + LIGHTS + TOPMAR on the same
+//    isolated node (buoy is master of light and topmark via FFPT)
+//
+// Output: <outdir>/ZZ<intu>S<NNNN>.000 and <outdir>/cells.txt (see s52headless -C)
+// Same option + seed give the same byte.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdarg.h>        // va_list
+#include <stdlib.h>        // atoi(), strtod()
+#include <string.h>        // memcpy()
+#include <stdint.h>        // uint64_t
+#include <math.h>          // sin(), cos(), ceil(), sqrt()
+#include <unistd.h>        // getopt()
+#include <errno.h>
+#include <sys/stat.h>      // mkdir()
+
+#define UT      0x1f       // unit terminator
+#define FT      0x1e       // field terminator
+#define COMF    10000000.0 // coordinate multiplication factor
+#define SOMF    10.0       // 3-D (sounding) multiplication factor
+#define AGEN    550        // producing agency
+#define MAXREC  99999      // 5 digit record length
+#define MAXFLD  16         // field per record (DDR: 14)
+#define MAXRING 16
+
+#ifndef M_PI
+#define M_PI    3.14159265358979323846
+#endif
+
+// RCNM
+#define RCNM_DS  10
+#define RCNM_DP  20
+#define RCNM_FE 100
+#define RCNM_VI 110
+#define RCNM_VC 120
+#define RCNM_VE 130
+
+// OBJL
+#define BOYLAT   17
+#define COALNE   30
+#define DEPARE   42
+#define DEPCNT   43
+#define LNDARE   71
+#define LIGHTS   75
+#define OBSTRN   86
+#define SOUNDG  129
+#define TOPMAR  144
+#define M_COVR  302
+
+// ATTL
+#define BOYSHP    4
+#define CATCOV   18
+#define CATLAM   36
+#define CATOBS   42
+#define COLOUR   75
+#define DRVAL1   87
+#define DRVAL2   88
+#define LITCHR  107
+#define OBJNAM  116
+#define SCAMIN  133
+#define SECTR1  136
+#define SECTR2  137
+#define SIGGRP  141
+#define SIGPER  142
+#define TOPSHP  171
+#define VALDCO  174
+#define VALNMR  178
+#define VALSOU  179
+#define WATLEV  187
+
+typedef enum genPass {
+    PASS_VI,               // isolated node
+    PASS_VC,               // connected node
+    PASS_VE,               // edge
+    PASS_FE                // feature
+} genPass;
+
+typedef struct genRec {
+    unsigned char buf[MAXREC];   // field area
+    size_t        len;
+    int           nFld;
+    char          tag[MAXFLD][5];
+    size_t        pos[MAXFLD];
+    int           err;           // TRUE: record too long
+} genRec;
+
+typedef struct genRing {
+    double r;                    // base radius (deg)
+    double f1, f2, p1, p2;       // noise: freq / phase
+} genRing;
+
+typedef struct genCell {
+    FILE   *fd;
+    int     G;                   // block per side
+    double  lat0, lon0, bs;      // SW corner, block size (deg)
+    unsigned int recNo;          // 0001 (wrap at 65535, not read by OGR)
+    unsigned int fidn;           // FRID:RCID / FOID:FIDN
+    int     cellNo;
+} genCell;
+
+// options
+static long    _nObj    = 10000;   // -n
+static int     _nCell   = 1;       // -c
+static int     _K       = 4;       // -k
+static int     _S       = 8;       // -s
+static int     _B       = 2;       // -b
+static int     _O       = 2;       // -x
+static int     _P       = 32;      // -p
+static double  _lat     = 45.0;    // -l
+static double  _lon     = -64.5;   // -L
+static double  _deg     = 0.5;     // -d
+static int     _cscl    = 22000;   // -S
+static int     _intu    = 5;       // -i
+static unsigned int _seed = 1;     // -r
+static const char  *_outdir = "."; // -o
+
+static genRec  _rec;
+
+static const struct {
+    const char *tag, *ctrl, *name, *descr, *fmt;
+} _ddr[] = {
+    {"0000", "0000;&   ", "",
+     "0001DSIDDSIDDSSI0001DSPM0001VRIDVRIDVRPTVRIDSG2DVRIDSG3D0001FRIDFRIDFOIDFRIDATTFFRIDFFPTFRIDFSPT", ""},
+    {"0001", "0100;&   ", "ISO 8211 Record Identifier", "", "(b12)"},
+    {"DSID", "1600;&   ", "Data set identification field",
+     "RCNM!RCID!EXPP!INTU!DSNM!EDTN!UPDN!UADT!ISDT!STED!PRSP!PSDN!PRED!PROF!AGEN!COMT",
+     "(b11,b14,b11,b11,A,A,A,A(8),A(8),R(4),b11,A,A,b11,b12,A)"},
+    {"DSSI", "1600;&   ", "Data set structure information field",
+     "DSTR!AALL!NALL!NOMR!NOCR!NOGR!NOLR!NOIN!NOCN!NOED!NOFA",
+     "(b11,b11,b11,b14,b14,b14,b14,b14,b14,b14,b14)"},
+    {"DSPM", "1600;&   ", "Data set parameter field",
+     "RCNM!RCID!HDAT!VDAT!SDAT!CSCL!DUNI!HUNI!PUNI!COUN!COMF!SOMF!COMT",
+     "(b11,b14,b11,b11,b11,b14,b11,b11,b11,b11,b14,b14,A)"},
+    {"VRID", "1600;&   ", "Vector record identifier field", "RCNM!RCID!RVER!RUIN", "(b11,b14,b12,b11)"},
+    {"VRPT", "2600;&   ", "Vector record pointer field", "*NAME!ORNT!USAG!TOPI!MASK", "(B(40),b11,b11,b11,b11)"},
+    {"SG2D", "2500;&   ", "2-D coordinate field", "*YCOO!XCOO", "(b24,b24)"},
+    {"SG3D", "2500;&   ", "3-D coordinate (sounding array) field", "*YCOO!XCOO!VE3D", "(b24,b24,b24)"},
+    {"FRID", "1600;&   ", "Feature record identifier field",
+     "RCNM!RCID!PRIM!GRUP!OBJL!RVER!RUIN", "(b11,b14,b11,b11,b12,b12,b11)"},
+    {"FOID", "1600;&   ", "Feature object identifier field", "AGEN!FIDN!FIDS", "(b12,b14,b12)"},
+    {"ATTF", "2600;&   ", "Feature record attribute field", "*ATTL!ATVL", "(b12,A)"},
+    {"FFPT", "2600;&   ", "Feature record to feature object pointer field", "*LNAM!RIND!COMT", "(B(64),b11,A)"},
+    {"FSPT", "2600;&   ", "Feature record to spatial record pointer field", "*NAME!ORNT!USAG!MASK", "(B(40),b11,b11,b11)"},
+};
+
+/////////////////////////////////////////////////
+// ISO 8211 record
+//
+
+static void     _put(const void *data, size_t n)
+{
+    if (_rec.len + n > MAXREC) {
+        _rec.err = 1;
+        return;
+    }
+    memcpy(_rec.buf + _rec.len, data, n);
+    _rec.len += n;
+}
+
+static void     _uint(unsigned int v, int n)
+// binary little endian
+{
+    unsigned char b[4];
+    for (int i=0; i<n; ++i)
+        b[i] = (unsigned char)(v >> (8*i));
+    _put(b, n);
+}
+
+#define _b11(v) _uint((unsigned int)(v), 1)
+#define _b12(v) _uint((unsigned int)(v), 2)
+#define _b14(v) _uint((unsigned int)(v), 4)
+#define _b24(v) _uint((unsigned int)(int)(v), 4)
+
+static void     _A(const char *str)
+{
+    unsigned char ut = UT;
+    _put(str, strlen(str));
+    _put(&ut, 1);
+}
+
+static void     _Afix(const char *str, size_t n)
+{
+    _put(str, n);
+}
+
+static void     _name(int rcnm, unsigned int rcid)
+// B(40)
+{
+    _b11(rcnm);
+    _b14(rcid);
+}
+
+static void     _fld(const char *tag)
+// start a field - terminate the previous one
+{
+    unsigned char ft = FT;
+    if (0 < _rec.nFld)
+        _put(&ft, 1);
+
+    memcpy(_rec.tag[_rec.nFld], tag, 5);
+    _rec.pos[_rec.nFld] = _rec.len;
+    ++_rec.nFld;
+}
+
+static void     _recBeg(genCell *cell)
+{
+    _rec.len  = 0;
+    _rec.nFld = 0;
+    _rec.err  = 0;
+
+    if (NULL != cell) {
+        _fld("0001");
+        _b12(++cell->recNo);
+    }
+}
+
+static int      _ndigit(size_t v)
+{
+    int n = 1;
+    while (v >= 10) {
+        v /= 10;
+        ++n;
+    }
+    return n;
+}
+
+static int      _recEnd(FILE *fd, int ddr)
+{
+    unsigned char ft = FT;
+    _put(&ft, 1);
+
+    size_t maxLen = 0;
+    for (int i=0; i<_rec.nFld; ++i) {
+        size_t end = (i+1 < _rec.nFld) ? _rec.pos[i+1] : _rec.len;
+        if (end - _rec.pos[i] > maxLen)
+            maxLen = end - _rec.pos[i];
+    }
+
+    int    sLen = (1 == ddr) ? 3 : _ndigit(maxLen);
+    int    sPos = (1 == ddr) ? 4 : _ndigit(_rec.len);
+    size_t base = 24 + _rec.nFld*(sLen + sPos + 4) + 1;
+    size_t len  = base + _rec.len;
+
+    if ((1==_rec.err) || (MAXREC<len)) {
+        static int once = 0;
+        if (0 == once++)
+            fprintf(stderr, "ERROR: record longer than %i byte (lower -p, -s or raise -c)\n", MAXREC);
+        return 0;
+    }
+
+    if (1 == ddr)
+        fprintf(fd, "%05u3LE1 09%05u ! %i%i0%i", (unsigned)len, (unsigned)base, sLen, sPos, 4);
+    else
+        fprintf(fd, "%05u D     %05u   %i%i0%i", (unsigned)len, (unsigned)base, sLen, sPos, 4);
+
+    for (int i=0; i<_rec.nFld; ++i) {
+        size_t end = (i+1 < _rec.nFld) ? _rec.pos[i+1] : _rec.len;
+        fprintf(fd, "%s%0*u%0*u", _rec.tag[i], sLen, (unsigned)(end - _rec.pos[i]), sPos, (unsigned)_rec.pos[i]);
+    }
+    fputc(FT, fd);
+    fwrite(_rec.buf, 1, _rec.len, fd);
+
+    return 1;
+}
+
+static int      _writeDDR(FILE *fd)
+{
+    _recBeg(NULL);
+    for (size_t i=0; i<sizeof(_ddr)/sizeof(_ddr[0]); ++i) {
+        _fld(_ddr[i].tag);
+        _Afix(_ddr[i].ctrl, 9);
+        _Afix(_ddr[i].name, strlen(_ddr[i].name));
+        _Afix("\x1f", 1);
+        _Afix(_ddr[i].descr, strlen(_ddr[i].descr));
+        if ('\0' != *_ddr[i].fmt) {
+            _Afix("\x1f", 1);
+            _Afix(_ddr[i].fmt, strlen(_ddr[i].fmt));
+        }
+    }
+
+    return _recEnd(fd, 1);
+}
+
+/////////////////////////////////////////////////
+// random - xorshift64*, seeded per block so that each pass draw the same
+//
+
+static uint64_t _rndSeed(unsigned int a, unsigned int b, unsigned int c)
+{
+    // splitmix64
+    uint64_t z = ((uint64_t)_seed << 40) ^ ((uint64_t)a << 32) ^ ((uint64_t)b << 16) ^ c;
+    z += 0x9E3779B97F4A7C15ULL;
+    z  = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z  = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= (z >> 31);
+
+    return (0 == z) ? 1 : z;
+}
+
+static double   _rnd(uint64_t *s)
+// [0, 1)
+{
+    *s ^= *s >> 12;
+    *s ^= *s << 25;
+    *s ^= *s >> 27;
+
+    return (double)((*s * 0x2545F4914F6CDD1DULL) >> 11) / 9007199254740992.0;
+}
+
+/////////////////////////////////////////////////
+// record
+//
+
+static int      _vecRec(genCell *cell, int rcnm, unsigned int rcid)
+{
+    _recBeg(cell);
+    _fld("VRID");
+    _b11(rcnm);
+    _b14(rcid);
+    _b12(1);              // RVER
+    _b11(1);              // RUIN: insert
+
+    return 1;
+}
+
+static void     _coord(double lat, double lon)
+{
+    _b24(lround(lat * COMF));
+    _b24(lround(lon * COMF));
+}
+
+static int      _feaRec(genCell *cell, int prim, int grup, int objl)
+{
+    ++cell->fidn;
+
+    _recBeg(cell);
+    _fld("FRID");
+    _b11(RCNM_FE);
+    _b14(cell->fidn);
+    _b11(prim);
+    _b11(grup);
+    _b12(objl);
+    _b12(1);              // RVER
+    _b11(1);              // RUIN: insert
+    _fld("FOID");
+    _b12(AGEN);
+    _b14(cell->fidn);
+    _b12(1);              // FIDS
+
+    return 1;
+}
+
+static void     _att(int attl, const char *fmt, ...)
+{
+    char    str[64];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(str, sizeof(str), fmt, ap);
+    va_end(ap);
+
+    _b12(attl);
+    _A(str);
+}
+
+static void     _fspt(int rcnm, unsigned int rcid, int ornt, int usag)
+{
+    _name(rcnm, rcid);
+    _b11(ornt);
+    _b11(usag);
+    _b11(255);            // MASK
+}
+
+/////////////////////////////////////////////////
+// topology - RCID of vector in a cell
+//
+
+#define NISO (_K + _B + 1 + _O)   // isolated node per block: SOUNDG per annulus, buoy, sector light, OBSTRN
+
+static unsigned int _gridVC(genCell *c, int i, int j) { return 1 + j*(c->G+1) + i;                          }
+static unsigned int _ringVC(genCell *c, int b, int k) { return 1 + (c->G+1)*(c->G+1) + b*_K + k;            }
+static unsigned int _hVE   (genCell *c, int i, int j) { return 1 + j*c->G + i;                              }
+static unsigned int _vVE   (genCell *c, int i, int j) { return 1 + c->G*(c->G+1) + j*(c->G+1) + i;          }
+static unsigned int _ringVE(genCell *c, int b, int k) { return 1 + 2*c->G*(c->G+1) + b*_K + k;              }
+static unsigned int _VI    (genCell *c, int b, int n) { (void)c; return 1 + b*NISO + n;                     }
+
+static double   _ringR(genRing *r, double spacing, double a)
+// radius of ring at angle 'a' - noise < 0.3 spacing so ring never cross
+{
+    return r->r + spacing * (0.2*sin(r->f1*a + r->p1) + 0.1*sin(r->f2*a + r->p2));
+}
+
+static int      _gridNode(genCell *c, int i, int j, double *lat, double *lon)
+{
+    *lat = c->lat0 + j*c->bs;
+    *lon = c->lon0 + i*c->bs;
+
+    return 1;
+}
+
+static int      _gridEdge(genCell *c, int i, int j, int vert)
+// edge from node (i,j) to (i+1,j) or (i,j+1) if 'vert' - wiggle inside the cell
+{
+    double   lat0, lon0, lat1, lon1;
+    int      np    = _P / 8;
+    int      edge  = (1==vert) ? (0==i || c->G==i) : (0==j || c->G==j);
+    uint64_t s     = _rndSeed(c->cellNo, (unsigned)(j*(c->G+1)+i), 0x8000 | vert);
+
+    _gridNode(c, i, j, &lat0, &lon0);
+    if (1 == vert) _gridNode(c, i, j+1, &lat1, &lon1);
+    else           _gridNode(c, i+1, j, &lat1, &lon1);
+
+    _vecRec(c, RCNM_VE, (1==vert) ? _vVE(c, i, j) : _hVE(c, i, j));
+    _fld("VRPT");
+    _name(RCNM_VC, _gridVC(c, i, j));
+    _b11(255); _b11(255); _b11(1); _b11(255);    // ORNT, USAG, TOPI: begin, MASK
+    _name(RCNM_VC, (1==vert) ? _gridVC(c, i, j+1) : _gridVC(c, i+1, j));
+    _b11(255); _b11(255); _b11(2); _b11(255);    // TOPI: end
+
+    if (0 < np) {
+        _fld("SG2D");
+        for (int p=1; p<=np; ++p) {
+            double t = (double)p / (np+1);
+            double w = (1==edge) ? 0.0 : 0.05 * c->bs * sin(M_PI*t) * (2.0*_rnd(&s) - 1.0);
+            if (1 == vert) _coord(lat0 + t*(lat1-lat0), lon0 + w);
+            else           _coord(lat0 + w, lon0 + t*(lon1-lon0));
+        }
+    }
+
+    return _recEnd(c->fd, 0);
+}
+
+static int      _block(genCell *c, int i, int j, genPass pass)
+// vector or feature of block (i,j) - same draw in each pass
+{
+    int      b       = j*c->G + i;
+    uint64_t s       = _rndSeed(c->cellNo, (unsigned)b, 0);
+    double   half    = c->bs / 2.0;
+    double   cLat    = c->lat0 + j*c->bs + half;
+    double   cLon    = c->lon0 + i*c->bs + half;
+    double   spacing = 0.6 * half / _K;
+    double   dstep   = 5.0;                          // contour interval (m)
+    genRing  ring[MAXRING];
+    int      ok      = 1;
+
+    for (int k=0; k<_K; ++k) {
+        ring[k].r  = half * (0.75 - 0.6*k/_K);
+        ring[k].f1 = 2 + (int)(4*_rnd(&s));
+        ring[k].f2 = 5 + (int)(4*_rnd(&s));
+        ring[k].p1 = 2*M_PI*_rnd(&s);
+        ring[k].p2 = 2*M_PI*_rnd(&s);
+    }
+
+#define VALCNT(k)  (dstep * (_K-1-(k)))                                  // contour of ring k, coast is 0
+#define DRMAX(k)  ((0==(k)) ? VALCNT(0)+dstep : VALCNT((k)-1))          // annulus k: outside ring k
+
+    // ring: connected node + closed edge
+    for (int k=0; k<_K; ++k) {
+        if (PASS_VC == pass) {
+            _vecRec(c, RCNM_VC, _ringVC(c, b, k));
+            _fld("SG2D");
+            _coord(cLat, cLon + _ringR(&ring[k], spacing, 0.0));
+            ok &= _recEnd(c->fd, 0);
+        }
+        if (PASS_VE == pass) {
+            _vecRec(c, RCNM_VE, _ringVE(c, b, k));
+            _fld("VRPT");
+            _name(RCNM_VC, _ringVC(c, b, k));
+            _b11(255); _b11(255); _b11(1); _b11(255);
+            _name(RCNM_VC, _ringVC(c, b, k));
+            _b11(255); _b11(255); _b11(2); _b11(255);
+            _fld("SG2D");
+            for (int p=1; p<_P; ++p) {
+                double a = -2.0*M_PI*p/_P;           // clockwise
+                double r = _ringR(&ring[k], spacing, a);
+                _coord(cLat + r*sin(a), cLon + r*cos(a));
+            }
+            ok &= _recEnd(c->fd, 0);
+        }
+    }
+
+    // SOUNDG - one multipoint per annulus
+    for (int k=0; k<_K; ++k) {
+        if (PASS_VI == pass) {
+            _vecRec(c, RCNM_VI, _VI(c, b, k));
+            _fld("SG3D");
+        }
+        for (int n=0; n<_S; ++n) {
+            double a    = 2.0*M_PI*_rnd(&s);
+            double rIn  = _ringR(&ring[k], spacing, a);
+            double rOut = (0 == k) ? 0.88*half : _ringR(&ring[k-1], spacing, a);
+            double r    = rIn + (rOut - rIn) * (0.15 + 0.7*_rnd(&s));
+            double d    = VALCNT(k) + (DRMAX(k) - VALCNT(k)) * (0.1 + 0.8*_rnd(&s));
+            if (PASS_VI == pass) {
+                _coord(cLat + r*sin(a), cLon + r*cos(a));
+                _b24(lround(d * SOMF));
+            }
+        }
+        if (PASS_VI == pass)
+            ok &= _recEnd(c->fd, 0);
+    }
+
+    // buoy - outer annulus
+    for (int n=0; n<_B; ++n) {
+        double a    = 2.0*M_PI*_rnd(&s);
+        double rIn  = _ringR(&ring[0], spacing, a);
+        double r    = rIn + (0.88*half - rIn) * (0.2 + 0.6*_rnd(&s));
+        if (PASS_VI == pass) {
+            _vecRec(c, RCNM_VI, _VI(c, b, _K + n));
+            _fld("SG2D");
+            _coord(cLat + r*sin(a), cLon + r*cos(a));
+            ok &= _recEnd(c->fd, 0);
+        }
+    }
+
+    // sector light - center of island
+    double sector = 360.0*_rnd(&s);
+    if (PASS_VI == pass) {
+        _vecRec(c, RCNM_VI, _VI(c, b, _K + _B));
+        _fld("SG2D");
+        _coord(cLat, cLon);
+        ok &= _recEnd(c->fd, 0);
+    }
+
+    // OBSTRN - annulus 0..K-2
+    double obsD[64];
+    for (int n=0; n<_O; ++n) {
+        int    k    = (int)((_K-1) * _rnd(&s));
+        double a    = 2.0*M_PI*_rnd(&s);
+        double rIn  = _ringR(&ring[k], spacing, a);
+        double rOut = (0 == k) ? 0.88*half : _ringR(&ring[k-1], spacing, a);
+        double r    = rIn + (rOut - rIn) * (0.2 + 0.6*_rnd(&s));
+        obsD[n] = VALCNT(k) * 0.8 * _rnd(&s);
+        if (PASS_VI == pass) {
+            _vecRec(c, RCNM_VI, _VI(c, b, _K + _B + 1 + n));
+            _fld("SG2D");
+            _coord(cLat + r*sin(a), cLon + r*cos(a));
+            ok &= _recEnd(c->fd, 0);
+        }
+    }
+
+    if (PASS_FE != pass)
+        return ok;
+
+    /////////////////////////////////////
+    // feature
+    //
+
+    // DEPARE
+    for (int k=0; k<_K; ++k) {
+        _feaRec(c, 3, 1, DEPARE);
+        _fld("ATTF");
+        _att(DRVAL1, "%.1f", VALCNT(k));
+        _att(DRVAL2, "%.1f", DRMAX(k));
+        _fld("FSPT");
+        if (0 == k) {
+            // clockwise: W up, N right, E down, S left
+            _fspt(RCNM_VE, _vVE(c, i,   j  ), 1, 1);
+            _fspt(RCNM_VE, _hVE(c, i,   j+1), 1, 1);
+            _fspt(RCNM_VE, _vVE(c, i+1, j  ), 2, 1);
+            _fspt(RCNM_VE, _hVE(c, i,   j  ), 2, 1);
+        } else {
+            _fspt(RCNM_VE, _ringVE(c, b, k-1), 1, 1);
+        }
+        _fspt(RCNM_VE, _ringVE(c, b, k), 2, 2);       // interior
+        ok &= _recEnd(c->fd, 0);
+    }
+
+    // DEPCNT
+    for (int k=0; k<_K-1; ++k) {
+        _feaRec(c, 2, 2, DEPCNT);
+        _fld("ATTF");
+        _att(VALDCO, "%.1f", VALCNT(k));
+        _fld("FSPT");
+        _fspt(RCNM_VE, _ringVE(c, b, k), 1, 255);
+        ok &= _recEnd(c->fd, 0);
+    }
+
+    // LNDARE / COALNE (land on the right)
+    _feaRec(c, 3, 1, LNDARE);
+    _fld("ATTF");
+    _att(OBJNAM, "Island %i-%i-%i", c->cellNo, i, j);
+    _fld("FSPT");
+    _fspt(RCNM_VE, _ringVE(c, b, _K-1), 1, 1);
+    ok &= _recEnd(c->fd, 0);
+
+    _feaRec(c, 2, 2, COALNE);
+    _fld("FSPT");
+    _fspt(RCNM_VE, _ringVE(c, b, _K-1), 1, 255);
+    ok &= _recEnd(c->fd, 0);
+
+    // SOUNDG - SCAMIN on odd annulus
+    for (int k=0; k<_K; ++k) {
+        _feaRec(c, 1, 2, SOUNDG);
+        if (1 == k%2) {
+            _fld("ATTF");
+            _att(SCAMIN, "%i", 4*_cscl);
+        }
+        _fld("FSPT");
+        _fspt(RCNM_VI, _VI(c, b, k), 255, 255);
+        ok &= _recEnd(c->fd, 0);
+    }
+
+    // BOYLAT + LIGHTS + TOPMAR - IALA A: port red can, starboard green cone
+    for (int n=0; n<_B; ++n) {
+        int          port  = (0 == n%2);
+        unsigned int light = c->fidn + 1;
+
+        _feaRec(c, 1, 2, LIGHTS);
+        _fld("ATTF");
+        _att(COLOUR, "%i", port ? 3 : 4);
+        _att(LITCHR, "2");
+        _att(SIGGRP, "(1)");
+        _att(SIGPER, "4");
+        _att(VALNMR, "3");
+        _fld("FSPT");
+        _fspt(RCNM_VI, _VI(c, b, _K + n), 255, 255);
+        ok &= _recEnd(c->fd, 0);
+
+        _feaRec(c, 1, 2, TOPMAR);
+        _fld("ATTF");
+        _att(COLOUR, "%i", port ? 3 : 4);
+        _att(TOPSHP, "%i", port ? 5 : 1);
+        _fld("FSPT");
+        _fspt(RCNM_VI, _VI(c, b, _K + n), 255, 255);
+        ok &= _recEnd(c->fd, 0);
+
+        _feaRec(c, 1, 2, BOYLAT);
+        _fld("ATTF");
+        _att(BOYSHP, "%i", port ? 2 : 1);
+        _att(CATLAM, "%i", port ? 1 : 2);
+        _att(COLOUR, "%i", port ? 3 : 4);
+        _att(OBJNAM, "%s %i", port ? "R" : "G", n+1);
+        _fld("FFPT");                                  // slave: light, topmark
+        _b12(AGEN); _b14(light);   _b12(1); _b11(2); _A("");
+        _b12(AGEN); _b14(light+1); _b12(1); _b11(2); _A("");
+        _fld("FSPT");
+        _fspt(RCNM_VI, _VI(c, b, _K + n), 255, 255);
+        ok &= _recEnd(c->fd, 0);
+    }
+
+    // sector light: green / white / red
+    static const int    col[3] = {4, 1, 3};
+    static const double sec[4] = {-60.0, -3.0, 3.0, 60.0};
+    for (int n=0; n<3; ++n) {
+        _feaRec(c, 1, 2, LIGHTS);
+        _fld("ATTF");
+        _att(COLOUR, "%i", col[n]);
+        _att(LITCHR, "7");
+        _att(SIGPER, "6");
+        _att(SECTR1, "%.1f", fmod(sector + sec[n]   + 360.0, 360.0));
+        _att(SECTR2, "%.1f", fmod(sector + sec[n+1] + 360.0, 360.0));
+        _att(VALNMR, "%i", (1 == n) ? 12 : 9);
+        _fld("FSPT");
+        _fspt(RCNM_VI, _VI(c, b, _K + _B), 255, 255);
+        ok &= _recEnd(c->fd, 0);
+    }
+
+    // OBSTRN - every other one without VALSOU (CS default depth)
+    for (int n=0; n<_O; ++n) {
+        _feaRec(c, 1, 2, OBSTRN);
+        _fld("ATTF");
+        _att(CATOBS, "1");
+        _att(WATLEV, "3");
+        if (0 == n%2)
+            _att(VALSOU, "%.1f", obsD[n]);
+        else
+            _att(SCAMIN, "%i", 4*_cscl);
+        _fld("FSPT");
+        _fspt(RCNM_VI, _VI(c, b, _K + _B + 1 + n), 255, 255);
+        ok &= _recEnd(c->fd, 0);
+    }
+
+#undef VALCNT
+#undef DRMAX
+
+    return ok;
+}
+
+/////////////////////////////////////////////////
+// cell
+//
+
+static long     _objPerBlock(void)
+// OGR feature per block (SOUNDG split)
+{
+    return _K + (_K-1) + 2 + (long)_K*_S + 3*_B + 3 + _O;
+}
+
+static int      _writeCell(int cellNo, int G, const char *fname, const char *dsnm)
+{
+    genCell c;
+    int     nc  = (int)ceil(sqrt((double)_nCell));
+    int     ok  = 1;
+    long    nB  = (long)G*G;
+    char    date[9];
+
+    c.fd     = fopen(fname, "wb");
+    c.G      = G;
+    c.bs     = _deg / G;
+    c.lat0   = _lat + (cellNo / nc) * _deg;
+    c.lon0   = _lon + (cellNo % nc) * _deg;
+    c.recNo  = 0;
+    c.fidn   = 0;
+    c.cellNo = cellNo;
+
+    if (NULL == c.fd) {
+        fprintf(stderr, "ERROR: can't open %s: %s\n", fname, strerror(errno));
+        return 0;
+    }
+    setvbuf(c.fd, NULL, _IOFBF, 1 << 20);
+
+    // fixed date - same byte for same option
+    snprintf(date, sizeof(date), "20180101");
+
+    ok &= _writeDDR(c.fd);
+
+    // DSID
+    _recBeg(&c);
+    _fld("DSID");
+    _b11(RCNM_DS); _b14(1);
+    _b11(1);                 // EXPP: new
+    _b11(_intu);
+    _A(dsnm);
+    _A("1");                 // EDTN
+    _A("0");                 // UPDN
+    _Afix(date, 8);          // UADT
+    _Afix(date, 8);          // ISDT
+    _Afix("03.1", 4);        // STED
+    _b11(1);                 // PRSP: ENC
+    _A("");                  // PSDN
+    _A("2.0");               // PRED
+    _b11(1);                 // PROF: EN
+    _b12(AGEN);
+    _A("s52encgen");
+    _fld("DSSI");
+    _b11(2);                 // DSTR: chain-node
+    _b11(0); _b11(0);        // AALL, NALL: ASCII
+    _b14(1);                 // NOMR: M_COVR
+    _b14(0);                 // NOCR
+    _b14(nB * (_K + (_K-1) + 2 + _K + 3*_B + 3 + _O));        // NOGR
+    _b14(0);                 // NOLR
+    _b14(nB * NISO);                                          // NOIN
+    _b14((long)(G+1)*(G+1) + nB*_K);                          // NOCN
+    _b14(2L*G*(G+1) + nB*_K);                                 // NOED
+    _b14(0);                 // NOFA
+    ok &= _recEnd(c.fd, 0);
+
+    // DSPM
+    _recBeg(&c);
+    _fld("DSPM");
+    _b11(RCNM_DP); _b14(1);
+    _b11(2);                 // HDAT: WGS 84
+    _b11(23);                // VDAT: LAT
+    _b11(23);                // SDAT: LAT
+    _b14(_cscl);
+    _b11(1); _b11(1); _b11(1);   // DUNI, HUNI, PUNI: metre
+    _b11(1);                 // COUN: lat/lon
+    _b14((unsigned int)COMF);
+    _b14((unsigned int)SOMF);
+    _A("");
+    ok &= _recEnd(c.fd, 0);
+
+    // vector: isolated node, connected node, edge
+    for (int b=0; b<nB && ok; ++b)
+        ok &= _block(&c, b%G, b/G, PASS_VI);
+
+    for (int j=0; j<=G && ok; ++j) {
+        for (int i=0; i<=G; ++i) {
+            double lat, lon;
+            _gridNode(&c, i, j, &lat, &lon);
+            _vecRec(&c, RCNM_VC, _gridVC(&c, i, j));
+            _fld("SG2D");
+            _coord(lat, lon);
+            ok &= _recEnd(c.fd, 0);
+        }
+    }
+    for (int b=0; b<nB && ok; ++b)
+        ok &= _block(&c, b%G, b/G, PASS_VC);
+
+    for (int j=0; j<=G && ok; ++j) {
+        for (int i=0; i<=G; ++i) {
+            if (i < G) ok &= _gridEdge(&c, i, j, 0);
+            if (j < G) ok &= _gridEdge(&c, i, j, 1);
+        }
+    }
+    for (int b=0; b<nB && ok; ++b)
+        ok &= _block(&c, b%G, b/G, PASS_VE);
+
+    // feature: M_COVR (meta) - on the outer grid edge, clockwise
+    if (ok) {
+        _feaRec(&c, 3, 2, M_COVR);
+        _fld("ATTF");
+        _att(CATCOV, "1");
+        _fld("FSPT");
+        for (int j=0;   j<G;   ++j) _fspt(RCNM_VE, _vVE(&c, 0, j), 1, 1);
+        for (int i=0;   i<G;   ++i) _fspt(RCNM_VE, _hVE(&c, i, G), 1, 1);
+        for (int j=G-1; j>=0;  --j) _fspt(RCNM_VE, _vVE(&c, G, j), 2, 1);
+        for (int i=G-1; i>=0;  --i) _fspt(RCNM_VE, _hVE(&c, i, 0), 2, 1);
+        ok &= _recEnd(c.fd, 0);
+    }
+
+    for (int b=0; b<nB && ok; ++b)
+        ok &= _block(&c, b%G, b/G, PASS_FE);
+
+    if (0 != fclose(c.fd)) {
+        fprintf(stderr, "ERROR: can't write %s: %s\n", fname, strerror(errno));
+        ok = 0;
+    }
+
+    return ok;
+}
+
+static void     _usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [option]\n"
+            "  -n N    object (OGR feature) total         (default %li)\n"
+            "  -c N    cell                               (default %i)\n"
+            "  -k K    nested ring (DEPARE) per block     (default %i)\n"
+            "  -s S    SOUNDG per DEPARE                  (default %i)\n"
+            "  -b B    BOYLAT+LIGHTS+TOPMAR per block     (default %i)\n"
+            "  -x O    OBSTRN per block                   (default %i)\n"
+            "  -p P    point per ring                     (default %i)\n"
+            "  -l LAT  SW corner latitude                 (default %.2f)\n"
+            "  -L LON  SW corner longitude                (default %.2f)\n"
+            "  -d DEG  cell size (deg)                    (default %.2f)\n"
+            "  -S CSCL compilation scale                  (default %i)\n"
+            "  -i INTU intended usage (1-6)               (default %i)\n"
+            "  -r SEED random seed                        (default %u)\n"
+            "  -o DIR  output dir                         (default %s)\n",
+            prog, _nObj, _nCell, _K, _S, _B, _O, _P, _lat, _lon, _deg, _cscl, _intu, _seed, _outdir);
+}
+
+int main(int argc, char *argv[])
+{
+    int opt;
+    while (-1 != (opt = getopt(argc, argv, "n:c:k:s:b:x:p:l:L:d:S:i:r:o:h"))) {
+        switch (opt) {
+            case 'n': _nObj   = atol(optarg);               break;
+            case 'c': _nCell  = atoi(optarg);               break;
+            case 'k': _K      = atoi(optarg);               break;
+            case 's': _S      = atoi(optarg);               break;
+            case 'b': _B      = atoi(optarg);               break;
+            case 'x': _O      = atoi(optarg);               break;
+            case 'p': _P      = atoi(optarg);               break;
+            case 'l': _lat    = strtod(optarg, NULL);       break;
+            case 'L': _lon    = strtod(optarg, NULL);       break;
+            case 'd': _deg    = strtod(optarg, NULL);       break;
+            case 'S': _cscl   = atoi(optarg);               break;
+            case 'i': _intu   = atoi(optarg);               break;
+            case 'r': _seed   = (unsigned int)atol(optarg); break;
+            case 'o': _outdir = optarg;                     break;
+            default : _usage(argv[0]);                      return 1;
+        }
+    }
+
+    if ((_nObj<1) || (_nCell<1) || (_nCell>9999) || (_K<1) || (_K>MAXRING) || (_S<1) || (_B<0) ||
+        (_O<0) || (_O>64) || (_P<3) || (_deg<=0.0) || (_intu<1) || (_intu>6)) {
+        _usage(argv[0]);
+        return 1;
+    }
+
+    long perCell = (_nObj + _nCell - 1) / _nCell;
+    long nBlock  = (perCell + _objPerBlock() - 1) / _objPerBlock();
+    int  G       = (int)ceil(sqrt((double)nBlock));
+    if (2000 < G) {
+        fprintf(stderr, "ERROR: %i x %i block per cell - raise -c\n", G, G);
+        return 1;
+    }
+
+    if ((0 != mkdir(_outdir, 0755)) && (EEXIST != errno)) {
+        fprintf(stderr, "ERROR: can't create %s: %s\n", _outdir, strerror(errno));
+        return 1;
+    }
+
+    char  fname[4096];
+    snprintf(fname, sizeof(fname), "%s/cells.txt", _outdir);
+    FILE *list = fopen(fname, "w");
+    if (NULL == list) {
+        fprintf(stderr, "ERROR: can't open %s: %s\n", fname, strerror(errno));
+        return 1;
+    }
+
+    for (int n=0; n<_nCell; ++n) {
+        char dsnm[32];
+        snprintf(dsnm,  sizeof(dsnm),  "ZZ%iS%04i.000", _intu, n);
+        snprintf(fname, sizeof(fname), "%s/%s", _outdir, dsnm);
+
+        if (0 == _writeCell(n, G, fname, dsnm)) {
+            fclose(list);
+            return 1;
+        }
+        fprintf(list, "%s\n", fname);
+    }
+    fclose(list);
+
+    int nc = (int)ceil(sqrt((double)_nCell));
+    int nr = (_nCell + nc - 1) / nc;
+    printf("%i cell of %ix%i block, %li object (%li per block)\n",
+           _nCell, G, G, (long)_nCell*G*G*_objPerBlock(), _objPerBlock());
+    printf("view (s52headless -v): %.4f,%.4f,%.2f,0.0\n",
+           _lat + _deg*nr/2.0, _lon + _deg*nc/2.0, _deg*60.0*nr/2.0);
+
+    return 0;
+}
@@ -0,0 +1,370 @@
+// s52headless.c: batch render of chart to PNG - EGL without window (surfaceless / pbuffer)
+//
+// Project:  OpENCview
+
+/*
+    This file is part of the OpENCview project, a viewer of ENC.
+    Copyright (C) 2000-2018 Sylvain Duclos sduclos@users.sourceforge.net
+
+    OpENCview is free software: you can redistribute it and/or modify
+    it under the terms of the Lesser GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpENCview is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Lesser GNU General Public License for more details.
+
+    You should have received a copy of the Lesser GNU General Public License
+    along with OpENCview.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Usage:
+//   $ ./s52headless -c GB4X0000.000 -v 50.6,0.0,4.0,0.0 -p DAY_BRIGHT,NIGHT -o /tmp/dump
+//   $ ./s52headless -C cells.txt -V views.txt -o /tmp/dump -r ref_dump
+//
+// view: lat,lon,rNM,north[,name] - one per line in -V file ('#' comment)
+// output: <outdir>/<name>_<palette>.png, name default to view<N>
+// -r: compare output to <refdir>/<name>_<palette>.png, then <refdir>/<name>.png,
+//     exit 1 if a PNG differ by more than -m percent of its pixels
+//
+// EGL: see _egl_headless.i
+
+#include "S52.h"
+
+#include <gdal.h>          // GDALOpen() - compare PNG
+
+#include <stdlib.h>        // atoi(), abs()
+
+#include <glib.h>
+#include <glib/gstdio.h>   // g_mkdir_with_parents()
+
+#define  LOGI(...)  g_print(__VA_ARGS__)
+#define  LOGE(...)  g_printerr(__VA_ARGS__)
+
+#include "_egl_headless.i"     // _egl_init(), _egl_beg(), _egl_end(), _egl_done(), hlState
+
+#define INCH2MM  25.4
+
+typedef struct hlView {
+    double cLat, cLon, rNM, north;
+    char  *name;
+} hlView;
+
+static hlState _hl;
+
+// options
+static gchar  **_cells    = NULL;   // -c
+static gchar   *_cellsFNm = NULL;   // -C
+static gchar  **_views    = NULL;   // -v
+static gchar   *_viewsFNm = NULL;   // -V
+static gchar   *_palettes = NULL;   // -p
+static gchar   *_outdir   = NULL;   // -o
+static gchar   *_refdir   = NULL;   // -r
+static gint     _width    = 1280;   // -W
+static gint     _height   = 1024;   // -H
+static gdouble  _dpi      = 96.0;   // -d
+static gdouble  _maxdiff  = 0.0;    // -m
+static gint     _tol      = 0;      // -t
+static gboolean _pbuffer  = FALSE;  // -b
+
+static int      _option(int *argc, char ***argv)
+{
+    GOptionEntry entries[] =
+    {
+        { "cell",     'c', 0, G_OPTION_ARG_FILENAME_ARRAY, &_cells,    "ENC to load (repeat)",                    "FILE"   },
+        { "cells",    'C', 0, G_OPTION_ARG_FILENAME,       &_cellsFNm, "file with one ENC per line",              "FILE"   },
+        { "view",     'v', 0, G_OPTION_ARG_STRING_ARRAY,   &_views,    "view: lat,lon,rNM,north[,name] (repeat)", "VIEW"   },
+        { "views",    'V', 0, G_OPTION_ARG_FILENAME,       &_viewsFNm, "file with one view per line",             "FILE"   },
+        { "palettes", 'p', 0, G_OPTION_ARG_STRING,         &_palettes, "palette name or index, comma separated",  "LIST"   },
+        { "outdir",   'o', 0, G_OPTION_ARG_FILENAME,       &_outdir,   "output dir (default .)",                  "DIR"    },
+        { "refdir",   'r', 0, G_OPTION_ARG_FILENAME,       &_refdir,   "reference PNG dir to compare to",         "DIR"    },
+        { "width",    'W', 0, G_OPTION_ARG_INT,            &_width,    "image width  (default 1280)",             "PIXELS" },
+        { "height",   'H', 0, G_OPTION_ARG_INT,            &_height,   "image height (default 1024)",             "PIXELS" },
+        { "dpi",      'd', 0, G_OPTION_ARG_DOUBLE,         &_dpi,      "dot per inch (default 96)",               "DPI"    },
+        { "maxdiff",  'm', 0, G_OPTION_ARG_DOUBLE,         &_maxdiff,  "max % of pixels that differ (default 0)", "PC"     },
+        { "tol",      't', 0, G_OPTION_ARG_INT,            &_tol,      "tolerance per channel (default 0)",       "0-255"  },
+        { "pbuffer",  'b', 0, G_OPTION_ARG_NONE,           &_pbuffer,  "use a pbuffer, not surfaceless",          NULL     },
+        { NULL, 0, 0, 0, NULL, NULL, NULL }
+    };
+
+    GError         *error   = NULL;
+    GOptionContext *context = g_option_context_new("- render ENC to PNG without window");
+    g_option_context_add_main_entries(context, entries, NULL);
+    int ret = g_option_context_parse(context, argc, argv, &error);
+    if (FALSE == ret) {
+        LOGE("option parsing failed: %s\n", error->message);
+        g_error_free(error);
+    }
+    g_option_context_free(context);
+
+    if (NULL == _outdir)
+        _outdir = g_strdup(".");
+
+    return ret;
+}
+
+static GPtrArray *_readLines(const char *fname, gchar **list)
+// lines of 'fname' ('#' comment, blank skipped) then 'list'
+{
+    GPtrArray *lines = g_ptr_array_new_with_free_func(g_free);
+
+    if (NULL != fname) {
+        gchar *txt = NULL;
+        if (FALSE == g_file_get_contents(fname, &txt, NULL, NULL)) {
+            LOGE("WARNING: can't read %s\n", fname);
+        } else {
+            gchar **l = g_strsplit(txt, "\n", 0);
+            for (gchar **s=l; NULL!=*s; ++s) {
+                g_strstrip(*s);
+                if (('\0'!=**s) && ('#'!=**s))
+                    g_ptr_array_add(lines, g_strdup(*s));
+            }
+            g_strfreev(l);
+            g_free(txt);
+        }
+    }
+
+    for (gchar **s=list; (NULL!=s) && (NULL!=*s); ++s)
+        g_ptr_array_add(lines, g_strdup(*s));
+
+    return lines;
+}
+
+static int      _parseView(const char *str, guint n, hlView *view)
+{
+    gchar **tok = g_strsplit(str, ",", 5);
+    guint   len = g_strv_length(tok);
+
+    if (len < 4) {
+        LOGE("WARNING: bad view '%s' (lat,lon,rNM,north[,name])\n", str);
+        g_strfreev(tok);
+        return FALSE;
+    }
+
+    view->cLat  = g_ascii_strtod(tok[0], NULL);
+    view->cLon  = g_ascii_strtod(tok[1], NULL);
+    view->rNM   = g_ascii_strtod(tok[2], NULL);
+    view->north = g_ascii_strtod(tok[3], NULL);
+    view->name  = (5 == len) ? g_strdup(g_strstrip(tok[4])) : g_strdup_printf("view%04u", n);
+
+    g_strfreev(tok);
+
+    return TRUE;
+}
+
+static GArray  *_getPalettes(const char *list)
+// palette name or index --> index of S52_MAR_COLOR_PALETTE
+{
+    GArray *idx      = g_array_new(FALSE, FALSE, sizeof(int));
+    gchar **loaded   = g_strsplit(S52_getPalettesNameList(), ",", 0);
+    gchar **palettes = g_strsplit((NULL==list) ? "DAY_BRIGHT" : list, ",", 0);
+
+    for (gchar **p=palettes; NULL!=*p; ++p) {
+        int i = -1;
+
+        g_strstrip(*p);
+        if (g_ascii_isdigit(**p)) {
+            i = atoi(*p);
+        } else {
+            for (int j=0; NULL!=loaded[j]; ++j) {
+                if (0 == g_ascii_strcasecmp(loaded[j], *p))
+                    i = j;
+            }
+        }
+
+        if ((i < 0) || ((guint)i >= g_strv_length(loaded))) {
+            LOGE("WARNING: unknown palette '%s' (%s)\n", *p, S52_getPalettesNameList());
+            continue;
+        }
+        g_array_append_val(idx, i);
+    }
+
+    g_strfreev(palettes);
+    g_strfreev(loaded);
+
+    return idx;
+}
+
+static double   _cmpPNG(const char *fname, const char *refname)
+// return % of pixels that differ by more than _tol on R, G or B, -1 if can't compare
+{
+    GDALDatasetH out = GDALOpen(fname,   GA_ReadOnly);
+    GDALDatasetH ref = GDALOpen(refname, GA_ReadOnly);
+    double       pc  = -1.0;
+
+    if ((NULL==out) || (NULL==ref))
+        goto exit;
+
+    int w = GDALGetRasterXSize(out);
+    int h = GDALGetRasterYSize(out);
+    if ((w != GDALGetRasterXSize(ref)) || (h != GDALGetRasterYSize(ref))) {
+        LOGE("WARNING: %s: size %ix%i differ from %s\n", fname, w, h, refname);
+        goto exit;
+    }
+    if ((3 > GDALGetRasterCount(out)) || (3 > GDALGetRasterCount(ref)))
+        goto exit;
+
+    guint8 *a    = g_new(guint8, w);
+    guint8 *b    = g_new(guint8, w);
+    guint8 *diff = g_new0(guint8, (gsize)w * h);
+    for (int band=1; band<=3; ++band) {
+        GDALRasterBandH bandA = GDALGetRasterBand(out, band);
+        GDALRasterBandH bandB = GDALGetRasterBand(ref, band);
+        for (int y=0; y<h; ++y) {
+            CPLErr err = CE_None;
+            err |= GDALRasterIO(bandA, GF_Read, 0, y, w, 1, a, w, 1, GDT_Byte, 0, 0);
+            err |= GDALRasterIO(bandB, GF_Read, 0, y, w, 1, b, w, 1, GDT_Byte, 0, 0);
+            if (CE_None != err)
+                continue;
+            for (int x=0; x<w; ++x) {
+                if (abs(a[x] - b[x]) > _tol)
+                    diff[y*w + x] = 1;
+            }
+        }
+    }
+
+    guint n = 0;
+    for (gsize i=0; i<(gsize)w*h; ++i)
+        n += diff[i];
+    pc = (100.0 * n) / ((double)w * h);
+
+    g_free(a);
+    g_free(b);
+    g_free(diff);
+
+exit:
+    if (NULL != out) GDALClose(out);
+    if (NULL != ref) GDALClose(ref);
+
+    return pc;
+}
+
+static int      _render(hlView *view, int palette, const char *palName, guint *nFail)
+{
+    S52_setMarinerParam(S52_MAR_COLOR_PALETTE, (double)palette);
+    S52_setView(view->cLat, view->cLon, view->rNM, view->north);
+
+    if (FALSE == S52_draw()) {
+        LOGE("WARNING: S52_draw() failed on %s\n", view->name);
+        return FALSE;
+    }
+    S52_drawLast();
+
+    gchar *base  = g_strdup_printf("%s_%s.png", view->name, palName);
+    gchar *fname = g_build_filename(_outdir, base, NULL);
+    int    ret   = S52_dumpS57IDPixels(fname, 0, 0, 0);
+    if (FALSE == ret)
+        LOGE("WARNING: S52_dumpS57IDPixels() failed on %s\n", fname);
+
+    if ((TRUE==ret) && (NULL!=_refdir)) {
+        gchar *refname = g_build_filename(_refdir, base, NULL);
+        if (FALSE == g_file_test(refname, G_FILE_TEST_EXISTS)) {
+            gchar *refbase = g_strdup_printf("%s.png", view->name);
+            g_free(refname);
+            refname = g_build_filename(_refdir, refbase, NULL);
+            g_free(refbase);
+        }
+
+        if (TRUE == g_file_test(refname, G_FILE_TEST_EXISTS)) {
+            double pc = _cmpPNG(fname, refname);
+            if ((pc < 0.0) || (pc > _maxdiff)) {
+                LOGE("FAIL: %s vs %s: %.3f%% pixels differ\n", fname, refname, pc);
+                ++*nFail;
+            } else {
+                LOGI("OK  : %s vs %s: %.3f%% pixels differ\n", fname, refname, pc);
+            }
+        }
+        g_free(refname);
+    }
+
+    g_free(fname);
+    g_free(base);
+
+    return ret;
+}
+
+int main(int argc, char *argv[])
+{
+    if (FALSE == _option(&argc, &argv))
+        return 1;
+
+    GPtrArray *cells = _readLines(_cellsFNm, _cells);
+    GPtrArray *views = _readLines(_viewsFNm, _views);
+    if ((0==cells->len) || (0==views->len)) {
+        LOGE("need at least one ENC (-c/-C) and one view (-v/-V) - see --help\n");
+        return 1;
+    }
+
+    g_mkdir_with_parents(_outdir, 0755);
+
+    if (FALSE == _egl_init(&_hl, _width, _height, _pbuffer)) {
+        _egl_done(&_hl);
+        return 1;
+    }
+
+    int wmm = (int)(_width  / _dpi * INCH2MM);
+    int hmm = (int)(_height / _dpi * INCH2MM);
+    if (FALSE == S52_init(_width, _height, wmm, hmm, NULL)) {
+        LOGE("S52_init(%i,%i,%i,%i) failed\n", _width, _height, wmm, hmm);
+        _egl_done(&_hl);
+        return 1;
+    }
+    S52_setViewPort(0, 0, _width, _height);
+
+    S52_setEGLCallBack((S52_EGL_cb)_egl_beg, (S52_EGL_cb)_egl_end, &_hl);
+    if (0 != _hl.fboID)
+        S52_setFBO(_hl.fboID);
+
+    GDALAllRegister();
+
+    for (guint i=0; i<cells->len; ++i) {
+        const char *cell = (const char *)g_ptr_array_index(cells, i);
+        if (FALSE == S52_loadCell(cell, NULL))
+            LOGE("WARNING: S52_loadCell(%s) failed\n", cell);
+    }
+
+    // decoration (scale bar, North arrow, unit, calib.)
+    S52_newCSYMB();
+
+    GArray  *palettes = _getPalettes(_palettes);
+    gchar  **palNames = g_strsplit(S52_getPalettesNameList(), ",", 0);
+    guint    nImg     = 0;
+    guint    nFail    = 0;
+    GTimer  *timer    = g_timer_new();
+
+    for (guint i=0; i<views->len; ++i) {
+        hlView view;
+        if (FALSE == _parseView((const char *)g_ptr_array_index(views, i), i, &view)) {
+            ++nFail;
+            continue;
+        }
+
+        for (guint j=0; j<palettes->len; ++j) {
+            int p = g_array_index(palettes, int, j);
+            if (TRUE == _render(&view, p, palNames[p], &nFail))
+                ++nImg;
+            else
+                ++nFail;
+        }
+
+        g_free(view.name);
+    }
+
+    double sec = g_timer_elapsed(timer, NULL);
+    LOGI("%u image in %.1f sec (%.0f msec/image, %.0f image/hour), %u fail\n",
+         nImg, sec, (0==nImg) ? 0.0 : sec*1000.0/nImg, (0.0==sec) ? 0.0 : nImg*3600.0/sec, nFail);
+
+    g_timer_destroy(timer);
+    g_strfreev(palNames);
+    g_array_free(palettes, TRUE);
+    g_ptr_array_free(views, TRUE);
+    g_ptr_array_free(cells, TRUE);
+
+    S52_done();
+
+    _egl_done(&_hl);
+
+    return (0 == nFail) ? 0 : 1;
+}